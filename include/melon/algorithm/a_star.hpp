@@ -0,0 +1,273 @@
+#ifndef MELON_ALGORITHM_A_STAR_HPP
+#define MELON_ALGORITHM_A_STAR_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/d_ary_heap.hpp"
+#include "melon/detail/intrusive_view.hpp"
+#include "melon/detail/map_if.hpp"
+#include "melon/detail/prefetch.hpp"
+#include "melon/graph.hpp"
+#include "melon/mapping.hpp"
+#include "melon/utility/algorithmic_generator.hpp"
+#include "melon/utility/priority_queue.hpp"
+#include "melon/utility/semiring.hpp"
+#include "melon/views/graph_view.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+template <typename _Graph, typename _ValueType>
+using a_star_default_traits = dijkstra_default_traits<_Graph, _ValueType>;
+
+// Dijkstra algorithm on the reduced lengths l(u,v) - p(u) + p(v) for a vertex
+// potential p, that settles the vertices by increasing dist(s,u) + p(u). The
+// potential is assumed to be consistent, i.e. p(u) <= l(u,v) + p(v) for every
+// arc (u,v), such that the settled distances are exact, and is usually a lower
+// bound on the distance to the target. The zero potential gives Dijkstra.
+template <outward_incidence_graph _Graph,
+          input_mapping<arc_t<_Graph>> _LengthMap,
+          input_mapping<vertex_t<_Graph>> _PotentialMap, dijkstra_trait _Traits>
+    requires has_vertex_map<_Graph>
+class a_star {
+private:
+    using vertex = vertex_t<_Graph>;
+    using arc = arc_t<_Graph>;
+
+    using length_type = mapped_value_t<_LengthMap, arc_t<_Graph>>;
+    using traversal_entry = std::pair<vertex, length_type>;
+
+    using heap = _Traits::heap;
+    enum vertex_status : char { PRE_HEAP = 0, IN_HEAP = 1, POST_HEAP = 2 };
+
+    static_assert(std::is_same_v<typename heap::value_type,
+                                 std::pair<vertex, length_type>>,
+                  "a_star requires heap entries type.");
+
+private:
+    _Graph _graph;
+    _LengthMap _length_map;
+    _PotentialMap _potential_map;
+    heap _heap;
+    vertex_map_t<_Graph, vertex_status> _vertex_status_map;
+    vertex_map_t<_Graph, length_type> _distances_map;
+
+    [[no_unique_address]] vertex_map_if<_Traits::store_paths &&
+                                            !has_arc_source<_Graph>,
+                                        _Graph, vertex> _pred_vertices_map;
+    [[no_unique_address]] vertex_map_if<_Traits::store_paths, _Graph,
+                                        std::optional<arc>> _pred_arcs_map;
+
+public:
+    template <typename _G, typename _M, typename _P>
+    [[nodiscard]] constexpr a_star(_G && g, _M && l, _P && p)
+        : _graph(views::graph_all(std::forward<_G>(g)))
+        , _length_map(views::mapping_all(std::forward<_M>(l)))
+        , _potential_map(views::mapping_all(std::forward<_P>(p)))
+        , _heap(typename _Traits::semiring::less_t(),
+                create_vertex_map<std::size_t>(_graph))
+        , _vertex_status_map(create_vertex_map<vertex_status>(_graph, PRE_HEAP))
+        , _distances_map(create_vertex_map<length_type>(_graph))
+        , _pred_vertices_map(_graph)
+        , _pred_arcs_map(_graph) {}
+
+    template <typename _G, typename _M, typename _P>
+    [[nodiscard]] constexpr a_star(_G && g, _M && l, _P && p, const vertex & s)
+        : a_star(std::forward<_G>(g), std::forward<_M>(l),
+                 std::forward<_P>(p)) {
+        add_source(s);
+    }
+
+    template <typename... _Args>
+    [[nodiscard]] constexpr a_star(_Traits, _Args &&... args)
+        : a_star(std::forward<_Args>(args)...) {}
+
+    [[nodiscard]] constexpr a_star(const a_star &) = default;
+    [[nodiscard]] constexpr a_star(a_star &&) = default;
+
+    constexpr a_star & operator=(const a_star &) = default;
+    constexpr a_star & operator=(a_star &&) = default;
+
+    constexpr a_star & reset() noexcept {
+        _heap.clear();
+        _vertex_status_map.fill(PRE_HEAP);
+        return *this;
+    }
+    // Replaces the potential, which is only valid between two searches.
+    template <typename _P>
+    constexpr a_star & set_potential(_P && p) noexcept {
+        assert(finished());
+        _potential_map = views::mapping_all(std::forward<_P>(p));
+        return *this;
+    }
+    constexpr a_star & add_source(
+        const vertex & s,
+        const length_type & dist = _Traits::semiring::zero) noexcept {
+        assert(_vertex_status_map[s] != IN_HEAP);
+        _heap.push(std::make_pair(
+            s, _Traits::semiring::plus(dist, _potential_map[s])));
+        _vertex_status_map[s] = IN_HEAP;
+        _distances_map[s] = dist;
+        if constexpr(_Traits::store_paths) {
+            _pred_arcs_map[s].reset();
+            if constexpr(!has_arc_source<_Graph>) _pred_vertices_map[s] = s;
+        }
+        return *this;
+    }
+
+    [[nodiscard]] constexpr bool finished() const noexcept {
+        return _heap.empty();
+    }
+
+    [[nodiscard]] constexpr traversal_entry current() const noexcept {
+        assert(!finished());
+        const vertex t = _heap.top().first;
+        return std::make_pair(t, _distances_map[t]);
+    }
+
+private:
+    constexpr void relax(const vertex & t, const length_type & st_dist,
+                         const arc & a) noexcept {
+        const vertex & w = melon::arc_target(_graph, a);
+        const vertex_status & w_status = _vertex_status_map[w];
+        if(w_status == IN_HEAP) {
+            const length_type new_dist =
+                _Traits::semiring::plus(st_dist, _length_map[a]);
+            if(_Traits::semiring::less(new_dist, _distances_map[w])) {
+                _heap.promote(w, _Traits::semiring::plus(new_dist,
+                                                         _potential_map[w]));
+                _distances_map[w] = new_dist;
+                if constexpr(_Traits::store_paths) {
+                    _pred_arcs_map[w].emplace(a);
+                    if constexpr(!has_arc_source<_Graph>)
+                        _pred_vertices_map[w] = t;
+                }
+            }
+        } else if(w_status == PRE_HEAP) {
+            const length_type new_dist =
+                _Traits::semiring::plus(st_dist, _length_map[a]);
+            _heap.push(std::make_pair(
+                w, _Traits::semiring::plus(new_dist, _potential_map[w])));
+            _vertex_status_map[w] = IN_HEAP;
+            _distances_map[w] = new_dist;
+            if constexpr(_Traits::store_paths) {
+                _pred_arcs_map[w].emplace(a);
+                if constexpr(!has_arc_source<_Graph>) _pred_vertices_map[w] = t;
+            }
+        }
+    }
+
+public:
+    constexpr void advance() noexcept {
+        assert(!finished());
+        const vertex t = _heap.top().first;
+        const length_type st_dist = _distances_map[t];
+        _vertex_status_map[t] = POST_HEAP;
+        auto && out_arcs_range = melon::out_arcs(_graph, t);
+        prefetch_range(out_arcs_range);
+        prefetch_mapped_values(out_arcs_range, arc_targets_map(_graph));
+        prefetch_mapped_values(out_arcs_range, _length_map);
+        _heap.pop();
+        for(const arc & a : out_arcs_range) relax(t, st_dist, a);
+    }
+
+    constexpr void run() noexcept {
+        while(!finished()) advance();
+    }
+    // Runs the search until t is settled or cannot be reached.
+    constexpr void run_until(const vertex & t) noexcept {
+        while(!finished() && !visited(t)) advance();
+    }
+    [[nodiscard]] constexpr auto begin() noexcept {
+        return algorithm_iterator(*this);
+    }
+    [[nodiscard]] constexpr auto end() noexcept {
+        return algorithm_end_sentinel();
+    }
+
+    [[nodiscard]] constexpr bool reached(const vertex & u) const noexcept {
+        return _vertex_status_map[u] != PRE_HEAP;
+    }
+    [[nodiscard]] constexpr bool visited(const vertex & u) const noexcept {
+        return _vertex_status_map[u] == POST_HEAP;
+    }
+    [[nodiscard]] constexpr arc pred_arc(const vertex & u) const noexcept
+        requires(_Traits::store_paths)
+    {
+        assert(reached(u));
+        return _pred_arcs_map[u].value();
+    }
+    [[nodiscard]] constexpr vertex pred_vertex(const vertex & u) const noexcept
+        requires(_Traits::store_paths)
+    {
+        assert(reached(u) && _pred_arcs_map[u].has_value());
+        if constexpr(has_arc_source<_Graph>)
+            return melon::arc_source(_graph, pred_arc(u));
+        else
+            return _pred_vertices_map[u];
+    }
+    [[nodiscard]] constexpr length_type current_dist(
+        const vertex & u) const noexcept {
+        assert(reached(u) && !visited(u));
+        return _distances_map[u];
+    }
+    [[nodiscard]] constexpr length_type dist(const vertex & u) const noexcept {
+        assert(visited(u));
+        return _distances_map[u];
+    }
+
+    [[nodiscard]] constexpr auto path_to(const vertex & t) const noexcept
+        requires(_Traits::store_paths)
+    {
+        assert(reached(t));
+        return intrusive_view(
+            static_cast<vertex>(t),
+            [this](const vertex & v) -> arc {
+                return _pred_arcs_map[v].value();
+            },
+            [this](const vertex & v) -> vertex { return pred_vertex(v); },
+            [this](const vertex & v) -> bool {
+                return _pred_arcs_map[v].has_value();
+            });
+    }
+};
+
+template <typename _Graph, typename _LengthMap, typename _PotentialMap,
+          typename _Traits = a_star_default_traits<
+              _Graph, mapped_value_t<_LengthMap, arc_t<_Graph>>>>
+a_star(_Graph &&, _LengthMap &&, _PotentialMap &&)
+    -> a_star<views::graph_all_t<_Graph>, views::mapping_all_t<_LengthMap>,
+              views::mapping_all_t<_PotentialMap>, _Traits>;
+
+template <typename _Graph, typename _LengthMap, typename _PotentialMap,
+          typename _Traits = a_star_default_traits<
+              _Graph, mapped_value_t<_LengthMap, arc_t<_Graph>>>>
+a_star(_Graph &&, _LengthMap &&, _PotentialMap &&, const vertex_t<_Graph> &)
+    -> a_star<views::graph_all_t<_Graph>, views::mapping_all_t<_LengthMap>,
+              views::mapping_all_t<_PotentialMap>, _Traits>;
+
+template <typename _Graph, typename _LengthMap, typename _PotentialMap,
+          typename _Traits>
+a_star(_Traits, _Graph &&, _LengthMap &&, _PotentialMap &&)
+    -> a_star<views::graph_all_t<_Graph>, views::mapping_all_t<_LengthMap>,
+              views::mapping_all_t<_PotentialMap>, _Traits>;
+
+template <typename _Graph, typename _LengthMap, typename _PotentialMap,
+          typename _Traits>
+a_star(_Traits, _Graph &&, _LengthMap &&, _PotentialMap &&,
+       const vertex_t<_Graph> &)
+    -> a_star<views::graph_all_t<_Graph>, views::mapping_all_t<_LengthMap>,
+              views::mapping_all_t<_PotentialMap>, _Traits>;
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_A_STAR_HPP
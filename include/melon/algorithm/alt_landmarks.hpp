@@ -0,0 +1,206 @@
+#ifndef MELON_ALGORITHM_ALT_LANDMARKS_HPP
+#define MELON_ALGORITHM_ALT_LANDMARKS_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <vector>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/detail/parallel.hpp"
+#include "melon/graph.hpp"
+#include "melon/mapping.hpp"
+#include "melon/utility/semiring.hpp"
+#include "melon/views/reverse.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Mapping of the vertices to their ALT lower bound on the distance to a
+// target, that can be reassigned to change the target between two searches.
+template <typename _Landmarks>
+class alt_potential : public mapping_view_base {
+private:
+    using vertex = typename _Landmarks::vertex;
+    const _Landmarks * _landmarks;
+    vertex _target;
+
+public:
+    [[nodiscard]] constexpr alt_potential(const _Landmarks & landmarks,
+                                          const vertex t) noexcept
+        : _landmarks(std::addressof(landmarks)), _target(t) {}
+
+    [[nodiscard]] constexpr alt_potential(const alt_potential &) = default;
+    constexpr alt_potential & operator=(const alt_potential &) = default;
+
+    [[nodiscard]] constexpr auto operator[](const vertex v) const noexcept {
+        return _landmarks->lower_bound(v, _target);
+    }
+};
+
+// Distances from and to a few landmark vertices, that give lower bounds on
+// the distance between any two vertices by the triangle inequality :
+//   dist(v,t) >= dist(v,L) - dist(t,L) and dist(v,t) >= dist(L,t) - dist(L,v).
+// Their maximum over the landmarks is a consistent potential for the A*
+// search toward t (ALT : A*, Landmarks and Triangle inequality).
+//
+// The distances of each vertex to and from every landmark are stored
+// contiguously, such that evaluating the potential reads a single row.
+// The vertices of the graph are assumed to be the integers of [0,n).
+template <typename _LengthType, std::unsigned_integral V = unsigned int>
+class basic_alt_landmarks {
+public:
+    using vertex = V;
+    using length_type = _LengthType;
+    using semiring = shortest_path_semiring<length_type>;
+
+private:
+    std::vector<vertex> _landmarks;
+    // _distances[2 * (k * v + i)] = dist(L_i,v)
+    // _distances[2 * (k * v + i) + 1] = dist(v,L_i)
+    std::vector<length_type> _distances;
+
+public:
+    [[nodiscard]] basic_alt_landmarks() = default;
+
+    // Runs the forward and backward Dijkstra searches of the landmarks with
+    // the policy threads.
+    template <outward_incidence_graph _G,
+              input_mapping<arc_t<_G>> _LengthMap, std::ranges::range _R>
+        requires inward_incidence_graph<_G> && has_vertex_map<_G> &&
+                 has_num_vertices<_G>
+    [[nodiscard]] basic_alt_landmarks(const parallel_policy & policy,
+                                      const _G & g,
+                                      const _LengthMap & length_map,
+                                      _R && landmarks)
+        : _landmarks(std::ranges::begin(landmarks),
+                     std::ranges::end(landmarks)) {
+        const std::size_t n = melon::num_vertices(g);
+        const std::size_t k = _landmarks.size();
+        std::vector<std::vector<length_type>> searches(
+            2 * k, std::vector<length_type>(n, semiring::infty));
+        detail::parallel_for(
+            detail::num_threads(policy), 2 * k, [&](const std::size_t j) {
+                std::vector<length_type> & dist = searches[j];
+                const vertex landmark = _landmarks[j / 2];
+                if(j % 2 == 0) {
+                    for(auto && [u, u_dist] :
+                        dijkstra(g, length_map, landmark))
+                        dist[static_cast<std::size_t>(u)] = u_dist;
+                } else {
+                    for(auto && [u, u_dist] :
+                        dijkstra(views::reverse(g), length_map, landmark))
+                        dist[static_cast<std::size_t>(u)] = u_dist;
+                }
+            });
+        _distances.resize(2 * k * n);
+        detail::parallel_for(detail::num_threads(policy), n,
+                             [&](const std::size_t v) {
+                                 for(std::size_t j = 0; j < 2 * k; ++j)
+                                     _distances[2 * k * v + j] =
+                                         searches[j][v];
+                             });
+    }
+    template <outward_incidence_graph _G,
+              input_mapping<arc_t<_G>> _LengthMap, std::ranges::range _R>
+        requires inward_incidence_graph<_G> && has_vertex_map<_G> &&
+                 has_num_vertices<_G>
+    [[nodiscard]] basic_alt_landmarks(const _G & g,
+                                      const _LengthMap & length_map,
+                                      _R && landmarks)
+        : basic_alt_landmarks(parallel_policy{1}, g, length_map,
+                              std::forward<_R>(landmarks)) {}
+
+    [[nodiscard]] basic_alt_landmarks(const basic_alt_landmarks &) = default;
+    [[nodiscard]] basic_alt_landmarks(basic_alt_landmarks &&) = default;
+    basic_alt_landmarks & operator=(const basic_alt_landmarks &) = default;
+    basic_alt_landmarks & operator=(basic_alt_landmarks &&) = default;
+
+    [[nodiscard]] constexpr std::size_t num_landmarks() const noexcept {
+        return _landmarks.size();
+    }
+    [[nodiscard]] constexpr const std::vector<vertex> & landmarks()
+        const noexcept {
+        return _landmarks;
+    }
+    [[nodiscard]] constexpr length_type dist_from_landmark(
+        const std::size_t i, const vertex v) const noexcept {
+        return _distances[2 * (num_landmarks() * v + i)];
+    }
+    [[nodiscard]] constexpr length_type dist_to_landmark(
+        const std::size_t i, const vertex v) const noexcept {
+        return _distances[2 * (num_landmarks() * v + i) + 1];
+    }
+
+    // Lower bound on dist(v,t) given by the landmarks. The terms involving
+    // a landmark that t cannot reach or be reached from are ignored, which
+    // keeps the potential consistent on the vertices that can reach t.
+    [[nodiscard]] constexpr length_type lower_bound(
+        const vertex v, const vertex t) const noexcept {
+        const std::size_t k = num_landmarks();
+        const length_type * v_row = _distances.data() + 2 * k * v;
+        const length_type * t_row = _distances.data() + 2 * k * t;
+        length_type bound = semiring::zero;
+        for(std::size_t j = 0; j < 2 * k; j += 2) {
+            if(t_row[j] != semiring::infty && v_row[j] != semiring::infty &&
+               v_row[j] < t_row[j])
+                bound = std::max(bound, static_cast<length_type>(t_row[j] -
+                                                                 v_row[j]));
+            if(t_row[j + 1] != semiring::infty &&
+               v_row[j + 1] != semiring::infty && t_row[j + 1] < v_row[j + 1])
+                bound = std::max(bound, static_cast<length_type>(
+                                            v_row[j + 1] - t_row[j + 1]));
+        }
+        return bound;
+    }
+
+    // The ALT potential toward t, to be given to a_star.
+    [[nodiscard]] constexpr auto potential(const vertex t) const noexcept {
+        return alt_potential(*this, t);
+    }
+};
+
+template <typename _LengthType>
+using alt_landmarks = basic_alt_landmarks<_LengthType>;
+
+// Selects num_landmarks landmarks, starting from first and then repeatedly
+// choosing the vertex that is the farthest from the chosen ones, the
+// vertices that none of them reaches coming first.
+template <outward_incidence_graph _G, input_mapping<arc_t<_G>> _LengthMap>
+    requires has_vertex_map<_G> && has_num_vertices<_G>
+[[nodiscard]] std::vector<vertex_t<_G>> farthest_landmarks(
+    const _G & g, const _LengthMap & length_map,
+    const std::size_t num_landmarks, const vertex_t<_G> first = {}) {
+    using length_type = mapped_value_t<_LengthMap, arc_t<_G>>;
+    using semiring = shortest_path_semiring<length_type>;
+    const std::size_t n = melon::num_vertices(g);
+    std::vector<vertex_t<_G>> landmarks;
+    std::vector<length_type> min_dist(n, semiring::infty);
+    std::vector<bool> is_landmark(n, false);
+    vertex_t<_G> next = first;
+    while(landmarks.size() < std::min(num_landmarks, n)) {
+        landmarks.push_back(next);
+        is_landmark[static_cast<std::size_t>(next)] = true;
+        for(auto && [u, u_dist] : dijkstra(g, length_map, next)) {
+            length_type & d = min_dist[static_cast<std::size_t>(u)];
+            d = std::min(d, u_dist);
+        }
+        std::size_t farthest = n;
+        for(std::size_t v = 0; v < n; ++v) {
+            if(is_landmark[v]) continue;
+            if(farthest == n || min_dist[farthest] < min_dist[v]) farthest = v;
+        }
+        if(farthest == n) break;
+        next = static_cast<vertex_t<_G>>(farthest);
+    }
+    return landmarks;
+}
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_ALT_LANDMARKS_HPP
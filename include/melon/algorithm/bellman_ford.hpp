@@ -0,0 +1,363 @@
+#ifndef MELON_ALGORITHM_BELLMAN_FORD_HPP
+#define MELON_ALGORITHM_BELLMAN_FORD_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "melon/detail/intrusive_view.hpp"
+#include "melon/detail/map_if.hpp"
+#include "melon/detail/parallel.hpp"
+#include "melon/graph.hpp"
+#include "melon/mapping.hpp"
+#include "melon/utility/semiring.hpp"
+#include "melon/views/graph_view.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// clang-format off
+template <typename _Traits>
+concept bellman_ford_trait = semiring<typename _Traits::semiring>;
+// clang-format on
+
+template <typename _Graph, typename _ValueType>
+struct bellman_ford_default_traits {
+    using semiring = shortest_path_semiring<_ValueType>;
+};
+
+// Single source shortest paths for arbitrary arc lengths.
+//
+// run() is the queue-based variant (SPFA) : the vertices whose distance
+// decreased wait in a FIFO queue to relax their outgoing arcs.
+// run(parallel_policy) proceeds by rounds : the threads relax the outgoing
+// arcs of their share of the frontier, only reading the distances, and the
+// improvements are then applied to build the next frontier.
+//
+// Every num_vertices relaxations, the predecessor graph is searched for a
+// cycle, which is always negative. Once the distances go below the length of
+// every simple path, which happens if a negative cycle is reachable, the
+// predecessor graph always has a cycle, that is then returned as a witness.
+template <outward_incidence_graph _Graph,
+          input_mapping<arc_t<_Graph>> _LengthMap, bellman_ford_trait _Traits>
+    requires has_vertex_map<_Graph>
+class bellman_ford {
+private:
+    using vertex = vertex_t<_Graph>;
+    using arc = arc_t<_Graph>;
+    using length_type = mapped_value_t<_LengthMap, arc_t<_Graph>>;
+    using semiring = typename _Traits::semiring;
+
+    struct relaxation {
+        vertex pred_vertex;
+        arc pred_arc;
+        vertex head;
+        length_type dist;
+    };
+
+    static constexpr std::size_t grain_size = 256;
+
+    _Graph _graph;
+    _LengthMap _length_map;
+    std::size_t _num_vertices;
+    vertex_map_t<_Graph, length_type> _distances_map;
+    vertex_map_t<_Graph, std::optional<arc>> _pred_arcs_map;
+    [[no_unique_address]] vertex_map_if<!has_arc_source<_Graph>, _Graph,
+                                        vertex> _pred_vertices_map;
+    vertex_map_t<_Graph, bool> _in_queue_map;
+    vertex_map_t<_Graph, std::size_t> _walk_map;
+    std::deque<vertex> _queue;
+    std::vector<arc> _negative_cycle;
+
+public:
+    template <typename _G, typename _M>
+    [[nodiscard]] bellman_ford(_G && g, _M && l)
+        : _graph(views::graph_all(std::forward<_G>(g)))
+        , _length_map(views::mapping_all(std::forward<_M>(l)))
+        , _num_vertices(static_cast<std::size_t>(
+              std::ranges::distance(melon::vertices(_graph))))
+        , _distances_map(
+              create_vertex_map<length_type>(_graph, semiring::infty))
+        , _pred_arcs_map(create_vertex_map<std::optional<arc>>(_graph))
+        , _pred_vertices_map(_graph)
+        , _in_queue_map(create_vertex_map<bool>(_graph, false))
+        , _walk_map(create_vertex_map<std::size_t>(_graph))
+        , _queue()
+        , _negative_cycle() {}
+
+    template <typename _G, typename _M>
+    [[nodiscard]] bellman_ford(_G && g, _M && l, const vertex & s)
+        : bellman_ford(std::forward<_G>(g), std::forward<_M>(l)) {
+        add_source(s);
+    }
+
+    template <typename... _Args>
+    [[nodiscard]] bellman_ford(_Traits, _Args &&... args)
+        : bellman_ford(std::forward<_Args>(args)...) {}
+
+    [[nodiscard]] bellman_ford(const bellman_ford &) = default;
+    [[nodiscard]] bellman_ford(bellman_ford &&) = default;
+
+    bellman_ford & operator=(const bellman_ford &) = default;
+    bellman_ford & operator=(bellman_ford &&) = default;
+
+    bellman_ford & reset() noexcept {
+        _distances_map.fill(semiring::infty);
+        _pred_arcs_map.fill(std::nullopt);
+        for(const vertex & u : _queue) _in_queue_map[u] = false;
+        _queue.clear();
+        _negative_cycle.clear();
+        return *this;
+    }
+    bellman_ford & add_source(
+        const vertex & s, const length_type & dist = semiring::zero) noexcept {
+        if(!semiring::less(dist, _distances_map[s])) return *this;
+        _distances_map[s] = dist;
+        _pred_arcs_map[s].reset();
+        push(s);
+        return *this;
+    }
+
+private:
+    void push(const vertex & u) noexcept {
+        if(_in_queue_map[u]) return;
+        _in_queue_map[u] = true;
+        _queue.push_back(u);
+    }
+    void set_pred(const vertex & u, const arc & a, const vertex & w) noexcept {
+        _pred_arcs_map[w].emplace(a);
+        if constexpr(!has_arc_source<_Graph>) _pred_vertices_map[w] = u;
+    }
+    [[nodiscard]] vertex pred_of(const vertex & u) const noexcept {
+        if constexpr(has_arc_source<_Graph>)
+            return melon::arc_source(_graph, _pred_arcs_map[u].value());
+        else
+            return _pred_vertices_map[u];
+    }
+
+    // Follows the predecessors from every vertex, stopping at the vertices
+    // already walked through, such that it takes O(|V|).
+    bool find_negative_cycle() {
+        _walk_map.fill(0);
+        std::size_t walk = 0;
+        for(auto && v : melon::vertices(_graph)) {
+            if(_walk_map[v] != 0 || !_pred_arcs_map[v].has_value()) continue;
+            ++walk;
+            vertex u = v;
+            while(_walk_map[u] == 0) {
+                _walk_map[u] = walk;
+                if(!_pred_arcs_map[u].has_value()) break;
+                u = pred_of(u);
+            }
+            if(_walk_map[u] != walk || !_pred_arcs_map[u].has_value())
+                continue;
+            const vertex cycle_vertex = u;
+            do {
+                _negative_cycle.push_back(_pred_arcs_map[u].value());
+                u = pred_of(u);
+            } while(u != cycle_vertex);
+            std::ranges::reverse(_negative_cycle);
+            return true;
+        }
+        return false;
+    }
+    void clear_queue() noexcept {
+        for(const vertex & u : _queue) _in_queue_map[u] = false;
+        _queue.clear();
+    }
+
+public:
+    void run() {
+        std::size_t num_relaxations = 0;
+        while(!_queue.empty()) {
+            const vertex u = _queue.front();
+            _queue.pop_front();
+            _in_queue_map[u] = false;
+            const length_type u_dist = _distances_map[u];
+            for(const arc & a : melon::out_arcs(_graph, u)) {
+                const vertex & w = melon::arc_target(_graph, a);
+                const length_type new_dist =
+                    semiring::plus(u_dist, _length_map[a]);
+                if(!semiring::less(new_dist, _distances_map[w])) continue;
+                _distances_map[w] = new_dist;
+                set_pred(u, a, w);
+                push(w);
+                if(++num_relaxations < _num_vertices) continue;
+                num_relaxations = 0;
+                if(find_negative_cycle()) {
+                    clear_queue();
+                    return;
+                }
+            }
+        }
+    }
+
+    void run(const parallel_policy & policy) {
+        const std::size_t num_threads = detail::num_threads(policy);
+        std::vector<std::vector<relaxation>> thread_buffers(num_threads);
+        std::vector<vertex> frontier(_queue.begin(), _queue.end());
+        std::vector<vertex> next_frontier;
+        clear_queue();
+        std::size_t num_relaxations = 0;
+        while(!frontier.empty()) {
+            const std::size_t num_chunks = std::max(
+                std::size_t{1},
+                std::min(num_threads, frontier.size() / grain_size));
+            detail::parallel_for_chunks(
+                num_chunks, frontier.size(),
+                [&](const std::size_t c, std::size_t begin,
+                    const std::size_t end) {
+                    std::vector<relaxation> & buffer = thread_buffers[c];
+                    for(; begin < end; ++begin) {
+                        const vertex & u = frontier[begin];
+                        const length_type u_dist = _distances_map[u];
+                        for(const arc & a : melon::out_arcs(_graph, u)) {
+                            const vertex & w = melon::arc_target(_graph, a);
+                            const length_type new_dist =
+                                semiring::plus(u_dist, _length_map[a]);
+                            if(semiring::less(new_dist, _distances_map[w]))
+                                buffer.push_back({u, a, w, new_dist});
+                        }
+                    }
+                });
+            next_frontier.clear();
+            for(auto & buffer : thread_buffers) {
+                for(auto && [u, a, w, new_dist] : buffer) {
+                    if(!semiring::less(new_dist, _distances_map[w])) continue;
+                    _distances_map[w] = new_dist;
+                    set_pred(u, a, w);
+                    ++num_relaxations;
+                    if(_in_queue_map[w]) continue;
+                    _in_queue_map[w] = true;
+                    next_frontier.push_back(w);
+                }
+                buffer.clear();
+            }
+            for(const vertex & w : next_frontier) _in_queue_map[w] = false;
+            std::swap(frontier, next_frontier);
+            if(num_relaxations < _num_vertices) continue;
+            num_relaxations = 0;
+            if(find_negative_cycle()) return;
+        }
+    }
+
+    [[nodiscard]] bool has_negative_cycle() const noexcept {
+        return !_negative_cycle.empty();
+    }
+    // Arcs of the negative cycle found, in path order.
+    [[nodiscard]] std::span<const arc> negative_cycle() const noexcept {
+        return _negative_cycle;
+    }
+
+    [[nodiscard]] bool reached(const vertex & u) const noexcept {
+        return _distances_map[u] != semiring::infty;
+    }
+    [[nodiscard]] length_type dist(const vertex & u) const noexcept {
+        assert(reached(u) && !has_negative_cycle());
+        return _distances_map[u];
+    }
+    [[nodiscard]] const auto & distances_map() const noexcept {
+        return _distances_map;
+    }
+    [[nodiscard]] arc pred_arc(const vertex & u) const noexcept {
+        assert(reached(u));
+        return _pred_arcs_map[u].value();
+    }
+    [[nodiscard]] vertex pred_vertex(const vertex & u) const noexcept {
+        assert(reached(u) && _pred_arcs_map[u].has_value());
+        return pred_of(u);
+    }
+    [[nodiscard]] auto path_to(const vertex & t) const noexcept {
+        assert(reached(t) && !has_negative_cycle());
+        return intrusive_view(
+            static_cast<vertex>(t),
+            [this](const vertex & v) -> arc {
+                return _pred_arcs_map[v].value();
+            },
+            [this](const vertex & v) -> vertex { return pred_of(v); },
+            [this](const vertex & v) -> bool {
+                return _pred_arcs_map[v].has_value();
+            });
+    }
+};
+
+template <typename _Graph, typename _LengthMap,
+          typename _Traits = bellman_ford_default_traits<
+              _Graph, mapped_value_t<_LengthMap, arc_t<_Graph>>>>
+bellman_ford(_Graph &&, _LengthMap &&)
+    -> bellman_ford<views::graph_all_t<_Graph>,
+                    views::mapping_all_t<_LengthMap>, _Traits>;
+
+template <typename _Graph, typename _LengthMap,
+          typename _Traits = bellman_ford_default_traits<
+              _Graph, mapped_value_t<_LengthMap, arc_t<_Graph>>>>
+bellman_ford(_Graph &&, _LengthMap &&, const vertex_t<_Graph> &)
+    -> bellman_ford<views::graph_all_t<_Graph>,
+                    views::mapping_all_t<_LengthMap>, _Traits>;
+
+template <typename _Graph, typename _LengthMap, typename _Traits>
+bellman_ford(_Traits, _Graph &&, _LengthMap &&)
+    -> bellman_ford<views::graph_all_t<_Graph>,
+                    views::mapping_all_t<_LengthMap>, _Traits>;
+
+template <typename _Graph, typename _LengthMap, typename _Traits>
+bellman_ford(_Traits, _Graph &&, _LengthMap &&, const vertex_t<_Graph> &)
+    -> bellman_ford<views::graph_all_t<_Graph>,
+                    views::mapping_all_t<_LengthMap>, _Traits>;
+
+// Johnson potentials p, such that the reduced lengths l(u,v) + p(u) - p(v)
+// are non-negative, given by the distances from a virtual source linked to
+// every vertex by a zero length arc, or std::nullopt if there is a negative
+// cycle.
+template <outward_incidence_graph _Graph,
+          input_mapping<arc_t<_Graph>> _LengthMap>
+    requires has_vertex_map<_Graph>
+[[nodiscard]] std::optional<
+    vertex_map_t<_Graph, mapped_value_t<_LengthMap, arc_t<_Graph>>>>
+johnson_potentials(const _Graph & g, const _LengthMap & l,
+                   const parallel_policy & policy = {1}) {
+    using length_type = mapped_value_t<_LengthMap, arc_t<_Graph>>;
+    bellman_ford alg(g, l);
+    for(auto && u : melon::vertices(g))
+        alg.add_source(u, shortest_path_semiring<length_type>::zero);
+    if(policy.num_threads == 1)
+        alg.run();
+    else
+        alg.run(policy);
+    if(alg.has_negative_cycle()) return std::nullopt;
+    vertex_map_t<_Graph, length_type> potentials =
+        create_vertex_map<length_type>(g);
+    for(auto && u : melon::vertices(g)) potentials[u] = alg.dist(u);
+    return potentials;
+}
+
+// Reduced lengths l(u,v) + p(u) - p(v) as a views::map, to run dijkstra on
+// Johnson potentials : then dist(s,t) = reduced_dist(s,t) - p(s) + p(t).
+// The graph, the lengths and the potentials are referenced if lvalues.
+template <typename _Graph, typename _LengthMap, typename _PotentialMap>
+    requires has_arc_source<views::graph_all_t<_Graph>>
+[[nodiscard]] constexpr auto johnson_reduced_length_map(_Graph && g,
+                                                        _LengthMap && l,
+                                                        _PotentialMap && p) {
+    return views::map(
+        [g = views::graph_all(std::forward<_Graph>(g)),
+         l = views::mapping_all(std::forward<_LengthMap>(l)),
+         p = views::mapping_all(std::forward<_PotentialMap>(p))](
+            const arc_t<views::graph_all_t<_Graph>> & a) {
+            return l[a] + p[melon::arc_source(g, a)] -
+                   p[melon::arc_target(g, a)];
+        });
+}
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_BELLMAN_FORD_HPP
@@ -13,7 +13,9 @@
 
 #include <range/v3/view/concat.hpp>
 
+#include "melon/container/bucket_queue.hpp"
 #include "melon/container/d_ary_heap.hpp"
+#include "melon/container/radix_heap.hpp"
 #include "melon/detail/intrusive_view.hpp"
 #include "melon/detail/map_if.hpp"
 #include "melon/detail/prefetch.hpp"
@@ -45,6 +47,27 @@ struct bidirectional_dijkstra_default_traits {
     static constexpr bool store_path = true;
 };
 
+// Monotone queues for non-negative integer lengths.
+template <typename _Graph, typename _ValueType>
+struct bidirectional_dijkstra_radix_heap_traits
+    : public bidirectional_dijkstra_default_traits<_Graph, _ValueType> {
+    using semiring = shortest_path_semiring<_ValueType>;
+    using heap = radix_heap<std::pair<vertex_t<_Graph>, _ValueType>,
+                            typename semiring::less_t,
+                            vertex_map_t<_Graph, std::size_t>,
+                            views::get_map<1>, views::get_map<0>>;
+};
+
+template <typename _Graph, typename _ValueType>
+struct bidirectional_dijkstra_bucket_queue_traits
+    : public bidirectional_dijkstra_default_traits<_Graph, _ValueType> {
+    using semiring = shortest_path_semiring<_ValueType>;
+    using heap = bucket_queue<std::pair<vertex_t<_Graph>, _ValueType>,
+                              typename semiring::less_t,
+                              vertex_map_t<_Graph, std::size_t>,
+                              views::get_map<1>, views::get_map<0>>;
+};
+
 template <outward_incidence_graph _Graph,
           input_mapping<arc_t<_Graph>> _LengthMap,
           bidirectional_dijkstra_trait _Traits>
@@ -112,6 +135,10 @@ public:
         add_target(t);
     }
 
+    template <typename... _Args>
+    [[nodiscard]] constexpr bidirectional_dijkstra(_Traits, _Args &&... args)
+        : bidirectional_dijkstra(std::forward<_Args>(args)...) {}
+
     bidirectional_dijkstra & reset() noexcept {
         _forward_heap.clear();
         _reverse_heap.clear();
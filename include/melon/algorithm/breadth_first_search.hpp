@@ -9,7 +9,9 @@
 #include <variant>
 #include <vector>
 
+#include "melon/container/timestamped_map.hpp"
 #include "melon/detail/map_if.hpp"
+#include "melon/detail/traits_vertex_map.hpp"
 #include "melon/graph.hpp"
 #include "melon/utility/algorithmic_generator.hpp"
 
@@ -22,6 +24,14 @@ struct breadth_first_search_default_traits {
     static constexpr bool store_distances = false;
 };
 
+// Timestamped reached map, such that reset costs O(1) instead of O(|V|).
+template <typename _Graph>
+struct breadth_first_search_timestamped_traits
+    : public breadth_first_search_default_traits {
+    template <typename _V>
+    using vertex_map = timestamped_map<vertex_t<_Graph>, _V>;
+};
+
 template <outward_adjacency_graph _Graph,
           typename _Traits = breadth_first_search_default_traits>
     requires has_vertex_map<_Graph>
@@ -41,7 +51,7 @@ private:
     _Graph _graph;
     std::vector<vertex> _queue;
     cursor _queue_current;
-    vertex_map_t<_Graph, bool> _reached_map;
+    traits_vertex_map_t<_Traits, _Graph, bool> _reached_map;
 
     [[no_unique_address]] vertex_map_if<_Traits::store_pred_vertices, _Graph,
                                         vertex> _pred_vertices_map;
@@ -55,7 +65,7 @@ public:
     [[nodiscard]] constexpr explicit breadth_first_search(_G && g)
         : _graph(views::graph_all(std::forward<_G>(g)))
         , _queue()
-        , _reached_map(create_vertex_map<bool>(_graph, false))
+        , _reached_map(create_traits_vertex_map<_Traits, bool>(_graph, false))
         , _pred_vertices_map(_graph)
         , _pred_arcs_map(_graph)
         , _dist_map(_graph) {
@@ -73,6 +83,10 @@ public:
         add_source(s);
     }
 
+    template <typename... _Args>
+    [[nodiscard]] constexpr breadth_first_search(_Traits, _Args &&... args)
+        : breadth_first_search(std::forward<_Args>(args)...) {}
+
     [[nodiscard]] constexpr breadth_first_search(const breadth_first_search &) =
         default;
     [[nodiscard]] constexpr breadth_first_search(breadth_first_search &&) =
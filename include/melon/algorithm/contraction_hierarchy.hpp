@@ -0,0 +1,591 @@
+#ifndef MELON_ALGORITHM_CONTRACTION_HIERARCHY_HPP
+#define MELON_ALGORITHM_CONTRACTION_HIERARCHY_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include "melon/container/d_ary_heap.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/container/static_map.hpp"
+#include "melon/detail/prefetch.hpp"
+#include "melon/graph.hpp"
+#include "melon/mapping.hpp"
+#include "melon/utility/semiring.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+namespace __contraction_hierarchy {
+// Remaining graph during the contraction, with the hierarchy arcs created so
+// far. A hierarchy arc is either an original arc, or a shortcut made of the
+// two hierarchy arcs (u,v) and (v,w) through the contracted vertex v.
+template <typename L, typename V, typename A>
+class contractor {
+public:
+    using semiring = shortest_path_semiring<L>;
+    static constexpr A no_arc = std::numeric_limits<A>::max();
+
+    struct edge {
+        V other;
+        L length;
+        A id;
+    };
+    struct hierarchy_arc {
+        A first;
+        A second;  // no_arc if first is an original arc
+    };
+
+    std::vector<std::vector<edge>> out_edges;
+    std::vector<std::vector<edge>> in_edges;
+    std::vector<hierarchy_arc> hierarchy_arcs;
+    std::vector<std::size_t> num_contracted_neighbors;
+
+private:
+    enum vertex_status : char { PRE_HEAP = 0, IN_HEAP = 1, POST_HEAP = 2 };
+    using witness_heap =
+        updatable_d_ary_heap<2, std::pair<V, L>, typename semiring::less_t,
+                             static_map<V, std::size_t>, views::get_map<1>,
+                             views::get_map<0>>;
+
+    std::size_t _max_settled;
+    witness_heap _heap;
+    static_map<V, vertex_status> _status;
+    static_map<V, L> _dist;
+    std::vector<V> _touched;
+    static_map<V, bool> _is_target;
+
+public:
+    contractor(const std::size_t n, const std::size_t max_settled)
+        : out_edges(n)
+        , in_edges(n)
+        , num_contracted_neighbors(n, 0)
+        , _max_settled(max_settled)
+        , _heap(typename semiring::less_t(), static_map<V, std::size_t>(n))
+        , _status(n, PRE_HEAP)
+        , _dist(n)
+        , _is_target(n, false) {}
+
+    // Adds the arc (u,v) unless a parallel arc is at least as short.
+    void add_arc(const V u, const V v, const L length, const A first,
+                 const A second) {
+        if(u == v) return;
+        for(edge & e : out_edges[u]) {
+            if(e.other != v) continue;
+            if(!semiring::less(length, e.length)) return;
+            e.length = length;
+            e.id = static_cast<A>(hierarchy_arcs.size());
+            for(edge & f : in_edges[v]) {
+                if(f.other != u) continue;
+                f.length = length;
+                f.id = e.id;
+                break;
+            }
+            hierarchy_arcs.push_back({first, second});
+            return;
+        }
+        const A id = static_cast<A>(hierarchy_arcs.size());
+        hierarchy_arcs.push_back({first, second});
+        out_edges[u].push_back({v, length, id});
+        in_edges[v].push_back({u, length, id});
+    }
+
+private:
+    // Dijkstra from s in the remaining graph minus v, that stops after
+    // settling the num_targets out-neighbors of v, _max_settled vertices or a
+    // vertex farther than bound.
+    void witness_search(const V s, const V v, const L bound,
+                        std::size_t num_targets) {
+        for(const V u : _touched) _status[u] = PRE_HEAP;
+        _touched.clear();
+        _heap.clear();
+        _heap.push(std::make_pair(s, semiring::zero));
+        _status[s] = IN_HEAP;
+        _dist[s] = semiring::zero;
+        _touched.push_back(s);
+        for(std::size_t num_settled = 0;
+            !_heap.empty() && num_settled < _max_settled; ++num_settled) {
+            const auto [u, u_dist] = _heap.top();
+            if(semiring::less(bound, u_dist)) break;
+            _heap.pop();
+            _status[u] = POST_HEAP;
+            if(_is_target[u] && --num_targets == 0) break;
+            for(const edge & e : out_edges[u]) {
+                if(e.other == v) continue;
+                const L new_dist = semiring::plus(u_dist, e.length);
+                if(_status[e.other] == PRE_HEAP) {
+                    _heap.push(std::make_pair(e.other, new_dist));
+                    _status[e.other] = IN_HEAP;
+                    _dist[e.other] = new_dist;
+                    _touched.push_back(e.other);
+                } else if(_status[e.other] == IN_HEAP &&
+                          semiring::less(new_dist, _dist[e.other])) {
+                    _heap.promote(e.other, new_dist);
+                    _dist[e.other] = new_dist;
+                }
+            }
+        }
+    }
+
+public:
+    // Number of shortcuts needed to contract v, that are added if add is
+    // true. A shortcut (u,w) is not needed if the witness search from u finds
+    // a path avoiding v that is not longer.
+    std::size_t contract(const V v, const bool add) {
+        std::size_t num_shortcuts = 0;
+        for(const edge & vw : out_edges[v]) _is_target[vw.other] = true;
+        for(std::size_t i = 0; i < in_edges[v].size(); ++i) {
+            const edge uv = in_edges[v][i];
+            L bound = semiring::zero;
+            bool has_target = false;
+            for(const edge & vw : out_edges[v]) {
+                if(vw.other == uv.other) continue;
+                bound = std::max(bound, semiring::plus(uv.length, vw.length));
+                has_target = true;
+            }
+            if(!has_target) continue;
+            witness_search(uv.other, v, bound, out_edges[v].size());
+            for(std::size_t j = 0; j < out_edges[v].size(); ++j) {
+                const edge vw = out_edges[v][j];
+                if(vw.other == uv.other) continue;
+                const L length = semiring::plus(uv.length, vw.length);
+                if(_status[vw.other] != PRE_HEAP &&
+                   !semiring::less(length, _dist[vw.other]))
+                    continue;
+                ++num_shortcuts;
+                if(add) add_arc(uv.other, vw.other, length, uv.id, vw.id);
+            }
+        }
+        for(const edge & vw : out_edges[v]) _is_target[vw.other] = false;
+        return num_shortcuts;
+    }
+
+    // Edge difference plus the number of contracted neighbors, which spreads
+    // the contraction uniformly over the graph.
+    std::ptrdiff_t priority(const V v) {
+        return static_cast<std::ptrdiff_t>(contract(v, false)) -
+               static_cast<std::ptrdiff_t>(in_edges[v].size() +
+                                           out_edges[v].size()) +
+               static_cast<std::ptrdiff_t>(num_contracted_neighbors[v]);
+    }
+
+    // Removes v from the remaining graph.
+    void remove_vertex(const V v) {
+        const auto erase_from = [v](std::vector<edge> & edges) {
+            std::erase_if(edges, [v](const edge & e) { return e.other == v; });
+        };
+        for(const edge & e : out_edges[v]) {
+            erase_from(in_edges[e.other]);
+            ++num_contracted_neighbors[e.other];
+        }
+        for(const edge & e : in_edges[v]) {
+            erase_from(out_edges[e.other]);
+            ++num_contracted_neighbors[e.other];
+        }
+        out_edges[v] = {};
+        in_edges[v] = {};
+    }
+};
+}  // namespace __contraction_hierarchy
+
+// Contraction Hierarchy of a digraph with non-negative arc lengths.
+//
+// The vertices are contracted by increasing edge difference, replacing the
+// paths (u,v,w) through the contracted vertex v by shortcuts (u,w) unless a
+// bounded witness search finds a path that is not longer. The rank of a vertex
+// is its position in the contraction order. The upward graph contains the
+// hierarchy arcs (u,v) with rank(u) < rank(v) and the downward graph contains
+// the reverses (v,u) of the hierarchy arcs (u,v) with rank(u) > rank(v), such
+// that both searches of a query only follow out arcs toward higher ranks.
+//
+// The vertices of the original graph are assumed to be the integers of [0,n)
+// and its arcs to be integers fitting in A.
+template <typename _LengthType, std::unsigned_integral V = unsigned int,
+          std::unsigned_integral A = unsigned int>
+class basic_contraction_hierarchy {
+public:
+    using vertex = V;
+    using arc = A;
+    using length_type = _LengthType;
+    using graph_type = basic_static_digraph<V, A>;
+
+private:
+    using contractor = __contraction_hierarchy::contractor<length_type, V, A>;
+    using hierarchy_arc = typename contractor::hierarchy_arc;
+    static constexpr arc no_arc = contractor::no_arc;
+
+    static_map<vertex, vertex> _ranks;
+    graph_type _upward_graph;
+    static_map<arc, length_type> _upward_lengths;
+    static_map<arc, arc> _upward_hierarchy_arcs;
+    graph_type _downward_graph;
+    static_map<arc, length_type> _downward_lengths;
+    static_map<arc, arc> _downward_hierarchy_arcs;
+    std::vector<hierarchy_arc> _hierarchy_arcs;
+
+public:
+    [[nodiscard]] basic_contraction_hierarchy() = default;
+
+    template <graph _G, input_mapping<arc_t<_G>> _LengthMap>
+        requires has_arc_source<_G> && has_arc_target<_G> &&
+                 has_num_vertices<_G>
+    [[nodiscard]] basic_contraction_hierarchy(
+        const _G & g, const _LengthMap & length_map,
+        const std::size_t max_witness_settled = 256) {
+        using priority_heap = updatable_d_ary_heap<
+            2, std::pair<vertex, std::ptrdiff_t>, std::less<std::ptrdiff_t>,
+            static_map<vertex, std::size_t>, views::get_map<1>,
+            views::get_map<0>>;
+
+        const std::size_t n = melon::num_vertices(g);
+        assert(n <= std::numeric_limits<vertex>::max());
+        contractor c(n, max_witness_settled);
+        for(auto && a : arcs(g)) {
+            assert(static_cast<std::size_t>(a) < no_arc);
+            c.add_arc(static_cast<vertex>(arc_source(g, a)),
+                      static_cast<vertex>(arc_target(g, a)),
+                      static_cast<length_type>(length_map[a]),
+                      static_cast<arc>(a), no_arc);
+        }
+
+        priority_heap heap(std::less<std::ptrdiff_t>{},
+                           static_map<vertex, std::size_t>(n));
+        for(std::size_t i = 0; i < n; ++i) {
+            const auto v = static_cast<vertex>(i);
+            heap.push(std::make_pair(v, c.priority(v)));
+        }
+
+        _ranks = static_map<vertex, vertex>(n);
+        static_digraph_builder<graph_type, length_type, arc> upward_builder(n);
+        static_digraph_builder<graph_type, length_type, arc> downward_builder(
+            n);
+        std::vector<vertex> neighbors;
+        for(vertex rank = 0; !heap.empty(); ++rank) {
+            const vertex v = heap.top().first;
+            heap.pop();
+            _ranks[v] = rank;
+            c.contract(v, true);
+            neighbors.clear();
+            for(auto && e : c.out_edges[v]) {
+                upward_builder.add_arc(v, e.other, e.length, e.id);
+                neighbors.push_back(e.other);
+            }
+            for(auto && e : c.in_edges[v]) {
+                downward_builder.add_arc(v, e.other, e.length, e.id);
+                neighbors.push_back(e.other);
+            }
+            c.remove_vertex(v);
+            std::ranges::sort(neighbors);
+            const auto duplicates = std::ranges::unique(neighbors);
+            neighbors.erase(duplicates.begin(), duplicates.end());
+            for(const vertex u : neighbors) {
+                const std::ptrdiff_t old_priority = heap.priority(u);
+                const std::ptrdiff_t new_priority = c.priority(u);
+                if(new_priority < old_priority)
+                    heap.promote(u, new_priority);
+                else if(old_priority < new_priority)
+                    heap.demote(u, new_priority);
+            }
+        }
+
+        auto [upward_graph, upward_lengths, upward_hierarchy_arcs] =
+            upward_builder.build();
+        auto [downward_graph, downward_lengths, downward_hierarchy_arcs] =
+            downward_builder.build();
+        _upward_graph = std::move(upward_graph);
+        _upward_lengths = static_map<arc, length_type>(upward_lengths);
+        _upward_hierarchy_arcs = static_map<arc, arc>(upward_hierarchy_arcs);
+        _downward_graph = std::move(downward_graph);
+        _downward_lengths = static_map<arc, length_type>(downward_lengths);
+        _downward_hierarchy_arcs =
+            static_map<arc, arc>(downward_hierarchy_arcs);
+        _hierarchy_arcs = std::move(c.hierarchy_arcs);
+    }
+
+    [[nodiscard]] basic_contraction_hierarchy(
+        const basic_contraction_hierarchy &) = default;
+    [[nodiscard]] basic_contraction_hierarchy(basic_contraction_hierarchy &&) =
+        default;
+    basic_contraction_hierarchy & operator=(
+        const basic_contraction_hierarchy &) = default;
+    basic_contraction_hierarchy & operator=(basic_contraction_hierarchy &&) =
+        default;
+
+    [[nodiscard]] constexpr std::size_t num_vertices() const noexcept {
+        return _ranks.size();
+    }
+    [[nodiscard]] constexpr vertex rank(const vertex v) const noexcept {
+        return _ranks[v];
+    }
+    [[nodiscard]] constexpr const auto & ranks_map() const noexcept {
+        return _ranks;
+    }
+
+    [[nodiscard]] constexpr const graph_type & upward_graph() const noexcept {
+        return _upward_graph;
+    }
+    [[nodiscard]] constexpr const auto & upward_lengths_map() const noexcept {
+        return _upward_lengths;
+    }
+    [[nodiscard]] constexpr const graph_type & downward_graph() const noexcept {
+        return _downward_graph;
+    }
+    [[nodiscard]] constexpr const auto & downward_lengths_map()
+        const noexcept {
+        return _downward_lengths;
+    }
+
+    // Number of hierarchy arcs that are not original arcs.
+    [[nodiscard]] constexpr std::size_t num_shortcuts() const noexcept {
+        const auto is_shortcut = [this](const arc h) {
+            return _hierarchy_arcs[h].second != no_arc;
+        };
+        return static_cast<std::size_t>(
+            std::ranges::count_if(_upward_hierarchy_arcs, is_shortcut) +
+            std::ranges::count_if(_downward_hierarchy_arcs, is_shortcut));
+    }
+
+private:
+    template <typename _F>
+    constexpr void unpack(const arc hierarchy_arc_id, _F && f) const {
+        std::vector<arc> stack{hierarchy_arc_id};
+        while(!stack.empty()) {
+            const hierarchy_arc h = _hierarchy_arcs[stack.back()];
+            stack.pop_back();
+            if(h.second == no_arc) {
+                f(h.first);
+                continue;
+            }
+            stack.push_back(h.second);
+            stack.push_back(h.first);
+        }
+    }
+
+public:
+    // Calls f on the original arcs of the path represented by the arc a of
+    // the upward graph, in path order.
+    template <typename _F>
+    constexpr void unpack_upward_arc(const arc a, _F && f) const {
+        unpack(_upward_hierarchy_arcs[a], f);
+    }
+    // Calls f on the original arcs of the path represented by the reverse of
+    // the arc a of the downward graph, in path order.
+    template <typename _F>
+    constexpr void unpack_downward_arc(const arc a, _F && f) const {
+        unpack(_downward_hierarchy_arcs[a], f);
+    }
+};
+
+template <typename _LengthType>
+using contraction_hierarchy = basic_contraction_hierarchy<_LengthType>;
+
+template <graph _G, typename _LengthMap>
+basic_contraction_hierarchy(const _G &, const _LengthMap &)
+    -> basic_contraction_hierarchy<mapped_value_t<_LengthMap, arc_t<_G>>>;
+template <graph _G, typename _LengthMap>
+basic_contraction_hierarchy(const _G &, const _LengthMap &, std::size_t)
+    -> basic_contraction_hierarchy<mapped_value_t<_LengthMap, arc_t<_G>>>;
+
+// Point to point query on a contraction hierarchy : two Dijkstra searches
+// from the source in the upward graph and from the target in the downward
+// graph, that only explore the vertices of higher ranks, with stall on demand.
+// Resetting the query only costs the number of vertices reached by the
+// previous one.
+template <typename _Hierarchy>
+class contraction_hierarchy_query {
+private:
+    using vertex = typename _Hierarchy::vertex;
+    using arc = typename _Hierarchy::arc;
+    using length_type = typename _Hierarchy::length_type;
+    using semiring = shortest_path_semiring<length_type>;
+    using heap =
+        updatable_d_ary_heap<2, std::pair<vertex, length_type>,
+                             typename semiring::less_t,
+                             static_map<vertex, std::size_t>,
+                             views::get_map<1>, views::get_map<0>>;
+    enum vertex_status : char { PRE_HEAP = 0, IN_HEAP = 1, POST_HEAP = 2 };
+    static constexpr arc no_arc = std::numeric_limits<arc>::max();
+
+    struct direction {
+        heap queue;
+        static_map<vertex, vertex_status> status;
+        static_map<vertex, length_type> dist;
+        static_map<vertex, arc> pred_arc;
+
+        explicit direction(const std::size_t n)
+            : queue(typename semiring::less_t(),
+                    static_map<vertex, std::size_t>(n))
+            , status(n, PRE_HEAP)
+            , dist(n)
+            , pred_arc(n) {}
+    };
+
+    const _Hierarchy * _hierarchy;
+    direction _forward;
+    direction _reverse;
+    std::vector<vertex> _touched;
+    std::optional<vertex> _midpoint;
+
+public:
+    [[nodiscard]] explicit contraction_hierarchy_query(
+        const _Hierarchy & hierarchy)
+        : _hierarchy(std::addressof(hierarchy))
+        , _forward(hierarchy.num_vertices())
+        , _reverse(hierarchy.num_vertices()) {}
+
+    [[nodiscard]] contraction_hierarchy_query(const _Hierarchy & hierarchy,
+                                              const vertex s, const vertex t)
+        : contraction_hierarchy_query(hierarchy) {
+        add_source(s);
+        add_target(t);
+    }
+
+    contraction_hierarchy_query & reset() noexcept {
+        for(const vertex u : _touched) {
+            _forward.status[u] = PRE_HEAP;
+            _reverse.status[u] = PRE_HEAP;
+        }
+        _touched.clear();
+        _forward.queue.clear();
+        _reverse.queue.clear();
+        _midpoint.reset();
+        return *this;
+    }
+
+private:
+    void reach(direction & d, const vertex u, const length_type u_dist,
+               const arc pred) noexcept {
+        if(_forward.status[u] == PRE_HEAP && _reverse.status[u] == PRE_HEAP)
+            _touched.push_back(u);
+        d.queue.push(std::make_pair(u, u_dist));
+        d.status[u] = IN_HEAP;
+        d.dist[u] = u_dist;
+        d.pred_arc[u] = pred;
+    }
+
+public:
+    contraction_hierarchy_query & add_source(
+        const vertex s, const length_type dist = semiring::zero) noexcept {
+        assert(_forward.status[s] == PRE_HEAP);
+        reach(_forward, s, dist, no_arc);
+        return *this;
+    }
+    contraction_hierarchy_query & add_target(
+        const vertex t, const length_type dist = semiring::zero) noexcept {
+        assert(_reverse.status[t] == PRE_HEAP);
+        reach(_reverse, t, dist, no_arc);
+        return *this;
+    }
+
+private:
+    // Settles the top vertex u of the heap of d, unless it is stalled : if
+    // an arc (w,u) of the other graph, coming from a higher ranked vertex w,
+    // shows that u is reached too far, its arcs cannot lead to shortest paths.
+    void settle(direction & d, const direction & other,
+                const typename _Hierarchy::graph_type & g,
+                const auto & length_map,
+                const typename _Hierarchy::graph_type & stall_graph,
+                const auto & stall_length_map,
+                length_type & st_dist) noexcept {
+        const auto [u, u_dist] = d.queue.top();
+        d.queue.pop();
+        d.status[u] = POST_HEAP;
+        if(other.status[u] != PRE_HEAP) {
+            const length_type new_st_dist =
+                semiring::plus(u_dist, other.dist[u]);
+            if(semiring::less(new_st_dist, st_dist)) {
+                st_dist = new_st_dist;
+                _midpoint.emplace(u);
+            }
+        }
+        for(const arc a : out_arcs(stall_graph, u)) {
+            const vertex w = arc_target(stall_graph, a);
+            if(d.status[w] != PRE_HEAP &&
+               semiring::less(semiring::plus(d.dist[w], stall_length_map[a]),
+                              u_dist))
+                return;
+        }
+        const auto & out_arcs_range = out_arcs(g, u);
+        prefetch_range(out_arcs_range);
+        prefetch_mapped_values(out_arcs_range, arc_targets_map(g));
+        prefetch_mapped_values(out_arcs_range, length_map);
+        for(const arc a : out_arcs_range) {
+            const vertex w = arc_target(g, a);
+            const length_type new_w_dist =
+                semiring::plus(u_dist, length_map[a]);
+            if(d.status[w] == PRE_HEAP) {
+                reach(d, w, new_w_dist, a);
+            } else if(d.status[w] == IN_HEAP &&
+                      semiring::less(new_w_dist, d.dist[w])) {
+                d.queue.promote(w, new_w_dist);
+                d.dist[w] = new_w_dist;
+                d.pred_arc[w] = a;
+            }
+        }
+    }
+
+public:
+    // Alternates the two searches until the smallest distance in both heaps
+    // is not smaller than the best path found, that is then the shortest.
+    length_type run() noexcept {
+        length_type st_dist = semiring::infty;
+        for(;;) {
+            const bool forward_empty = _forward.queue.empty();
+            const bool reverse_empty = _reverse.queue.empty();
+            if(forward_empty && reverse_empty) break;
+            const bool forward_step =
+                !forward_empty &&
+                (reverse_empty ||
+                 !semiring::less(_reverse.queue.top().second,
+                                 _forward.queue.top().second));
+            direction & d = forward_step ? _forward : _reverse;
+            if(!semiring::less(d.queue.top().second, st_dist)) break;
+            if(forward_step)
+                settle(_forward, _reverse, _hierarchy->upward_graph(),
+                       _hierarchy->upward_lengths_map(),
+                       _hierarchy->downward_graph(),
+                       _hierarchy->downward_lengths_map(), st_dist);
+            else
+                settle(_reverse, _forward, _hierarchy->downward_graph(),
+                       _hierarchy->downward_lengths_map(),
+                       _hierarchy->upward_graph(),
+                       _hierarchy->upward_lengths_map(), st_dist);
+        }
+        return st_dist;
+    }
+
+    [[nodiscard]] constexpr bool path_found() const noexcept {
+        return _midpoint.has_value();
+    }
+
+    // Original arcs of the shortest path found, from the source to the
+    // target.
+    [[nodiscard]] std::vector<arc> path() const {
+        assert(path_found());
+        std::vector<arc> upward_arcs;
+        for(vertex u = _midpoint.value(); _forward.pred_arc[u] != no_arc;
+            u = arc_source(_hierarchy->upward_graph(), _forward.pred_arc[u]))
+            upward_arcs.push_back(_forward.pred_arc[u]);
+        std::vector<arc> path_arcs;
+        const auto push = [&path_arcs](const arc a) { path_arcs.push_back(a); };
+        for(const arc a : std::views::reverse(upward_arcs))
+            _hierarchy->unpack_upward_arc(a, push);
+        for(vertex u = _midpoint.value(); _reverse.pred_arc[u] != no_arc;
+            u = arc_source(_hierarchy->downward_graph(), _reverse.pred_arc[u]))
+            _hierarchy->unpack_downward_arc(_reverse.pred_arc[u], push);
+        return path_arcs;
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_CONTRACTION_HIERARCHY_HPP
@@ -0,0 +1,635 @@
+#ifndef MELON_ALGORITHM_CUSTOMIZABLE_ROUTE_PLANNING_HPP
+#define MELON_ALGORITHM_CUSTOMIZABLE_ROUTE_PLANNING_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/d_ary_heap.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/container/static_map.hpp"
+#include "melon/detail/parallel.hpp"
+#include "melon/detail/prefetch.hpp"
+#include "melon/graph.hpp"
+#include "melon/mapping.hpp"
+#include "melon/utility/semiring.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+namespace __customizable_route_planning {
+// Groups items into cells by growing breadth first searches in the adjacency
+// given in CSR form, such that the weights of the items of a cell sum to at
+// most max_weight, unless a single item is heavier.
+template <std::unsigned_integral C>
+std::vector<C> grow_cells(const std::vector<std::size_t> & adjacency_begin,
+                          const std::vector<C> & adjacency,
+                          const std::vector<std::size_t> & weights,
+                          const std::size_t max_weight) {
+    static constexpr C no_cell = std::numeric_limits<C>::max();
+    const std::size_t n = weights.size();
+    std::vector<C> cells(n, no_cell);
+    std::vector<C> queue;
+    C num_cells = 0;
+    for(std::size_t root = 0; root < n; ++root) {
+        if(cells[root] != no_cell) continue;
+        std::size_t cell_weight = weights[root];
+        cells[root] = num_cells;
+        queue.assign(1, static_cast<C>(root));
+        for(std::size_t i = 0; i < queue.size(); ++i) {
+            const C u = queue[i];
+            for(std::size_t j = adjacency_begin[u]; j < adjacency_begin[u + 1];
+                ++j) {
+                const C w = adjacency[j];
+                if(cells[w] != no_cell || cell_weight + weights[w] > max_weight)
+                    continue;
+                cell_weight += weights[w];
+                cells[w] = num_cells;
+                queue.push_back(w);
+            }
+        }
+        ++num_cells;
+    }
+    return cells;
+}
+
+// Adjacency, in CSR form, of the undirected graph whose edges are the pairs
+// {u,w} given by the arcs, without loops.
+template <std::unsigned_integral C>
+void undirected_adjacency(const std::size_t n,
+                          const std::vector<std::pair<C, C>> & arcs,
+                          std::vector<std::size_t> & adjacency_begin,
+                          std::vector<C> & adjacency) {
+    adjacency_begin.assign(n + 1, 0);
+    for(auto && [u, w] : arcs) {
+        if(u == w) continue;
+        ++adjacency_begin[u + 1];
+        ++adjacency_begin[w + 1];
+    }
+    for(std::size_t i = 0; i < n; ++i)
+        adjacency_begin[i + 1] += adjacency_begin[i];
+    adjacency.resize(adjacency_begin[n]);
+    std::vector<std::size_t> pos(adjacency_begin.begin(),
+                                 adjacency_begin.end() - 1);
+    for(auto && [u, w] : arcs) {
+        if(u == w) continue;
+        adjacency[pos[u]++] = w;
+        adjacency[pos[w]++] = u;
+    }
+}
+
+// Dijkstra searches inside a cell, over global vertex ids, whose reset only
+// costs the number of vertices reached by the previous search. Each thread of
+// the customization owns one.
+template <typename L, typename V>
+class cell_search {
+public:
+    using semiring = shortest_path_semiring<L>;
+
+private:
+    enum vertex_status : char { PRE_HEAP = 0, IN_HEAP = 1, POST_HEAP = 2 };
+    using heap =
+        updatable_d_ary_heap<2, std::pair<V, L>, typename semiring::less_t,
+                             static_map<V, std::size_t>, views::get_map<1>,
+                             views::get_map<0>>;
+
+    heap _heap;
+    static_map<V, vertex_status> _status;
+    static_map<V, L> _dist;
+    std::vector<V> _touched;
+
+public:
+    explicit cell_search(const std::size_t n)
+        : _heap(typename semiring::less_t(), static_map<V, std::size_t>(n))
+        , _status(n, PRE_HEAP)
+        , _dist(n) {}
+
+    // Runs the search from s, where for_each_out_arc(u, relax) calls
+    // relax(w, length) for every arc (u,w) of the searched graph.
+    template <typename _F>
+    void run(const V s, _F && for_each_out_arc) {
+        for(const V u : _touched) _status[u] = PRE_HEAP;
+        _touched.clear();
+        _heap.clear();
+        _heap.push(std::make_pair(s, semiring::zero));
+        _status[s] = IN_HEAP;
+        _dist[s] = semiring::zero;
+        _touched.push_back(s);
+        while(!_heap.empty()) {
+            const auto [u, u_dist] = _heap.top();
+            _heap.pop();
+            _status[u] = POST_HEAP;
+            for_each_out_arc(u, [&, u_dist = u_dist](const V w, const L l) {
+                const L new_dist = semiring::plus(u_dist, l);
+                if(_status[w] == PRE_HEAP) {
+                    _heap.push(std::make_pair(w, new_dist));
+                    _status[w] = IN_HEAP;
+                    _dist[w] = new_dist;
+                    _touched.push_back(w);
+                } else if(_status[w] == IN_HEAP &&
+                          semiring::less(new_dist, _dist[w])) {
+                    _heap.promote(w, new_dist);
+                    _dist[w] = new_dist;
+                }
+            });
+        }
+    }
+
+    [[nodiscard]] L dist(const V u) const noexcept {
+        return _status[u] == POST_HEAP ? _dist[u] : semiring::infty;
+    }
+};
+}  // namespace __customizable_route_planning
+
+// Customizable Route Planning : a multi-level overlay of a static digraph with
+// non-negative arc lengths, whose preprocessing is split in two phases.
+//
+// The metric independent phase partitions the vertices into nested cells :
+// every cell of a level is a union of cells of the level below, the level 0
+// being the finest. The boundary vertices of a level are the endpoints of the
+// arcs whose endpoints lie in different cells of that level. It only depends
+// on the topology and runs once.
+//
+// The customization computes, for every cell, the clique of the shortest
+// distances inside the cell between its boundary vertices, bottom up : the
+// cliques of a level are computed by searches on the boundary arcs and the
+// cliques of the level below. Cells of a level are customized in parallel,
+// such that new arc lengths are taken into account in a few seconds.
+//
+// The vertices of the graph are assumed to be the integers of [0,n).
+template <typename _LengthType, std::unsigned_integral V = unsigned int,
+          std::unsigned_integral A = unsigned int>
+class basic_customizable_route_planning {
+public:
+    using vertex = V;
+    using arc = A;
+    using cell = V;
+    using length_type = _LengthType;
+    using graph_type = basic_static_digraph<V, A>;
+    using semiring = shortest_path_semiring<length_type>;
+
+private:
+    using cell_search =
+        __customizable_route_planning::cell_search<length_type, vertex>;
+    static constexpr vertex no_index = std::numeric_limits<vertex>::max();
+
+    struct level {
+        static_map<vertex, cell> cells;
+        std::vector<std::size_t> boundary_begin;
+        std::vector<vertex> boundary;
+        static_map<vertex, vertex> boundary_index;
+        std::vector<std::size_t> clique_begin;
+        std::vector<length_type> clique_lengths;
+    };
+
+    graph_type _graph;
+    std::vector<level> _levels;
+    static_map<arc, length_type> _lengths;
+    bool _customized = false;
+
+public:
+    [[nodiscard]] basic_customizable_route_planning() = default;
+
+    // Partitions the vertices by growing cells of at most max_cell_sizes[l]
+    // vertices at level l, each level grouping the cells of the level below.
+    [[nodiscard]] basic_customizable_route_planning(
+        const graph_type & g, const std::vector<std::size_t> & max_cell_sizes)
+        : basic_customizable_route_planning(
+              g, grow_partition(g, max_cell_sizes)) {}
+
+    // Uses the nested partition given by the cells of each vertex, from the
+    // finest level to the coarsest.
+    [[nodiscard]] basic_customizable_route_planning(
+        const graph_type & g, const std::vector<std::vector<cell>> & partition)
+        : _graph(g), _levels(partition.size()) {
+        const std::size_t n = g.num_vertices();
+        for(std::size_t l = 0; l < partition.size(); ++l) {
+            assert(partition[l].size() == n);
+            level & lvl = _levels[l];
+            lvl.cells = static_map<vertex, cell>(partition[l]);
+            const std::size_t num_cells =
+                n == 0 ? 0
+                       : static_cast<std::size_t>(
+                             std::ranges::max(partition[l])) +
+                             1;
+            std::vector<bool> is_boundary(n, false);
+            for(auto && a : g.arcs()) {
+                const vertex u = g.arc_source(a);
+                const vertex w = g.arc_target(a);
+                if(lvl.cells[u] == lvl.cells[w]) continue;
+                assert(l == 0 || _levels[l - 1].cells[u] !=
+                                     _levels[l - 1].cells[w]);
+                is_boundary[u] = is_boundary[w] = true;
+            }
+            lvl.boundary_begin.assign(num_cells + 1, 0);
+            for(auto && u : g.vertices())
+                if(is_boundary[u]) ++lvl.boundary_begin[lvl.cells[u] + 1];
+            for(std::size_t c = 0; c < num_cells; ++c)
+                lvl.boundary_begin[c + 1] += lvl.boundary_begin[c];
+            lvl.boundary.resize(lvl.boundary_begin[num_cells]);
+            lvl.boundary_index = static_map<vertex, vertex>(n, no_index);
+            std::vector<std::size_t> pos(lvl.boundary_begin.begin(),
+                                         lvl.boundary_begin.end() - 1);
+            for(auto && u : g.vertices()) {
+                if(!is_boundary[u]) continue;
+                const cell c = lvl.cells[u];
+                lvl.boundary_index[u] =
+                    static_cast<vertex>(pos[c] - lvl.boundary_begin[c]);
+                lvl.boundary[pos[c]++] = u;
+            }
+            lvl.clique_begin.assign(num_cells + 1, 0);
+            for(std::size_t c = 0; c < num_cells; ++c) {
+                const std::size_t b =
+                    lvl.boundary_begin[c + 1] - lvl.boundary_begin[c];
+                lvl.clique_begin[c + 1] = lvl.clique_begin[c] + b * b;
+            }
+            lvl.clique_lengths.assign(lvl.clique_begin[num_cells],
+                                      semiring::infty);
+        }
+    }
+
+    [[nodiscard]] basic_customizable_route_planning(
+        const basic_customizable_route_planning &) = default;
+    [[nodiscard]] basic_customizable_route_planning(
+        basic_customizable_route_planning &&) = default;
+    basic_customizable_route_planning & operator=(
+        const basic_customizable_route_planning &) = default;
+    basic_customizable_route_planning & operator=(
+        basic_customizable_route_planning &&) = default;
+
+private:
+    static std::vector<std::vector<cell>> grow_partition(
+        const graph_type & g, const std::vector<std::size_t> & max_cell_sizes) {
+        const std::size_t n = g.num_vertices();
+        std::vector<std::vector<cell>> partition;
+        std::vector<std::pair<cell, cell>> arcs;
+        arcs.reserve(g.num_arcs());
+        for(auto && a : g.arcs())
+            arcs.emplace_back(g.arc_source(a), g.arc_target(a));
+        std::vector<std::size_t> weights(n, 1);
+        std::vector<std::size_t> adjacency_begin;
+        std::vector<cell> adjacency;
+        for(const std::size_t max_cell_size : max_cell_sizes) {
+            __customizable_route_planning::undirected_adjacency(
+                weights.size(), arcs, adjacency_begin, adjacency);
+            const std::vector<cell> item_cells =
+                __customizable_route_planning::grow_cells(
+                    adjacency_begin, adjacency, weights, max_cell_size);
+            std::vector<cell> cells(n);
+            for(std::size_t u = 0; u < n; ++u)
+                cells[u] = item_cells[partition.empty()
+                                          ? u
+                                          : partition.back()[u]];
+            const std::size_t num_cells =
+                n == 0 ? 0
+                       : static_cast<std::size_t>(
+                             std::ranges::max(item_cells)) +
+                             1;
+            std::vector<std::size_t> cell_weights(num_cells, 0);
+            for(std::size_t i = 0; i < item_cells.size(); ++i)
+                cell_weights[item_cells[i]] += weights[i];
+            for(auto && [u, w] : arcs) {
+                u = item_cells[u];
+                w = item_cells[w];
+            }
+            std::erase_if(arcs, [](auto && p) { return p.first == p.second; });
+            std::ranges::sort(arcs);
+            const auto duplicates = std::ranges::unique(arcs);
+            arcs.erase(duplicates.begin(), duplicates.end());
+            weights = std::move(cell_weights);
+            partition.push_back(std::move(cells));
+        }
+        return partition;
+    }
+
+    // Calls relax(w, length) for the arcs leaving the boundary vertex u of a
+    // cell of level l : the clique arcs of its cell and the original arcs
+    // leaving its cell, and only those staying in the cell containing it at
+    // the level l+1 if restrict_to_parent is true.
+    template <bool restrict_to_parent, typename _F>
+    void for_each_overlay_arc(const std::size_t l, const vertex u,
+                              _F && relax) const {
+        const level & lvl = _levels[l];
+        const cell c = lvl.cells[u];
+        const std::size_t b = lvl.boundary_begin[c + 1] - lvl.boundary_begin[c];
+        const std::size_t row =
+            lvl.clique_begin[c] + lvl.boundary_index[u] * b;
+        for(std::size_t j = 0; j < b; ++j) {
+            const length_type length = lvl.clique_lengths[row + j];
+            if(length == semiring::infty) continue;
+            relax(lvl.boundary[lvl.boundary_begin[c] + j], length);
+        }
+        for(auto && a : _graph.out_arcs(u)) {
+            const vertex w = _graph.arc_target(a);
+            if(lvl.cells[w] == c) continue;
+            if constexpr(restrict_to_parent)
+                if(_levels[l + 1].cells[w] != _levels[l + 1].cells[u]) continue;
+            relax(w, _lengths[a]);
+        }
+    }
+
+    void customize_cell(cell_search & search, const std::size_t l,
+                        const cell c) {
+        level & lvl = _levels[l];
+        const std::size_t first = lvl.boundary_begin[c];
+        const std::size_t b = lvl.boundary_begin[c + 1] - first;
+        for(std::size_t i = 0; i < b; ++i) {
+            if(l == 0) {
+                search.run(lvl.boundary[first + i],
+                           [&](const vertex u, auto && relax) {
+                               for(auto && a : _graph.out_arcs(u)) {
+                                   const vertex w = _graph.arc_target(a);
+                                   if(lvl.cells[w] == c)
+                                       relax(w, _lengths[a]);
+                               }
+                           });
+            } else {
+                search.run(lvl.boundary[first + i],
+                           [&](const vertex u, auto && relax) {
+                               for_each_overlay_arc<true>(l - 1, u, relax);
+                           });
+            }
+            for(std::size_t j = 0; j < b; ++j)
+                lvl.clique_lengths[lvl.clique_begin[c] + i * b + j] =
+                    search.dist(lvl.boundary[first + j]);
+        }
+    }
+
+public:
+    // Recomputes the cliques of every cell for the given arc lengths, the
+    // cells of a level being processed by the policy threads.
+    template <input_mapping<arc> _LengthMap>
+    void customize(const parallel_policy & policy,
+                   const _LengthMap & length_map) {
+        const std::size_t num_threads = detail::num_threads(policy);
+        _lengths = _graph.template create_arc_map<length_type>();
+        for(auto && a : _graph.arcs())
+            _lengths[a] = static_cast<length_type>(length_map[a]);
+        for(std::size_t l = 0; l < _levels.size(); ++l) {
+            const std::size_t n_cells = num_cells(l);
+            detail::parallel_for_chunks(
+                std::max(std::size_t{1}, std::min(num_threads, n_cells)),
+                n_cells,
+                [&, l](std::size_t, std::size_t begin, const std::size_t end) {
+                    cell_search search(_graph.num_vertices());
+                    for(; begin < end; ++begin)
+                        customize_cell(search, l, static_cast<cell>(begin));
+                });
+        }
+        _customized = true;
+    }
+    template <input_mapping<arc> _LengthMap>
+    void customize(const _LengthMap & length_map) {
+        customize(parallel_policy{1}, length_map);
+    }
+
+    [[nodiscard]] constexpr bool customized() const noexcept {
+        return _customized;
+    }
+    [[nodiscard]] constexpr const graph_type & graph() const noexcept {
+        return _graph;
+    }
+    [[nodiscard]] constexpr const auto & lengths_map() const noexcept {
+        return _lengths;
+    }
+    [[nodiscard]] constexpr std::size_t num_vertices() const noexcept {
+        return _graph.num_vertices();
+    }
+    [[nodiscard]] constexpr std::size_t num_levels() const noexcept {
+        return _levels.size();
+    }
+    [[nodiscard]] constexpr std::size_t num_cells(
+        const std::size_t l) const noexcept {
+        return _levels[l].boundary_begin.size() - 1;
+    }
+    [[nodiscard]] constexpr cell cell_of(const std::size_t l,
+                                         const vertex u) const noexcept {
+        return _levels[l].cells[u];
+    }
+    [[nodiscard]] constexpr std::size_t num_boundary_vertices(
+        const std::size_t l) const noexcept {
+        return _levels[l].boundary.size();
+    }
+
+    // Calls relax(w, length) for the arcs (u,w) of the overlay searched from
+    // the vertex u at query level q : the original arcs if q = 0 and the
+    // clique arcs of the cell of level q-1 containing u plus the original arcs
+    // leaving this cell otherwise.
+    template <typename _F>
+    void for_each_out_arc(const std::size_t q, const vertex u,
+                          _F && relax) const {
+        if(q == 0) {
+            for(auto && a : _graph.out_arcs(u))
+                relax(_graph.arc_target(a), _lengths[a]);
+            return;
+        }
+        for_each_overlay_arc<false>(q - 1, u, relax);
+    }
+    // Calls relax(w, length) for the arcs (w,u) of the overlay searched from
+    // the vertex u at query level q.
+    template <typename _F>
+    void for_each_in_arc(const std::size_t q, const vertex u,
+                         _F && relax) const {
+        if(q == 0) {
+            for(auto && a : _graph.in_arcs(u))
+                relax(_graph.arc_source(a), _lengths[a]);
+            return;
+        }
+        const level & lvl = _levels[q - 1];
+        const cell c = lvl.cells[u];
+        const std::size_t b = lvl.boundary_begin[c + 1] - lvl.boundary_begin[c];
+        const std::size_t column = lvl.clique_begin[c] + lvl.boundary_index[u];
+        for(std::size_t i = 0; i < b; ++i) {
+            const length_type length = lvl.clique_lengths[column + i * b];
+            if(length == semiring::infty) continue;
+            relax(lvl.boundary[lvl.boundary_begin[c] + i], length);
+        }
+        for(auto && a : _graph.in_arcs(u)) {
+            const vertex w = _graph.arc_source(a);
+            if(lvl.cells[w] != c) relax(w, _lengths[a]);
+        }
+    }
+};
+
+template <typename _LengthType>
+using customizable_route_planning =
+    basic_customizable_route_planning<_LengthType>;
+
+// Point to point query on a customized overlay : a bidirectional Dijkstra on
+// the graph made of the original arcs around the source and the target and of
+// the cliques of the largest cells containing neither of them elsewhere. The
+// semiring and the heap are given by dijkstra traits. Resetting the query
+// only costs the number of vertices reached by the previous one.
+template <typename _Overlay,
+          dijkstra_trait _Traits = dijkstra_default_traits<
+              typename _Overlay::graph_type, typename _Overlay::length_type>>
+class customizable_route_planning_query {
+private:
+    using vertex = typename _Overlay::vertex;
+    using length_type = typename _Overlay::length_type;
+    using semiring = typename _Traits::semiring;
+    using heap = typename _Traits::heap;
+    enum vertex_status : char { PRE_HEAP = 0, IN_HEAP = 1, POST_HEAP = 2 };
+
+    static_assert(std::is_same_v<typename heap::value_type,
+                                 std::pair<vertex, length_type>>,
+                  "customizable_route_planning_query requires heap entries "
+                  "type.");
+
+    struct direction {
+        heap queue;
+        static_map<vertex, vertex_status> status;
+        static_map<vertex, length_type> dist;
+
+        explicit direction(const std::size_t n)
+            : queue(typename semiring::less_t(),
+                    static_map<vertex, std::size_t>(n))
+            , status(n, PRE_HEAP)
+            , dist(n) {}
+    };
+
+    const _Overlay * _overlay;
+    direction _forward;
+    direction _reverse;
+    std::vector<vertex> _touched;
+    std::optional<vertex> _source;
+    std::optional<vertex> _target;
+    std::optional<vertex> _midpoint;
+
+public:
+    [[nodiscard]] explicit customizable_route_planning_query(
+        const _Overlay & overlay)
+        : _overlay(std::addressof(overlay))
+        , _forward(overlay.num_vertices())
+        , _reverse(overlay.num_vertices()) {}
+
+    [[nodiscard]] customizable_route_planning_query(const _Overlay & overlay,
+                                                    const vertex s,
+                                                    const vertex t)
+        : customizable_route_planning_query(overlay) {
+        add_source(s);
+        add_target(t);
+    }
+
+    customizable_route_planning_query & reset() noexcept {
+        for(const vertex u : _touched) {
+            _forward.status[u] = PRE_HEAP;
+            _reverse.status[u] = PRE_HEAP;
+        }
+        _touched.clear();
+        _forward.queue.clear();
+        _reverse.queue.clear();
+        _source.reset();
+        _target.reset();
+        _midpoint.reset();
+        return *this;
+    }
+
+private:
+    void reach(direction & d, const vertex u,
+               const length_type u_dist) noexcept {
+        if(_forward.status[u] == PRE_HEAP && _reverse.status[u] == PRE_HEAP)
+            _touched.push_back(u);
+        d.queue.push(std::make_pair(u, u_dist));
+        d.status[u] = IN_HEAP;
+        d.dist[u] = u_dist;
+    }
+
+public:
+    customizable_route_planning_query & add_source(const vertex s) noexcept {
+        assert(!_source.has_value());
+        _source.emplace(s);
+        reach(_forward, s, semiring::zero);
+        return *this;
+    }
+    customizable_route_planning_query & add_target(const vertex t) noexcept {
+        assert(!_target.has_value());
+        _target.emplace(t);
+        reach(_reverse, t, semiring::zero);
+        return *this;
+    }
+
+private:
+    // Number of the coarsest level whose cell containing u contains neither
+    // the source nor the target, 0 if there is none.
+    [[nodiscard]] std::size_t query_level(const vertex u) const noexcept {
+        for(std::size_t l = _overlay->num_levels(); l > 0; --l) {
+            const auto c = _overlay->cell_of(l - 1, u);
+            if(c != _overlay->cell_of(l - 1, _source.value()) &&
+               c != _overlay->cell_of(l - 1, _target.value()))
+                return l;
+        }
+        return 0;
+    }
+
+    template <bool forward>
+    void settle(direction & d, const direction & other,
+                length_type & st_dist) noexcept {
+        const auto [u, u_dist] = d.queue.top();
+        d.queue.pop();
+        d.status[u] = POST_HEAP;
+        const auto relax = [&, u_dist = u_dist](const vertex w,
+                                                const length_type length) {
+            const length_type new_w_dist = semiring::plus(u_dist, length);
+            if(d.status[w] == PRE_HEAP) {
+                reach(d, w, new_w_dist);
+            } else if(d.status[w] == IN_HEAP &&
+                      semiring::less(new_w_dist, d.dist[w])) {
+                d.queue.promote(w, new_w_dist);
+                d.dist[w] = new_w_dist;
+            }
+            if(other.status[w] == PRE_HEAP) return;
+            const length_type new_st_dist =
+                semiring::plus(new_w_dist, other.dist[w]);
+            if(semiring::less(new_st_dist, st_dist)) {
+                st_dist = new_st_dist;
+                _midpoint.emplace(w);
+            }
+        };
+        if constexpr(forward)
+            _overlay->for_each_out_arc(query_level(u), u, relax);
+        else
+            _overlay->for_each_in_arc(query_level(u), u, relax);
+    }
+
+public:
+    // Alternates the two searches until the sum of the smallest distances in
+    // both heaps is not smaller than the best path found, that is then the
+    // shortest.
+    length_type run() noexcept {
+        assert(_overlay->customized());
+        assert(_source.has_value() && _target.has_value());
+        length_type st_dist = semiring::infty;
+        if(_source.value() == _target.value()) {
+            _midpoint = _source;
+            return semiring::zero;
+        }
+        while(!_forward.queue.empty() && !_reverse.queue.empty()) {
+            const length_type forward_top = _forward.queue.top().second;
+            const length_type reverse_top = _reverse.queue.top().second;
+            if(!semiring::less(semiring::plus(forward_top, reverse_top),
+                               st_dist))
+                break;
+            if(semiring::less(reverse_top, forward_top))
+                settle<false>(_reverse, _forward, st_dist);
+            else
+                settle<true>(_forward, _reverse, st_dist);
+        }
+        return st_dist;
+    }
+
+    [[nodiscard]] constexpr bool path_found() const noexcept {
+        return _midpoint.has_value();
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_CUSTOMIZABLE_ROUTE_PLANNING_HPP
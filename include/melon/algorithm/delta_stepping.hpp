@@ -0,0 +1,261 @@
+#ifndef MELON_ALGORITHM_DELTA_STEPPING_HPP
+#define MELON_ALGORITHM_DELTA_STEPPING_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "melon/detail/parallel.hpp"
+#include "melon/graph.hpp"
+#include "melon/mapping.hpp"
+#include "melon/utility/semiring.hpp"
+#include "melon/views/graph_view.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// clang-format off
+template <typename _Traits>
+concept delta_stepping_trait = semiring<typename _Traits::semiring> &&
+    std::same_as<typename _Traits::semiring,
+                 shortest_path_semiring<typename _Traits::semiring::value_type>>;
+// clang-format on
+
+template <typename _Graph, typename _ValueType>
+struct delta_stepping_default_traits {
+    using semiring = shortest_path_semiring<_ValueType>;
+};
+
+// Parallel single source shortest paths for non-negative arc lengths.
+//
+// The vertices are kept in buckets of width delta by tentative distance.
+// The smallest bucket is settled in phases : every thread relaxes the light
+// arcs, not longer than delta, of its share of the bucket, which can refill
+// it, and once it stays empty the heavy arcs of all the vertices removed from
+// it are relaxed in parallel. Distances are lowered by atomic compare and
+// swap loops, and the reached vertices are collected in per-thread buffers
+// that are merged between phases. Delta around the maximum arc length
+// divided by the average degree balances the work and the number of phases.
+//
+// Computes exactly the distances of dijkstra. Reset costs O(|V|).
+template <outward_incidence_graph _Graph,
+          input_mapping<arc_t<_Graph>> _LengthMap,
+          delta_stepping_trait _Traits>
+    requires has_vertex_map<_Graph>
+class delta_stepping {
+private:
+    using vertex = vertex_t<_Graph>;
+    using arc = arc_t<_Graph>;
+    using length_type = mapped_value_t<_LengthMap, arc_t<_Graph>>;
+    using semiring = typename _Traits::semiring;
+    using atomic_length = std::atomic_ref<length_type>;
+    using bucket_entry = std::pair<std::size_t, vertex>;
+
+    static_assert(std::is_arithmetic_v<length_type>,
+                  "delta_stepping requires arithmetic arc lengths.");
+    static constexpr std::size_t grain_size = 256;
+
+    _Graph _graph;
+    _LengthMap _length_map;
+    length_type _delta;
+    std::size_t _num_threads;
+    vertex_map_t<_Graph, length_type> _distances_map;
+    vertex_map_t<_Graph, bool> _in_frontier_map;
+    vertex_map_t<_Graph, bool> _removed_map;
+    std::map<std::size_t, std::vector<vertex>> _buckets;
+    std::vector<std::vector<bucket_entry>> _thread_buffers;
+
+public:
+    template <typename _G, typename _M>
+    [[nodiscard]] delta_stepping(const parallel_policy & policy, _G && g,
+                                 _M && l, const length_type & delta)
+        : _graph(views::graph_all(std::forward<_G>(g)))
+        , _length_map(views::mapping_all(std::forward<_M>(l)))
+        , _delta(delta)
+        , _num_threads(detail::num_threads(policy))
+        , _distances_map(
+              create_vertex_map<length_type>(_graph, semiring::infty))
+        , _in_frontier_map(create_vertex_map<bool>(_graph, false))
+        , _removed_map(create_vertex_map<bool>(_graph, false))
+        , _thread_buffers(_num_threads) {
+        assert(semiring::less(semiring::zero, delta));
+    }
+
+    template <typename _G, typename _M>
+    [[nodiscard]] delta_stepping(_G && g, _M && l, const length_type & delta)
+        : delta_stepping(parallel_policy{1}, std::forward<_G>(g),
+                         std::forward<_M>(l), delta) {}
+
+    template <typename... _Args>
+    [[nodiscard]] delta_stepping(_Traits, _Args &&... args)
+        : delta_stepping(std::forward<_Args>(args)...) {}
+
+    [[nodiscard]] delta_stepping(const delta_stepping &) = default;
+    [[nodiscard]] delta_stepping(delta_stepping &&) = default;
+
+    delta_stepping & operator=(const delta_stepping &) = default;
+    delta_stepping & operator=(delta_stepping &&) = default;
+
+    delta_stepping & reset() noexcept {
+        _distances_map.fill(semiring::infty);
+        _buckets.clear();
+        return *this;
+    }
+    delta_stepping & add_source(
+        const vertex & s, const length_type & dist = semiring::zero) noexcept {
+        if(!semiring::less(dist, _distances_map[s])) return *this;
+        _distances_map[s] = dist;
+        _buckets[bucket_of(dist)].push_back(s);
+        return *this;
+    }
+
+private:
+    [[nodiscard]] std::size_t bucket_of(const length_type & d) const noexcept {
+        return static_cast<std::size_t>(d / _delta);
+    }
+
+    // Lowers the distance of w to new_dist if it is smaller, returning whether
+    // it was.
+    bool relax(const vertex & w, const length_type new_dist) noexcept {
+        atomic_length w_dist(_distances_map[w]);
+        length_type old_dist = w_dist.load(std::memory_order_relaxed);
+        while(semiring::less(new_dist, old_dist)) {
+            if(w_dist.compare_exchange_weak(old_dist, new_dist,
+                                            std::memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+
+    // Relaxes the light or heavy arcs of the vertices, each thread collecting
+    // the improved vertices with their new bucket.
+    template <bool light>
+    void relax_arcs(const std::vector<vertex> & vertices) {
+        const std::size_t num_chunks = std::max(
+            std::size_t{1},
+            std::min(_num_threads, vertices.size() / grain_size));
+        detail::parallel_for_chunks(
+            num_chunks, vertices.size(),
+            [&](const std::size_t c, std::size_t begin, const std::size_t end) {
+                std::vector<bucket_entry> & buffer = _thread_buffers[c];
+                for(; begin < end; ++begin) {
+                    const vertex & u = vertices[begin];
+                    const length_type u_dist =
+                        atomic_length(_distances_map[u])
+                            .load(std::memory_order_relaxed);
+                    for(const arc & a : melon::out_arcs(_graph, u)) {
+                        const length_type length = _length_map[a];
+                        if(light != !semiring::less(_delta, length)) continue;
+                        const length_type new_dist =
+                            semiring::plus(u_dist, length);
+                        const vertex & w = melon::arc_target(_graph, a);
+                        if(relax(w, new_dist))
+                            buffer.emplace_back(bucket_of(new_dist), w);
+                    }
+                }
+            });
+    }
+
+    // Moves the vertices collected by the threads either to the frontier if
+    // they fall in the current bucket, or to their bucket otherwise.
+    void merge_buffers(const std::size_t current,
+                       std::vector<vertex> & frontier,
+                       std::vector<vertex> & removed) {
+        for(auto & buffer : _thread_buffers) {
+            for(auto && [b, w] : buffer) {
+                if(b != current) {
+                    _buckets[b].push_back(w);
+                    continue;
+                }
+                push_frontier(w, frontier, removed);
+            }
+            buffer.clear();
+        }
+    }
+    void push_frontier(const vertex & w, std::vector<vertex> & frontier,
+                       std::vector<vertex> & removed) {
+        if(_in_frontier_map[w]) return;
+        _in_frontier_map[w] = true;
+        frontier.push_back(w);
+        if(_removed_map[w]) return;
+        _removed_map[w] = true;
+        removed.push_back(w);
+    }
+
+public:
+    void run() {
+        std::vector<vertex> frontier;
+        std::vector<vertex> next_frontier;
+        std::vector<vertex> removed;
+        while(!_buckets.empty()) {
+            auto bucket_it = _buckets.begin();
+            const std::size_t current = bucket_it->first;
+            for(const vertex & u : bucket_it->second)
+                if(bucket_of(_distances_map[u]) == current)
+                    push_frontier(u, frontier, removed);
+            _buckets.erase(bucket_it);
+            while(!frontier.empty()) {
+                for(const vertex & u : frontier) _in_frontier_map[u] = false;
+                relax_arcs<true>(frontier);
+                next_frontier.clear();
+                merge_buffers(current, next_frontier, removed);
+                std::swap(frontier, next_frontier);
+            }
+            relax_arcs<false>(removed);
+            merge_buffers(current, frontier, removed);
+            assert(frontier.empty());
+            for(const vertex & u : removed) _removed_map[u] = false;
+            removed.clear();
+        }
+    }
+
+    [[nodiscard]] bool reached(const vertex & u) const noexcept {
+        return _distances_map[u] != semiring::infty;
+    }
+    [[nodiscard]] length_type dist(const vertex & u) const noexcept {
+        assert(reached(u));
+        return _distances_map[u];
+    }
+    [[nodiscard]] const auto & distances_map() const noexcept {
+        return _distances_map;
+    }
+};
+
+template <typename _Graph, typename _LengthMap,
+          typename _Traits = delta_stepping_default_traits<
+              _Graph, mapped_value_t<_LengthMap, arc_t<_Graph>>>>
+delta_stepping(_Graph &&, _LengthMap &&,
+               const mapped_value_t<_LengthMap, arc_t<_Graph>> &)
+    -> delta_stepping<views::graph_all_t<_Graph>,
+                      views::mapping_all_t<_LengthMap>, _Traits>;
+
+template <typename _Graph, typename _LengthMap,
+          typename _Traits = delta_stepping_default_traits<
+              _Graph, mapped_value_t<_LengthMap, arc_t<_Graph>>>>
+delta_stepping(const parallel_policy &, _Graph &&, _LengthMap &&,
+               const mapped_value_t<_LengthMap, arc_t<_Graph>> &)
+    -> delta_stepping<views::graph_all_t<_Graph>,
+                      views::mapping_all_t<_LengthMap>, _Traits>;
+
+template <typename _Graph, typename _LengthMap, typename _Traits>
+delta_stepping(_Traits, _Graph &&, _LengthMap &&,
+               const mapped_value_t<_LengthMap, arc_t<_Graph>> &)
+    -> delta_stepping<views::graph_all_t<_Graph>,
+                      views::mapping_all_t<_LengthMap>, _Traits>;
+
+template <typename _Graph, typename _LengthMap, typename _Traits>
+delta_stepping(_Traits, const parallel_policy &, _Graph &&, _LengthMap &&,
+               const mapped_value_t<_LengthMap, arc_t<_Graph>> &)
+    -> delta_stepping<views::graph_all_t<_Graph>,
+                      views::mapping_all_t<_LengthMap>, _Traits>;
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_DELTA_STEPPING_HPP
@@ -10,10 +10,14 @@
 #include <variant>
 #include <vector>
 
+#include "melon/container/bucket_queue.hpp"
 #include "melon/container/d_ary_heap.hpp"
+#include "melon/container/radix_heap.hpp"
+#include "melon/container/timestamped_map.hpp"
 #include "melon/detail/intrusive_view.hpp"
 #include "melon/detail/map_if.hpp"
 #include "melon/detail/prefetch.hpp"
+#include "melon/detail/traits_vertex_map.hpp"
 #include "melon/graph.hpp"
 #include "melon/mapping.hpp"
 #include "melon/utility/algorithmic_generator.hpp"
@@ -46,6 +50,43 @@ struct dijkstra_default_traits {
     static constexpr bool store_paths = false;
 };
 
+// Monotone queues for non-negative integer lengths.
+template <typename _Graph, typename _ValueType>
+struct dijkstra_radix_heap_traits
+    : public dijkstra_default_traits<_Graph, _ValueType> {
+    using semiring = shortest_path_semiring<_ValueType>;
+    using heap = radix_heap<std::pair<vertex_t<_Graph>, _ValueType>,
+                            typename semiring::less_t,
+                            vertex_map_t<_Graph, std::size_t>,
+                            views::get_map<1>, views::get_map<0>>;
+};
+
+template <typename _Graph, typename _ValueType>
+struct dijkstra_bucket_queue_traits
+    : public dijkstra_default_traits<_Graph, _ValueType> {
+    using semiring = shortest_path_semiring<_ValueType>;
+    using heap = bucket_queue<std::pair<vertex_t<_Graph>, _ValueType>,
+                              typename semiring::less_t,
+                              vertex_map_t<_Graph, std::size_t>,
+                              views::get_map<1>, views::get_map<0>>;
+};
+
+// Timestamped vertex maps, such that reset costs O(1) instead of O(|V|), for
+// the repeated searches that only reach a few vertices of a large graph.
+template <typename _Graph, typename _ValueType>
+struct dijkstra_timestamped_traits
+    : public dijkstra_default_traits<_Graph, _ValueType> {
+    template <typename _V>
+    using vertex_map = timestamped_map<vertex_t<_Graph>, _V>;
+
+    using semiring = shortest_path_semiring<_ValueType>;
+    using heap =
+        updatable_d_ary_heap<2, std::pair<vertex_t<_Graph>, _ValueType>,
+                             typename semiring::less_t,
+                             vertex_map<std::size_t>, views::get_map<1>,
+                             views::get_map<0>>;
+};
+
 template <outward_incidence_graph _Graph,
           input_mapping<arc_t<_Graph>> _LengthMap, dijkstra_trait _Traits>
     requires has_vertex_map<_Graph>
@@ -68,7 +109,7 @@ private:
     _Graph _graph;
     _LengthMap _length_map;
     heap _heap;
-    vertex_map_t<_Graph, vertex_status> _vertex_status_map;
+    traits_vertex_map_t<_Traits, _Graph, vertex_status> _vertex_status_map;
 
     [[no_unique_address]] vertex_map_if<_Traits::store_paths &&
                                             !has_arc_source<_Graph>,
@@ -84,8 +125,10 @@ public:
         : _graph(views::graph_all(std::forward<_G>(g)))
         , _length_map(views::mapping_all(std::forward<_M>(l)))
         , _heap(typename _Traits::semiring::less_t(),
-                create_vertex_map<std::size_t>(_graph))
-        , _vertex_status_map(create_vertex_map<vertex_status>(_graph, PRE_HEAP))
+                create_traits_vertex_map<_Traits, std::size_t>(_graph))
+        , _vertex_status_map(
+              create_traits_vertex_map<_Traits, vertex_status>(_graph,
+                                                               PRE_HEAP))
         , _pred_vertices_map(_graph)
         , _pred_arcs_map(_graph)
         , _distances_map(_graph) {}
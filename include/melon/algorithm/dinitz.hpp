@@ -3,17 +3,31 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <ranges>
 #include <vector>
 
+#include "melon/container/timestamped_map.hpp"
 #include "melon/detail/consumable_range.hpp"
+#include "melon/detail/traits_vertex_map.hpp"
 #include "melon/graph.hpp"
 #include "melon/mapping.hpp"
 
 namespace fhamonic {
 namespace melon {
 
-template <graph _Graph, input_mapping<arc_t<_Graph>> _CapacityMap>
+struct dinitz_default_traits {};
+
+// Timestamped rank map, such that ranking the vertices before each blocking
+// flow costs O(reached vertices) instead of O(|V|).
+template <typename _Graph>
+struct dinitz_timestamped_traits {
+    template <typename _V>
+    using vertex_map = timestamped_map<vertex_t<_Graph>, _V>;
+};
+
+template <graph _Graph, input_mapping<arc_t<_Graph>> _CapacityMap,
+          typename _Traits = dinitz_default_traits>
     requires outward_incidence_graph<_Graph> &&
              inward_incidence_graph<_Graph> && has_vertex_map<_Graph> &&
              has_arc_map<_Graph>
@@ -30,7 +44,7 @@ private:
     vertex _t;
     arc_map_t<_Graph, value_t> _carried_flow_map;
     std::vector<vertex> _bfs_queue;
-    vertex_map_t<_Graph, std::size_t> _vertex_rank_map;
+    traits_vertex_map_t<_Traits, _Graph, std::size_t> _vertex_rank_map;
     vertex_map_t<_Graph, consumable_range<out_arcs_range_t<_Graph>>>
         _remaining_out_arcs;
     vertex_map_t<_Graph, consumable_range<in_arcs_range_t<_Graph>>>
@@ -42,7 +56,8 @@ public:
         : _graph(views::graph_all(std::forward<_G>(g)))
         , _capacity_map(views::mapping_all(std::forward<_M>(c)))
         , _carried_flow_map(create_arc_map<value_t>(_graph))
-        , _vertex_rank_map(create_vertex_map<std::size_t>(_graph))
+        , _vertex_rank_map(
+              create_traits_vertex_map<_Traits, std::size_t>(_graph))
         , _remaining_out_arcs(
               create_vertex_map<consumable_range<out_arcs_range_t<_Graph>>>(
                   _graph))
@@ -63,6 +78,10 @@ public:
         set_target(t);
     }
 
+    template <typename... _Args>
+    [[nodiscard]] constexpr dinitz(_Traits, _Args &&... args)
+        : dinitz(std::forward<_Args>(args)...) {}
+
     [[nodiscard]] constexpr dinitz(const dinitz &) = default;
     [[nodiscard]] constexpr dinitz(dinitz &&) = default;
 
@@ -200,6 +219,17 @@ dinitz(_Graph &&, _LengthMap &&, const vertex_t<_Graph> &,
        const vertex_t<_Graph> &)
     -> dinitz<views::graph_all_t<_Graph>, views::mapping_all_t<_LengthMap>>;
 
+template <typename _Graph, typename _LengthMap, typename _Traits>
+dinitz(_Traits, _Graph &&, _LengthMap &&)
+    -> dinitz<views::graph_all_t<_Graph>, views::mapping_all_t<_LengthMap>,
+              _Traits>;
+
+template <typename _Graph, typename _LengthMap, typename _Traits>
+dinitz(_Traits, _Graph &&, _LengthMap &&, const vertex_t<_Graph> &,
+       const vertex_t<_Graph> &)
+    -> dinitz<views::graph_all_t<_Graph>, views::mapping_all_t<_LengthMap>,
+              _Traits>;
+
 }  // namespace melon
 }  // namespace fhamonic
 
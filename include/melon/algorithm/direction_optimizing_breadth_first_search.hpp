@@ -0,0 +1,261 @@
+#ifndef MELON_ALGORITHM_DIRECTION_OPTIMIZING_BFS_HPP
+#define MELON_ALGORITHM_DIRECTION_OPTIMIZING_BFS_HPP
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include "melon/container/static_filter_map.hpp"
+#include "melon/detail/map_if.hpp"
+#include "melon/graph.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Beamer's heuristic : switch to bottom-up when the frontier has more than
+// 1/bottom_up_arcs_ratio of the unexplored arcs and back to top-down when it
+// has less than 1/top_down_vertices_ratio of the vertices.
+struct direction_optimizing_breadth_first_search_default_traits {
+    static constexpr bool store_pred_vertices = false;
+    static constexpr bool store_distances = false;
+
+    static constexpr std::size_t bottom_up_arcs_ratio = 14;
+    static constexpr std::size_t top_down_vertices_ratio = 24;
+};
+
+// Level synchronous BFS that expands the frontier either top-down, through the
+// out neighbors of the frontier vertices, or bottom-up, by looking for a
+// frontier vertex among the in neighbors of every unreached vertex. The
+// bottom-up steps stop scanning the in neighbors of a vertex at its first
+// frontier vertex, which skips most of the arcs of the middle levels of low
+// diameter graphs.
+template <outward_adjacency_graph _Graph,
+          typename _Traits =
+              direction_optimizing_breadth_first_search_default_traits>
+    requires inward_adjacency_graph<_Graph> && has_num_vertices<_Graph> &&
+             has_num_arcs<_Graph> && has_out_degree<_Graph> &&
+             has_vertex_map<_Graph> && std::integral<vertex_t<_Graph>>
+class direction_optimizing_breadth_first_search {
+private:
+    using vertex = vertex_t<_Graph>;
+
+private:
+    _Graph _graph;
+    static_filter_map<vertex> _reached_map;
+
+    std::vector<vertex> _frontier;
+    std::vector<vertex> _next_frontier;
+    static_filter_map<vertex> _frontier_map;
+    static_filter_map<vertex> _next_frontier_map;
+
+    bool _bottom_up;
+    int _level;
+    std::size_t _frontier_size;
+    std::size_t _frontier_arcs;
+    std::size_t _unexplored_arcs;
+
+    [[no_unique_address]] vertex_map_if<_Traits::store_pred_vertices, _Graph,
+                                        vertex> _pred_vertices_map;
+    [[no_unique_address]] vertex_map_if<_Traits::store_distances, _Graph, int>
+        _dist_map;
+
+public:
+    template <typename _G>
+    [[nodiscard]] constexpr explicit direction_optimizing_breadth_first_search(
+        _G && g)
+        : _graph(views::graph_all(std::forward<_G>(g)))
+        , _reached_map(num_vertices(_graph), false)
+        , _frontier()
+        , _next_frontier()
+        , _frontier_map(num_vertices(_graph))
+        , _next_frontier_map(num_vertices(_graph))
+        , _bottom_up(false)
+        , _level(0)
+        , _frontier_size(0)
+        , _frontier_arcs(0)
+        , _unexplored_arcs(static_cast<std::size_t>(num_arcs(_graph)))
+        , _pred_vertices_map(_graph)
+        , _dist_map(_graph) {
+        _frontier.reserve(num_vertices(_graph));
+        _next_frontier.reserve(num_vertices(_graph));
+    }
+
+    template <typename _G>
+    [[nodiscard]] constexpr direction_optimizing_breadth_first_search(
+        _G && g, const vertex & s)
+        : direction_optimizing_breadth_first_search(std::forward<_G>(g)) {
+        add_source(s);
+    }
+
+    template <typename... _Args>
+    [[nodiscard]] constexpr direction_optimizing_breadth_first_search(
+        _Traits, _Args &&... args)
+        : direction_optimizing_breadth_first_search(
+              std::forward<_Args>(args)...) {}
+
+    [[nodiscard]] constexpr direction_optimizing_breadth_first_search(
+        const direction_optimizing_breadth_first_search &) = default;
+    [[nodiscard]] constexpr direction_optimizing_breadth_first_search(
+        direction_optimizing_breadth_first_search &&) = default;
+
+    constexpr direction_optimizing_breadth_first_search & operator=(
+        const direction_optimizing_breadth_first_search &) = default;
+    constexpr direction_optimizing_breadth_first_search & operator=(
+        direction_optimizing_breadth_first_search &&) = default;
+
+    constexpr direction_optimizing_breadth_first_search & reset() noexcept {
+        _reached_map.fill(false);
+        _frontier.resize(0);
+        _bottom_up = false;
+        _level = 0;
+        _frontier_size = 0;
+        _frontier_arcs = 0;
+        _unexplored_arcs = static_cast<std::size_t>(num_arcs(_graph));
+        return *this;
+    }
+    constexpr direction_optimizing_breadth_first_search & add_source(
+        const vertex & s) noexcept {
+        assert(!_reached_map[s]);
+        assert(_level == 0 && !_bottom_up);
+        _frontier.push_back(s);
+        ++_frontier_size;
+        visit(s, s);
+        if constexpr(_Traits::store_distances) _dist_map[s] = 0;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr bool finished() const noexcept {
+        return _frontier_size == 0;
+    }
+    // Whether the next level will be expanded bottom-up, as decided by the
+    // last call to advance().
+    [[nodiscard]] constexpr bool bottom_up() const noexcept {
+        return _bottom_up;
+    }
+
+    // Expands the whole frontier, i.e. reaches the vertices at distance
+    // level + 1 of the sources.
+    constexpr void advance() noexcept {
+        assert(!finished());
+        if(_bottom_up) {
+            if(_frontier_size < num_vertices(_graph) /
+                                    _Traits::top_down_vertices_ratio)
+                switch_to_top_down();
+        } else if(_frontier_arcs >
+                  _unexplored_arcs / _Traits::bottom_up_arcs_ratio) {
+            switch_to_bottom_up();
+        }
+        if(_bottom_up)
+            bottom_up_step();
+        else
+            top_down_step();
+        ++_level;
+    }
+
+    constexpr void run() noexcept {
+        while(!finished()) advance();
+    }
+
+    [[nodiscard]] constexpr bool reached(const vertex & u) const noexcept {
+        return _reached_map[u];
+    }
+
+    [[nodiscard]] constexpr vertex pred_vertex(const vertex & u) const noexcept
+        requires(_Traits::store_pred_vertices)
+    {
+        assert(reached(u));
+        return _pred_vertices_map[u];
+    }
+    [[nodiscard]] constexpr int dist(const vertex & u) const noexcept
+        requires(_Traits::store_distances)
+    {
+        assert(reached(u));
+        return _dist_map[u];
+    }
+
+private:
+    constexpr void visit(const vertex & w, const vertex & u) noexcept {
+        _reached_map[w] = true;
+        if constexpr(_Traits::store_pred_vertices) _pred_vertices_map[w] = u;
+        if constexpr(_Traits::store_distances) _dist_map[w] = _level + 1;
+        const std::size_t degree =
+            static_cast<std::size_t>(out_degree(_graph, w));
+        _frontier_arcs += degree;
+        _unexplored_arcs -= degree;
+    }
+
+    constexpr void switch_to_bottom_up() noexcept {
+        _frontier_map.fill(false);
+        for(auto && u : _frontier) _frontier_map[u] = true;
+        _bottom_up = true;
+    }
+    constexpr void switch_to_top_down() noexcept {
+        _frontier.resize(0);
+        for(auto && u : _frontier_map.filter(vertices(_graph)))
+            _frontier.push_back(u);
+        _bottom_up = false;
+    }
+
+    constexpr void top_down_step() noexcept {
+        _next_frontier.resize(0);
+        _frontier_arcs = 0;
+        for(auto && u : _frontier) {
+            for(auto && w : out_neighbors(_graph, u)) {
+                if(_reached_map[w]) continue;
+                visit(w, u);
+                _next_frontier.push_back(w);
+            }
+        }
+        std::swap(_frontier, _next_frontier);
+        _frontier_size = _frontier.size();
+    }
+    constexpr void bottom_up_step() noexcept {
+        _next_frontier_map.fill(false);
+        _frontier_size = 0;
+        _frontier_arcs = 0;
+        for(auto && w : vertices(_graph)) {
+            if(_reached_map[w]) continue;
+            for(auto && u : in_neighbors(_graph, w)) {
+                if(!_frontier_map[u]) continue;
+                visit(w, u);
+                _next_frontier_map[w] = true;
+                ++_frontier_size;
+                break;
+            }
+        }
+        std::swap(_frontier_map, _next_frontier_map);
+    }
+};
+
+template <typename _Graph,
+          typename _Traits =
+              direction_optimizing_breadth_first_search_default_traits>
+direction_optimizing_breadth_first_search(_Graph &&)
+    -> direction_optimizing_breadth_first_search<views::graph_all_t<_Graph>,
+                                                 _Traits>;
+
+template <typename _Graph,
+          typename _Traits =
+              direction_optimizing_breadth_first_search_default_traits>
+direction_optimizing_breadth_first_search(_Graph &&, const vertex_t<_Graph> &)
+    -> direction_optimizing_breadth_first_search<views::graph_all_t<_Graph>,
+                                                 _Traits>;
+
+template <typename _Graph, typename _Traits>
+direction_optimizing_breadth_first_search(_Traits, _Graph &&)
+    -> direction_optimizing_breadth_first_search<views::graph_all_t<_Graph>,
+                                                 _Traits>;
+
+template <typename _Graph, typename _Traits>
+direction_optimizing_breadth_first_search(_Traits, _Graph &&,
+                                          const vertex_t<_Graph> &)
+    -> direction_optimizing_breadth_first_search<views::graph_all_t<_Graph>,
+                                                 _Traits>;
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_DIRECTION_OPTIMIZING_BFS_HPP
@@ -0,0 +1,318 @@
+#ifndef MELON_ALGORITHM_DISTANCE_TABLE_HPP
+#define MELON_ALGORITHM_DISTANCE_TABLE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/detail/parallel.hpp"
+#include "melon/graph.hpp"
+#include "melon/mapping.hpp"
+#include "melon/utility/semiring.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Dense row-major matrix of the distances from num_sources sources to
+// num_targets targets, the unreachable pairs being at semiring::infty.
+template <typename _LengthType>
+class distance_table {
+public:
+    using length_type = _LengthType;
+    using semiring = shortest_path_semiring<length_type>;
+
+private:
+    std::size_t _num_sources;
+    std::size_t _num_targets;
+    std::vector<length_type> _distances;
+
+public:
+    [[nodiscard]] distance_table() = default;
+    [[nodiscard]] distance_table(const std::size_t num_sources,
+                                 const std::size_t num_targets)
+        : _num_sources(num_sources)
+        , _num_targets(num_targets)
+        , _distances(num_sources * num_targets, semiring::infty) {}
+
+    [[nodiscard]] distance_table(const distance_table &) = default;
+    [[nodiscard]] distance_table(distance_table &&) = default;
+    distance_table & operator=(const distance_table &) = default;
+    distance_table & operator=(distance_table &&) = default;
+
+    [[nodiscard]] constexpr std::size_t num_sources() const noexcept {
+        return _num_sources;
+    }
+    [[nodiscard]] constexpr std::size_t num_targets() const noexcept {
+        return _num_targets;
+    }
+    [[nodiscard]] constexpr length_type dist(
+        const std::size_t i, const std::size_t j) const noexcept {
+        assert(i < _num_sources && j < _num_targets);
+        return _distances[i * _num_targets + j];
+    }
+    [[nodiscard]] constexpr bool reachable(const std::size_t i,
+                                           const std::size_t j) const noexcept {
+        return dist(i, j) != semiring::infty;
+    }
+    [[nodiscard]] constexpr std::span<length_type> row(
+        const std::size_t i) noexcept {
+        assert(i < _num_sources);
+        return {_distances.data() + i * _num_targets, _num_targets};
+    }
+    [[nodiscard]] constexpr std::span<const length_type> row(
+        const std::size_t i) const noexcept {
+        assert(i < _num_sources);
+        return {_distances.data() + i * _num_targets, _num_targets};
+    }
+    [[nodiscard]] constexpr const length_type * data() const noexcept {
+        return _distances.data();
+    }
+};
+
+namespace __distance_table {
+
+// Calls f(i, search) for every i in [0,n), search being the dijkstra of the
+// calling thread that is reset in between. The threads pick the next index
+// as soon as they are done, which balances searches of uneven costs.
+template <typename _Traits, typename _G, typename _LengthMap, typename F>
+void for_each_search(const parallel_policy & policy, const _G & g,
+                     const _LengthMap & length_map, const std::size_t n,
+                     F && f) {
+    const std::size_t num_threads = std::max(
+        std::size_t{1}, std::min(detail::num_threads(policy), n));
+    std::atomic<std::size_t> next{0};
+    detail::parallel_for_chunks(
+        num_threads, num_threads,
+        [&](const std::size_t thread_index, std::size_t, std::size_t) {
+            dijkstra search(_Traits{}, g, length_map);
+            for(std::size_t i = next.fetch_add(1, std::memory_order_relaxed);
+                i < n; i = next.fetch_add(1, std::memory_order_relaxed)) {
+                search.reset();
+                f(thread_index, i, search);
+            }
+        });
+}
+
+}  // namespace __distance_table
+
+// Distances from every source to every target by one Dijkstra search per
+// source, run in parallel by the policy threads. Each thread reuses its
+// search state and stops a search as soon as it has settled all the targets.
+//
+// The vertices of the graph are assumed to be the integers of [0,n).
+template <typename _Traits, outward_incidence_graph _G,
+          input_mapping<arc_t<_G>> _LengthMap,
+          std::ranges::random_access_range _S,
+          std::ranges::random_access_range _T>
+    requires has_vertex_map<_G> && has_num_vertices<_G>
+[[nodiscard]] distance_table<mapped_value_t<_LengthMap, arc_t<_G>>>
+many_to_many_distances(_Traits, const parallel_policy & policy, const _G & g,
+                       const _LengthMap & length_map, const _S & sources,
+                       const _T & targets) {
+    using length_type = mapped_value_t<_LengthMap, arc_t<_G>>;
+    using semiring = shortest_path_semiring<length_type>;
+    static constexpr std::size_t no_target =
+        std::numeric_limits<std::size_t>::max();
+
+    const std::size_t num_sources = std::ranges::size(sources);
+    const std::size_t num_targets = std::ranges::size(targets);
+    distance_table<length_type> table(num_sources, num_targets);
+
+    // the searches count the distinct targets, that the columns refer to
+    std::vector<std::size_t> target_index(melon::num_vertices(g), no_target);
+    std::vector<std::size_t> column_target(num_targets);
+    std::size_t num_distinct_targets = 0;
+    for(std::size_t j = 0; j < num_targets; ++j) {
+        std::size_t & index =
+            target_index[static_cast<std::size_t>(targets[j])];
+        if(index == no_target) index = num_distinct_targets++;
+        column_target[j] = index;
+    }
+
+    std::vector<std::vector<length_type>> target_distances(
+        std::max(std::size_t{1},
+                 std::min(detail::num_threads(policy), num_sources)),
+        std::vector<length_type>(num_distinct_targets));
+    __distance_table::for_each_search<_Traits>(
+        policy, g, length_map, num_sources,
+        [&](const std::size_t thread_index, const std::size_t i,
+            auto & search) {
+            std::vector<length_type> & target_dist =
+                target_distances[thread_index];
+            std::ranges::fill(target_dist, semiring::infty);
+            search.add_source(sources[i]);
+            for(std::size_t remaining = num_distinct_targets;
+                remaining > 0 && !search.finished(); search.advance()) {
+                const auto && [u, u_dist] = search.current();
+                const std::size_t index =
+                    target_index[static_cast<std::size_t>(u)];
+                if(index == no_target) continue;
+                target_dist[index] = u_dist;
+                --remaining;
+            }
+            std::span<length_type> row = table.row(i);
+            for(std::size_t j = 0; j < num_targets; ++j)
+                row[j] = target_dist[column_target[j]];
+        });
+    return table;
+}
+
+template <outward_incidence_graph _G, input_mapping<arc_t<_G>> _LengthMap,
+          std::ranges::random_access_range _S,
+          std::ranges::random_access_range _T>
+    requires has_vertex_map<_G> && has_num_vertices<_G>
+[[nodiscard]] auto many_to_many_distances(const parallel_policy & policy,
+                                          const _G & g,
+                                          const _LengthMap & length_map,
+                                          const _S & sources,
+                                          const _T & targets) {
+    return many_to_many_distances(
+        dijkstra_default_traits<_G, mapped_value_t<_LengthMap, arc_t<_G>>>{},
+        policy, g, length_map, sources, targets);
+}
+
+template <outward_incidence_graph _G, input_mapping<arc_t<_G>> _LengthMap,
+          std::ranges::random_access_range _S,
+          std::ranges::random_access_range _T>
+    requires has_vertex_map<_G> && has_num_vertices<_G>
+[[nodiscard]] auto many_to_many_distances(const _G & g,
+                                          const _LengthMap & length_map,
+                                          const _S & sources,
+                                          const _T & targets) {
+    return many_to_many_distances(parallel_policy{1}, g, length_map, sources,
+                                  targets);
+}
+
+// Bucket based many to many distances : a backward search from every target
+// in the backward graph stores the pairs (target, dist(v,target)) in the
+// bucket of each vertex v it settles, then a forward search from every
+// source in the forward graph combines its distances to the settled vertices
+// with their buckets. The distance between s and t is found as long as a
+// shortest path from s to t goes through a vertex settled by both searches.
+//
+// The backward graph can be views::reverse of the forward one, for which the
+// backward searches alone settle all the distances, but the buckets pay off
+// with small search spaces, as in the upward and downward graphs of a
+// contraction_hierarchy. The searches run in parallel by the policy threads
+// and the buckets are laid out contiguously by a counting sort.
+//
+// The vertices of the graphs are assumed to be the integers of [0,n).
+template <typename _Traits, outward_incidence_graph _G,
+          input_mapping<arc_t<_G>> _LengthMap, outward_incidence_graph _RG,
+          input_mapping<arc_t<_RG>> _RLengthMap,
+          std::ranges::random_access_range _S,
+          std::ranges::random_access_range _T>
+    requires has_vertex_map<_G> && has_num_vertices<_G> &&
+             has_vertex_map<_RG> &&
+             std::same_as<mapped_value_t<_LengthMap, arc_t<_G>>,
+                          mapped_value_t<_RLengthMap, arc_t<_RG>>>
+[[nodiscard]] distance_table<mapped_value_t<_LengthMap, arc_t<_G>>>
+bucket_many_to_many_distances(_Traits, const parallel_policy & policy,
+                              const _G & forward_graph,
+                              const _LengthMap & forward_length_map,
+                              const _RG & backward_graph,
+                              const _RLengthMap & backward_length_map,
+                              const _S & sources, const _T & targets) {
+    using length_type = mapped_value_t<_LengthMap, arc_t<_G>>;
+    using semiring = shortest_path_semiring<length_type>;
+    using bucket_entry = std::pair<std::size_t, length_type>;
+
+    const std::size_t n = melon::num_vertices(forward_graph);
+    const std::size_t num_sources = std::ranges::size(sources);
+    const std::size_t num_targets = std::ranges::size(targets);
+    distance_table<length_type> table(num_sources, num_targets);
+
+    std::vector<std::vector<std::pair<std::size_t, bucket_entry>>>
+        thread_entries(std::max(
+            std::size_t{1},
+            std::min(detail::num_threads(policy), num_targets)));
+    __distance_table::for_each_search<_Traits>(
+        policy, backward_graph, backward_length_map, num_targets,
+        [&](const std::size_t thread_index, const std::size_t j,
+            auto & search) {
+            auto & entries = thread_entries[thread_index];
+            search.add_source(targets[j]);
+            for(; !search.finished(); search.advance()) {
+                const auto && [u, u_dist] = search.current();
+                entries.emplace_back(static_cast<std::size_t>(u),
+                                     bucket_entry(j, u_dist));
+            }
+        });
+
+    std::vector<std::size_t> bucket_begin(n + 1, 0);
+    for(auto && entries : thread_entries)
+        for(auto && [u, entry] : entries) ++bucket_begin[u + 1];
+    for(std::size_t u = 0; u < n; ++u) bucket_begin[u + 1] += bucket_begin[u];
+    std::vector<bucket_entry> buckets(bucket_begin[n]);
+    {
+        std::vector<std::size_t> bucket_end(bucket_begin.begin(),
+                                            bucket_begin.end() - 1);
+        for(auto && entries : thread_entries) {
+            for(auto && [u, entry] : entries)
+                buckets[bucket_end[u]++] = entry;
+            std::vector<std::pair<std::size_t, bucket_entry>>().swap(entries);
+        }
+    }
+
+    __distance_table::for_each_search<_Traits>(
+        policy, forward_graph, forward_length_map, num_sources,
+        [&](const std::size_t, const std::size_t i, auto & search) {
+            std::span<length_type> row = table.row(i);
+            search.add_source(sources[i]);
+            for(; !search.finished(); search.advance()) {
+                const auto && [u, u_dist] = search.current();
+                const std::size_t v = static_cast<std::size_t>(u);
+                for(std::size_t k = bucket_begin[v]; k < bucket_begin[v + 1];
+                    ++k) {
+                    const auto & [j, v_dist] = buckets[k];
+                    const length_type dist = semiring::plus(u_dist, v_dist);
+                    if(semiring::less(dist, row[j])) row[j] = dist;
+                }
+            }
+        });
+    return table;
+}
+
+template <outward_incidence_graph _G, input_mapping<arc_t<_G>> _LengthMap,
+          outward_incidence_graph _RG, input_mapping<arc_t<_RG>> _RLengthMap,
+          std::ranges::random_access_range _S,
+          std::ranges::random_access_range _T>
+    requires has_vertex_map<_G> && has_num_vertices<_G> &&
+             has_vertex_map<_RG>
+[[nodiscard]] auto bucket_many_to_many_distances(
+    const parallel_policy & policy, const _G & forward_graph,
+    const _LengthMap & forward_length_map, const _RG & backward_graph,
+    const _RLengthMap & backward_length_map, const _S & sources,
+    const _T & targets) {
+    return bucket_many_to_many_distances(
+        dijkstra_default_traits<_G, mapped_value_t<_LengthMap, arc_t<_G>>>{},
+        policy, forward_graph, forward_length_map, backward_graph,
+        backward_length_map, sources, targets);
+}
+
+template <outward_incidence_graph _G, input_mapping<arc_t<_G>> _LengthMap,
+          outward_incidence_graph _RG, input_mapping<arc_t<_RG>> _RLengthMap,
+          std::ranges::random_access_range _S,
+          std::ranges::random_access_range _T>
+    requires has_vertex_map<_G> && has_num_vertices<_G> &&
+             has_vertex_map<_RG>
+[[nodiscard]] auto bucket_many_to_many_distances(
+    const _G & forward_graph, const _LengthMap & forward_length_map,
+    const _RG & backward_graph, const _RLengthMap & backward_length_map,
+    const _S & sources, const _T & targets) {
+    return bucket_many_to_many_distances(
+        parallel_policy{1}, forward_graph, forward_length_map, backward_graph,
+        backward_length_map, sources, targets);
+}
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_DISTANCE_TABLE_HPP
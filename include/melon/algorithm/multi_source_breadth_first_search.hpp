@@ -0,0 +1,251 @@
+#ifndef MELON_ALGORITHM_MULTI_SOURCE_BFS_HPP
+#define MELON_ALGORITHM_MULTI_SOURCE_BFS_HPP
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include "melon/detail/map_if.hpp"
+#include "melon/graph.hpp"
+#include "melon/views/graph_view.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Batches of 64 * num_words sources.
+struct multi_source_breadth_first_search_default_traits {
+    static constexpr std::size_t num_words = 1;
+    static constexpr bool store_distances = false;
+};
+
+// Batches of 256 sources, whose bitset operations are vectorized by the
+// compiler when 256 bits registers are available.
+struct multi_source_breadth_first_search_wide_traits
+    : public multi_source_breadth_first_search_default_traits {
+    static constexpr std::size_t num_words = 4;
+};
+
+// Bit-parallel BFS from a batch of sources (MS-BFS, Then et al. 2014).
+//
+// Every vertex holds the bitsets of the sources that reached it and of the
+// sources for which it is in the frontier, so that the out neighbors of a
+// frontier vertex are scanned once for all the sources of the batch.
+// The ith source added has index i.
+template <outward_adjacency_graph _Graph,
+          typename _Traits = multi_source_breadth_first_search_default_traits>
+    requires has_vertex_map<_Graph>
+class multi_source_breadth_first_search {
+public:
+    static constexpr std::size_t batch_size = 64 * _Traits::num_words;
+
+private:
+    using vertex = vertex_t<_Graph>;
+    using bitset = std::array<std::uint64_t, _Traits::num_words>;
+
+    _Graph _graph;
+    std::size_t _num_sources;
+    int _level;
+    std::vector<vertex> _frontier;
+    std::vector<vertex> _next_frontier;
+    std::vector<vertex> _reached_vertices;
+    vertex_map_t<_Graph, bitset> _seen_map;
+    vertex_map_t<_Graph, bitset> _frontier_map;
+    vertex_map_t<_Graph, bitset> _next_map;
+
+    [[no_unique_address]] vertex_map_if<_Traits::store_distances, _Graph,
+                                        std::array<int, batch_size>>
+        _dist_map;
+
+    [[nodiscard]] static constexpr bool any(const bitset & b) noexcept {
+        std::uint64_t x = 0;
+        for(std::size_t k = 0; k < _Traits::num_words; ++k) x |= b[k];
+        return x != 0;
+    }
+
+public:
+    template <typename _G>
+    [[nodiscard]] constexpr explicit multi_source_breadth_first_search(_G && g)
+        : _graph(views::graph_all(std::forward<_G>(g)))
+        , _num_sources(0)
+        , _level(0)
+        , _frontier()
+        , _next_frontier()
+        , _reached_vertices()
+        , _seen_map(create_vertex_map<bitset>(_graph, bitset{}))
+        , _frontier_map(create_vertex_map<bitset>(_graph, bitset{}))
+        , _next_map(create_vertex_map<bitset>(_graph, bitset{}))
+        , _dist_map(_graph) {}
+
+    template <typename _G, std::ranges::input_range _Sources>
+        requires std::convertible_to<std::ranges::range_value_t<_Sources>,
+                                     vertex_t<_Graph>>
+    [[nodiscard]] constexpr multi_source_breadth_first_search(
+        _G && g, _Sources && sources)
+        : multi_source_breadth_first_search(std::forward<_G>(g)) {
+        for(auto && s : sources) add_source(s);
+    }
+
+    template <typename... _Args>
+    [[nodiscard]] constexpr multi_source_breadth_first_search(
+        _Traits, _Args &&... args)
+        : multi_source_breadth_first_search(std::forward<_Args>(args)...) {}
+
+    [[nodiscard]] constexpr multi_source_breadth_first_search(
+        const multi_source_breadth_first_search &) = default;
+    [[nodiscard]] constexpr multi_source_breadth_first_search(
+        multi_source_breadth_first_search &&) = default;
+
+    constexpr multi_source_breadth_first_search & operator=(
+        const multi_source_breadth_first_search &) = default;
+    constexpr multi_source_breadth_first_search & operator=(
+        multi_source_breadth_first_search &&) = default;
+
+    // Costs O(number of reached vertices).
+    constexpr multi_source_breadth_first_search & reset() noexcept {
+        for(auto && u : _reached_vertices) _seen_map[u] = bitset{};
+        for(auto && u : _frontier) _frontier_map[u] = bitset{};
+        _reached_vertices.resize(0);
+        _frontier.resize(0);
+        _num_sources = 0;
+        _level = 0;
+        return *this;
+    }
+    constexpr multi_source_breadth_first_search & add_source(
+        const vertex & s) noexcept {
+        assert(_num_sources < batch_size);
+        assert(_level == 0);
+        const std::size_t i = _num_sources++;
+        bitset & seen = _seen_map[s];
+        if(!any(seen)) _reached_vertices.push_back(s);
+        bitset & frontier = _frontier_map[s];
+        if(!any(frontier)) _frontier.push_back(s);
+        seen[i / 64] |= std::uint64_t{1} << (i % 64);
+        frontier[i / 64] |= std::uint64_t{1} << (i % 64);
+        if constexpr(_Traits::store_distances) _dist_map[s][i] = 0;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr std::size_t num_sources() const noexcept {
+        return _num_sources;
+    }
+    [[nodiscard]] constexpr bool finished() const noexcept {
+        return _frontier.empty();
+    }
+
+private:
+    // Calls f(i, u) for every source index i of the bitset.
+    template <typename F>
+    static constexpr void for_each_source(const bitset & b, const vertex & u,
+                                          F && f) {
+        for(std::size_t k = 0; k < _Traits::num_words; ++k) {
+            for(std::uint64_t x = b[k]; x != 0; x &= x - 1)
+                f(k * 64 + static_cast<std::size_t>(std::countr_zero(x)), u);
+        }
+    }
+
+    template <typename F>
+    constexpr void advance(F && f) {
+        assert(!finished());
+        _next_frontier.resize(0);
+        for(auto && u : _frontier) {
+            const bitset & frontier = _frontier_map[u];
+            for(auto && w : out_neighbors(_graph, u)) {
+                bitset & next = _next_map[w];
+                if(!any(next)) _next_frontier.push_back(w);
+                for(std::size_t k = 0; k < _Traits::num_words; ++k)
+                    next[k] |= frontier[k];
+            }
+        }
+        for(auto && u : _frontier) _frontier_map[u] = bitset{};
+        ++_level;
+        _frontier.resize(0);
+        for(auto && w : _next_frontier) {
+            bitset & seen = _seen_map[w];
+            bitset & next = _next_map[w];
+            bitset discovered;
+            for(std::size_t k = 0; k < _Traits::num_words; ++k)
+                discovered[k] = next[k] & ~seen[k];
+            next = bitset{};
+            if(!any(discovered)) continue;
+            if(!any(seen)) _reached_vertices.push_back(w);
+            for(std::size_t k = 0; k < _Traits::num_words; ++k)
+                seen[k] |= discovered[k];
+            _frontier_map[w] = discovered;
+            _frontier.push_back(w);
+            if constexpr(_Traits::store_distances)
+                for_each_source(discovered, w,
+                                [this](const std::size_t i, const vertex & v) {
+                                    _dist_map[v][i] = _level;
+                                });
+            for_each_source(discovered, w,
+                            [this, &f](const std::size_t i, const vertex & v) {
+                                f(i, v, _level);
+                            });
+        }
+    }
+
+public:
+    // Reaches the vertices at distance level + 1 of the sources.
+    constexpr void advance() {
+        advance([](const std::size_t, const vertex &, const int) {});
+    }
+    constexpr void run() {
+        while(!finished()) advance();
+    }
+    // Calls f(i, u, d) for every vertex u at distance d of the ith source,
+    // including the sources themselves at distance 0, by increasing d.
+    template <typename F>
+        requires std::invocable<F, std::size_t, vertex, int>
+    constexpr void run(F && f) {
+        if(_level == 0)
+            for(auto && s : _frontier)
+                for_each_source(_frontier_map[s], s,
+                                [&f](const std::size_t i, const vertex & v) {
+                                    f(i, v, 0);
+                                });
+        while(!finished()) advance(f);
+    }
+
+    [[nodiscard]] constexpr bool reached(const std::size_t i,
+                                         const vertex & u) const noexcept {
+        assert(i < _num_sources);
+        return (_seen_map[u][i / 64] >> (i % 64)) & 1;
+    }
+    [[nodiscard]] constexpr int dist(const std::size_t i,
+                                     const vertex & u) const noexcept
+        requires(_Traits::store_distances)
+    {
+        assert(reached(i, u));
+        return _dist_map[u][i];
+    }
+};
+
+template <typename _Graph,
+          typename _Traits = multi_source_breadth_first_search_default_traits>
+multi_source_breadth_first_search(_Graph &&)
+    -> multi_source_breadth_first_search<views::graph_all_t<_Graph>, _Traits>;
+
+template <typename _Graph, std::ranges::input_range _Sources,
+          typename _Traits = multi_source_breadth_first_search_default_traits>
+multi_source_breadth_first_search(_Graph &&, _Sources &&)
+    -> multi_source_breadth_first_search<views::graph_all_t<_Graph>, _Traits>;
+
+template <typename _Graph, typename _Traits>
+multi_source_breadth_first_search(_Traits, _Graph &&)
+    -> multi_source_breadth_first_search<views::graph_all_t<_Graph>, _Traits>;
+
+template <typename _Graph, std::ranges::input_range _Sources,
+          typename _Traits>
+multi_source_breadth_first_search(_Traits, _Graph &&, _Sources &&)
+    -> multi_source_breadth_first_search<views::graph_all_t<_Graph>, _Traits>;
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_MULTI_SOURCE_BFS_HPP
@@ -0,0 +1,326 @@
+#ifndef MELON_ALGORITHM_MULTICRITERIA_DIJKSTRA_HPP
+#define MELON_ALGORITHM_MULTICRITERIA_DIJKSTRA_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "melon/container/d_ary_heap.hpp"
+#include "melon/detail/intrusive_view.hpp"
+#include "melon/detail/prefetch.hpp"
+#include "melon/graph.hpp"
+#include "melon/mapping.hpp"
+#include "melon/utility/algorithmic_generator.hpp"
+#include "melon/utility/priority_queue.hpp"
+#include "melon/utility/semiring.hpp"
+#include "melon/views/graph_view.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// clang-format off
+template <typename _Traits>
+concept multicriteria_dijkstra_trait =
+    pareto_semiring<typename _Traits::semiring> &&
+    priority_queue<typename _Traits::heap>;
+// clang-format on
+
+template <typename _ValueType>
+struct multicriteria_dijkstra_default_traits {
+    using semiring = pareto_shortest_path_semiring<_ValueType>;
+    using heap = d_ary_heap<2, std::pair<std::size_t, _ValueType>,
+                            typename semiring::less_t, views::get_map<1>>;
+};
+
+// Martins label-setting algorithm : every vertex has a bag of the lengths of
+// its non dominated paths found so far, and the labels are settled by
+// increasing semiring::less, i.e. lexicographically, such that every settled
+// label is Pareto optimal. The labels dominated by a new one are lazily
+// discarded from the heap. Once the search finished, the bag of every vertex
+// holds its Pareto front.
+//
+// The labels are stored in a single array, and the bags are blocks of a
+// single array of (length, label id) entries, such that scanning a bag for
+// dominance reads contiguous memory without any per vertex allocation. A bag
+// that outgrows its block is moved to a new block of twice its capacity at
+// the end of the array, and the freed blocks are reclaimed by reset().
+template <outward_incidence_graph _Graph,
+          input_mapping<arc_t<_Graph>> _LengthMap,
+          multicriteria_dijkstra_trait _Traits>
+    requires has_vertex_map<_Graph>
+class multicriteria_dijkstra {
+private:
+    using vertex = vertex_t<_Graph>;
+    using arc = arc_t<_Graph>;
+
+    using length_type = mapped_value_t<_LengthMap, arc_t<_Graph>>;
+    using traversal_entry = std::pair<vertex, length_type>;
+
+    using label_id = std::size_t;
+    static constexpr label_id no_label = std::numeric_limits<label_id>::max();
+
+    struct label {
+        vertex head;
+        label_id pred_label;
+        std::optional<arc> pred_arc;
+        bool dominated;
+    };
+    struct bag_entry {
+        length_type length;
+        label_id id;
+    };
+    struct bag_block {
+        std::size_t begin;
+        std::size_t size;
+        std::size_t capacity;
+    };
+    static constexpr std::size_t initial_bag_capacity = 4;
+
+    using heap = _Traits::heap;
+    using semiring = _Traits::semiring;
+
+    static_assert(std::is_same_v<typename heap::value_type,
+                                 std::pair<label_id, length_type>>,
+                  "multicriteria_dijkstra requires heap entries type.");
+
+private:
+    _Graph _graph;
+    _LengthMap _length_map;
+    heap _heap;
+    std::vector<label> _labels;
+    vertex_map_t<_Graph, bag_block> _bags;
+    std::vector<bag_entry> _bag_entries;
+    std::vector<vertex> _touched_vertices;
+    std::optional<vertex> _target;
+
+public:
+    template <typename _G, typename _M>
+    [[nodiscard]] constexpr multicriteria_dijkstra(_G && g, _M && l)
+        : _graph(views::graph_all(std::forward<_G>(g)))
+        , _length_map(views::mapping_all(std::forward<_M>(l)))
+        , _heap()
+        , _labels()
+        , _bags(create_vertex_map<bag_block>(_graph, bag_block{0, 0, 0}))
+        , _bag_entries()
+        , _touched_vertices()
+        , _target() {}
+
+    template <typename _G, typename _M>
+    [[nodiscard]] constexpr multicriteria_dijkstra(_G && g, _M && l,
+                                                   const vertex & s)
+        : multicriteria_dijkstra(std::forward<_G>(g), std::forward<_M>(l)) {
+        add_source(s);
+    }
+
+    template <typename... _Args>
+    [[nodiscard]] constexpr multicriteria_dijkstra(_Traits, _Args &&... args)
+        : multicriteria_dijkstra(std::forward<_Args>(args)...) {}
+
+    [[nodiscard]] constexpr multicriteria_dijkstra(
+        const multicriteria_dijkstra &) = default;
+    [[nodiscard]] constexpr multicriteria_dijkstra(multicriteria_dijkstra &&) =
+        default;
+
+    constexpr multicriteria_dijkstra & operator=(
+        const multicriteria_dijkstra &) = default;
+    constexpr multicriteria_dijkstra & operator=(multicriteria_dijkstra &&) =
+        default;
+
+    // Clears the bags of the reached vertices only.
+    constexpr multicriteria_dijkstra & reset() noexcept {
+        _heap.clear();
+        _labels.resize(0);
+        for(auto && u : _touched_vertices) _bags[u] = bag_block{0, 0, 0};
+        _touched_vertices.resize(0);
+        _bag_entries.resize(0);
+        return *this;
+    }
+    // Discards the labels dominated by a label of t, that cannot extend to a
+    // Pareto optimal path to t. The other Pareto fronts are then incomplete.
+    constexpr multicriteria_dijkstra & set_target(const vertex & t) noexcept {
+        _target.emplace(t);
+        return *this;
+    }
+    constexpr multicriteria_dijkstra & unset_target() noexcept {
+        _target.reset();
+        return *this;
+    }
+    constexpr multicriteria_dijkstra & add_source(
+        const vertex & s,
+        const length_type & length = semiring::zero) noexcept {
+        insert_label(s, length, no_label, std::nullopt);
+        discard_dominated_top();
+        return *this;
+    }
+
+    [[nodiscard]] constexpr bool finished() const noexcept {
+        return _heap.empty();
+    }
+
+    [[nodiscard]] constexpr traversal_entry current() const noexcept {
+        assert(!finished());
+        const auto && [id, length] = _heap.top();
+        return std::make_pair(_labels[id].head, length);
+    }
+
+private:
+    [[nodiscard]] constexpr std::span<const bag_entry> bag(
+        const vertex & u) const noexcept {
+        const bag_block & block = _bags[u];
+        return std::span<const bag_entry>(_bag_entries.data() + block.begin,
+                                          block.size);
+    }
+    [[nodiscard]] constexpr bool dominated_in(
+        const vertex & u, const length_type & length) const noexcept {
+        return std::ranges::any_of(bag(u), [&length](const bag_entry & e) {
+            return semiring::dominates(e.length, length);
+        });
+    }
+    // Removes the entries of the bag of u dominated by length, which can only
+    // be unsettled labels, and marks their labels as dominated.
+    constexpr void remove_dominated(const vertex & u,
+                                    const length_type & length) noexcept {
+        bag_block & block = _bags[u];
+        const auto first = _bag_entries.begin() +
+                           static_cast<std::ptrdiff_t>(block.begin);
+        const auto last = first + static_cast<std::ptrdiff_t>(block.size);
+        const auto new_last =
+            std::remove_if(first, last, [this, &length](const bag_entry & e) {
+                if(!semiring::dominates(length, e.length)) return false;
+                _labels[e.id].dominated = true;
+                return true;
+            });
+        block.size = static_cast<std::size_t>(new_last - first);
+    }
+    constexpr void push_to_bag(const vertex & u, bag_entry && entry) {
+        bag_block & block = _bags[u];
+        if(block.size == block.capacity) {
+            const std::size_t begin = _bag_entries.size();
+            const std::size_t capacity =
+                std::max(initial_bag_capacity, 2 * block.capacity);
+            _bag_entries.resize(begin + capacity);
+            for(std::size_t i = 0; i < block.size; ++i)
+                _bag_entries[begin + i] =
+                    std::move(_bag_entries[block.begin + i]);
+            block.begin = begin;
+            block.capacity = capacity;
+        }
+        _bag_entries[block.begin + block.size] = std::move(entry);
+        ++block.size;
+    }
+    constexpr void insert_label(const vertex & w, const length_type & length,
+                                const label_id pred_label,
+                                const std::optional<arc> & pred_arc) noexcept {
+        if(_target.has_value() && dominated_in(_target.value(), length))
+            return;
+        if(_bags[w].size == 0) {
+            _touched_vertices.push_back(w);
+        } else {
+            if(dominated_in(w, length)) return;
+            remove_dominated(w, length);
+        }
+        const label_id id = _labels.size();
+        _labels.push_back(label{w, pred_label, pred_arc, false});
+        push_to_bag(w, bag_entry{length, id});
+        _heap.push(std::make_pair(id, length));
+    }
+    constexpr void discard_dominated_top() noexcept {
+        while(!_heap.empty() && _labels[_heap.top().first].dominated)
+            _heap.pop();
+    }
+
+public:
+    constexpr void advance() noexcept {
+        assert(!finished());
+        const auto [id, length] = _heap.top();
+        const vertex t = _labels[id].head;
+        auto && out_arcs_range = melon::out_arcs(_graph, t);
+        prefetch_range(out_arcs_range);
+        prefetch_mapped_values(out_arcs_range, arc_targets_map(_graph));
+        prefetch_mapped_values(out_arcs_range, _length_map);
+        _heap.pop();
+        for(const arc & a : out_arcs_range)
+            insert_label(melon::arc_target(_graph, a),
+                         semiring::plus(length, _length_map[a]), id, a);
+        discard_dominated_top();
+    }
+
+    constexpr void run() noexcept {
+        while(!finished()) advance();
+    }
+    [[nodiscard]] constexpr auto begin() noexcept {
+        return algorithm_iterator(*this);
+    }
+    [[nodiscard]] constexpr auto end() noexcept {
+        return algorithm_end_sentinel();
+    }
+
+    [[nodiscard]] constexpr bool reached(const vertex & u) const noexcept {
+        return _bags[u].size > 0;
+    }
+    // Lengths of the Pareto optimal paths to u, in no particular order.
+    [[nodiscard]] constexpr auto pareto_front(const vertex & u) const noexcept {
+        assert(finished());
+        return std::views::transform(
+            bag(u),
+            [](const bag_entry & e) -> length_type { return e.length; });
+    }
+    [[nodiscard]] constexpr std::size_t pareto_front_size(
+        const vertex & u) const noexcept {
+        assert(finished());
+        return _bags[u].size;
+    }
+    // Arcs of the path to u of length pareto_front(u)[i], from u backward.
+    [[nodiscard]] constexpr auto path_to(const vertex & u,
+                                         const std::size_t i) const noexcept {
+        assert(finished() && i < _bags[u].size);
+        return intrusive_view(
+            bag(u)[i].id,
+            [this](const label_id & id) -> arc {
+                return _labels[id].pred_arc.value();
+            },
+            [this](const label_id & id) -> label_id {
+                return _labels[id].pred_label;
+            },
+            [this](const label_id & id) -> bool {
+                return _labels[id].pred_arc.has_value();
+            });
+    }
+};
+
+template <typename _Graph, typename _LengthMap,
+          typename _Traits = multicriteria_dijkstra_default_traits<
+              mapped_value_t<_LengthMap, arc_t<_Graph>>>>
+multicriteria_dijkstra(_Graph &&, _LengthMap &&)
+    -> multicriteria_dijkstra<views::graph_all_t<_Graph>,
+                              views::mapping_all_t<_LengthMap>, _Traits>;
+
+template <typename _Graph, typename _LengthMap,
+          typename _Traits = multicriteria_dijkstra_default_traits<
+              mapped_value_t<_LengthMap, arc_t<_Graph>>>>
+multicriteria_dijkstra(_Graph &&, _LengthMap &&, const vertex_t<_Graph> &)
+    -> multicriteria_dijkstra<views::graph_all_t<_Graph>,
+                              views::mapping_all_t<_LengthMap>, _Traits>;
+
+template <typename _Graph, typename _LengthMap, typename _Traits>
+multicriteria_dijkstra(_Traits, _Graph &&, _LengthMap &&)
+    -> multicriteria_dijkstra<views::graph_all_t<_Graph>,
+                              views::mapping_all_t<_LengthMap>, _Traits>;
+
+template <typename _Graph, typename _LengthMap, typename _Traits>
+multicriteria_dijkstra(_Traits, _Graph &&, _LengthMap &&,
+                       const vertex_t<_Graph> &)
+    -> multicriteria_dijkstra<views::graph_all_t<_Graph>,
+                              views::mapping_all_t<_LengthMap>, _Traits>;
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_MULTICRITERIA_DIJKSTRA_HPP
@@ -0,0 +1,224 @@
+#ifndef MELON_ALGORITHM_PARALLEL_BFS_HPP
+#define MELON_ALGORITHM_PARALLEL_BFS_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "melon/container/static_filter_map.hpp"
+#include "melon/detail/map_if.hpp"
+#include "melon/detail/parallel.hpp"
+#include "melon/graph.hpp"
+#include "melon/views/graph_view.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+struct parallel_breadth_first_search_default_traits {
+    static constexpr bool store_pred_vertices = false;
+    static constexpr bool store_distances = false;
+};
+
+// Level synchronous BFS whose levels are expanded by several threads.
+//
+// The threads share the frontier in contiguous chunks and claim the vertices
+// they reach by an atomic fetch_or in the reached bitmap, so that every vertex
+// is pushed, and its predecessor and distance written, by a single thread.
+// Each thread collects its claimed vertices in its own buffer and the buffers
+// are copied in parallel to the next frontier at the offsets given by the
+// prefix sums of their sizes.
+template <outward_adjacency_graph _Graph,
+          typename _Traits = parallel_breadth_first_search_default_traits>
+    requires has_num_vertices<_Graph> && has_vertex_map<_Graph> &&
+             std::integral<vertex_t<_Graph>>
+class parallel_breadth_first_search {
+private:
+    using vertex = vertex_t<_Graph>;
+
+    static constexpr std::size_t grain_size = 256;
+
+    _Graph _graph;
+    std::size_t _num_threads;
+    static_filter_map<vertex> _reached_map;
+    std::vector<vertex> _frontier;
+    std::vector<vertex> _next_frontier;
+    std::vector<std::vector<vertex>> _thread_buffers;
+    std::vector<std::size_t> _offsets;
+    int _level;
+
+    [[no_unique_address]] vertex_map_if<_Traits::store_pred_vertices, _Graph,
+                                        vertex> _pred_vertices_map;
+    [[no_unique_address]] vertex_map_if<_Traits::store_distances, _Graph, int>
+        _dist_map;
+
+public:
+    template <typename _G>
+    [[nodiscard]] parallel_breadth_first_search(const parallel_policy & policy,
+                                                _G && g)
+        : _graph(views::graph_all(std::forward<_G>(g)))
+        , _num_threads(detail::num_threads(policy))
+        , _reached_map(num_vertices(_graph), false)
+        , _frontier()
+        , _next_frontier()
+        , _thread_buffers(_num_threads)
+        , _offsets(_num_threads + 1)
+        , _level(0)
+        , _pred_vertices_map(_graph)
+        , _dist_map(_graph) {
+        _frontier.reserve(num_vertices(_graph));
+        _next_frontier.reserve(num_vertices(_graph));
+    }
+
+    template <typename _G>
+    [[nodiscard]] parallel_breadth_first_search(const parallel_policy & policy,
+                                                _G && g, const vertex & s)
+        : parallel_breadth_first_search(policy, std::forward<_G>(g)) {
+        add_source(s);
+    }
+
+    template <typename _G>
+    [[nodiscard]] explicit parallel_breadth_first_search(_G && g)
+        : parallel_breadth_first_search(parallel_policy{1},
+                                        std::forward<_G>(g)) {}
+
+    template <typename _G>
+    [[nodiscard]] parallel_breadth_first_search(_G && g, const vertex & s)
+        : parallel_breadth_first_search(parallel_policy{1},
+                                        std::forward<_G>(g), s) {}
+
+    template <typename... _Args>
+    [[nodiscard]] parallel_breadth_first_search(_Traits, _Args &&... args)
+        : parallel_breadth_first_search(std::forward<_Args>(args)...) {}
+
+    [[nodiscard]] parallel_breadth_first_search(
+        const parallel_breadth_first_search &) = default;
+    [[nodiscard]] parallel_breadth_first_search(
+        parallel_breadth_first_search &&) = default;
+
+    parallel_breadth_first_search & operator=(
+        const parallel_breadth_first_search &) = default;
+    parallel_breadth_first_search & operator=(
+        parallel_breadth_first_search &&) = default;
+
+    parallel_breadth_first_search & reset() noexcept {
+        _reached_map.fill(false);
+        _frontier.resize(0);
+        _level = 0;
+        return *this;
+    }
+    parallel_breadth_first_search & add_source(const vertex & s) noexcept {
+        assert(!_reached_map[s]);
+        assert(_level == 0);
+        _frontier.push_back(s);
+        _reached_map[s] = true;
+        if constexpr(_Traits::store_pred_vertices) _pred_vertices_map[s] = s;
+        if constexpr(_Traits::store_distances) _dist_map[s] = 0;
+        return *this;
+    }
+
+    [[nodiscard]] bool finished() const noexcept { return _frontier.empty(); }
+
+    // Expands the whole frontier, i.e. reaches the vertices at distance
+    // level + 1 of the sources.
+    void advance() {
+        assert(!finished());
+        const std::size_t num_chunks = std::max(
+            std::size_t{1},
+            std::min(_num_threads, _frontier.size() / grain_size));
+        detail::parallel_for_chunks(
+            num_chunks, _frontier.size(),
+            [this](const std::size_t c, std::size_t begin,
+                   const std::size_t end) {
+                std::vector<vertex> & buffer = _thread_buffers[c];
+                buffer.resize(0);
+                for(; begin < end; ++begin) {
+                    const vertex & u = _frontier[begin];
+                    for(auto && w : out_neighbors(_graph, u)) {
+                        if(_reached_map.atomic_test_and_set(w)) continue;
+                        if constexpr(_Traits::store_pred_vertices)
+                            _pred_vertices_map[w] = u;
+                        if constexpr(_Traits::store_distances)
+                            _dist_map[w] = _level + 1;
+                        buffer.push_back(w);
+                    }
+                }
+            });
+        for(std::size_t c = 0; c < num_chunks; ++c)
+            _offsets[c + 1] = _offsets[c] + _thread_buffers[c].size();
+        _next_frontier.resize(_offsets[num_chunks]);
+        detail::parallel_for(num_chunks, num_chunks, [this](std::size_t c) {
+            std::ranges::copy(_thread_buffers[c],
+                              _next_frontier.begin() +
+                                  static_cast<std::ptrdiff_t>(_offsets[c]));
+        });
+        std::swap(_frontier, _next_frontier);
+        ++_level;
+    }
+
+    void run() {
+        while(!finished()) advance();
+    }
+
+    [[nodiscard]] bool reached(const vertex & u) const noexcept {
+        return _reached_map[u];
+    }
+
+    [[nodiscard]] vertex pred_vertex(const vertex & u) const noexcept
+        requires(_Traits::store_pred_vertices)
+    {
+        assert(reached(u));
+        return _pred_vertices_map[u];
+    }
+    [[nodiscard]] int dist(const vertex & u) const noexcept
+        requires(_Traits::store_distances)
+    {
+        assert(reached(u));
+        return _dist_map[u];
+    }
+};
+
+template <typename _Graph,
+          typename _Traits = parallel_breadth_first_search_default_traits>
+parallel_breadth_first_search(_Graph &&)
+    -> parallel_breadth_first_search<views::graph_all_t<_Graph>, _Traits>;
+
+template <typename _Graph,
+          typename _Traits = parallel_breadth_first_search_default_traits>
+parallel_breadth_first_search(_Graph &&, const vertex_t<_Graph> &)
+    -> parallel_breadth_first_search<views::graph_all_t<_Graph>, _Traits>;
+
+template <typename _Graph,
+          typename _Traits = parallel_breadth_first_search_default_traits>
+parallel_breadth_first_search(const parallel_policy &, _Graph &&)
+    -> parallel_breadth_first_search<views::graph_all_t<_Graph>, _Traits>;
+
+template <typename _Graph,
+          typename _Traits = parallel_breadth_first_search_default_traits>
+parallel_breadth_first_search(const parallel_policy &, _Graph &&,
+                              const vertex_t<_Graph> &)
+    -> parallel_breadth_first_search<views::graph_all_t<_Graph>, _Traits>;
+
+template <typename _Graph, typename _Traits>
+parallel_breadth_first_search(_Traits, _Graph &&)
+    -> parallel_breadth_first_search<views::graph_all_t<_Graph>, _Traits>;
+
+template <typename _Graph, typename _Traits>
+parallel_breadth_first_search(_Traits, _Graph &&, const vertex_t<_Graph> &)
+    -> parallel_breadth_first_search<views::graph_all_t<_Graph>, _Traits>;
+
+template <typename _Graph, typename _Traits>
+parallel_breadth_first_search(_Traits, const parallel_policy &, _Graph &&)
+    -> parallel_breadth_first_search<views::graph_all_t<_Graph>, _Traits>;
+
+template <typename _Graph, typename _Traits>
+parallel_breadth_first_search(_Traits, const parallel_policy &, _Graph &&,
+                              const vertex_t<_Graph> &)
+    -> parallel_breadth_first_search<views::graph_all_t<_Graph>, _Traits>;
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_PARALLEL_BFS_HPP
@@ -0,0 +1,350 @@
+#ifndef MELON_ALGORITHM_PARALLEL_STRONGLY_CONNECTED_COMPONENTS_HPP
+#define MELON_ALGORITHM_PARALLEL_STRONGLY_CONNECTED_COMPONENTS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "melon/container/static_filter_map.hpp"
+#include "melon/container/static_map.hpp"
+#include "melon/detail/parallel.hpp"
+#include "melon/graph.hpp"
+#include "melon/views/graph_view.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Multistep parallel strongly connected components (Slota et al. 2014).
+//
+// 1. Trimming : a vertex without remaining in or out neighbors is a
+//    component on its own. Every vertex counts its remaining in and out
+//    neighbors, and removing a component decrements the counts of the
+//    neighbors of its vertices, which makes trimming cost O(|A|) overall.
+// 2. Forward-backward : the component of a pivot of large in and out degrees,
+//    usually the giant component, is the set of vertices reached by a parallel
+//    backward BFS restricted to the vertices reached by a parallel forward
+//    BFS.
+// 3. Coloring : every remaining vertex takes the largest index of the vertices
+//    that reach it, by parallel forward propagation, and the component of each
+//    vertex r of color r is the set of vertices of color r reaching r, found
+//    by a backward BFS per root, the roots being shared among the threads.
+//    Colorings are repeated, with trimming in between, until every vertex is
+//    in a component.
+//
+// Component numbers are dense but follow no particular order.
+template <outward_adjacency_graph _Graph>
+    requires inward_adjacency_graph<_Graph> && has_num_vertices<_Graph> &&
+             std::integral<vertex_t<_Graph>>
+class parallel_strongly_connected_components {
+public:
+    using component_num = unsigned int;
+
+private:
+    using vertex = vertex_t<_Graph>;
+
+    static constexpr component_num INVALID_COMPONENT =
+        std::numeric_limits<component_num>::max();
+    static constexpr std::size_t grain_size = 256;
+
+    _Graph _graph;
+    std::size_t _num_threads;
+    static_map<vertex, component_num> _component_map;
+    std::vector<std::size_t> _component_sizes;
+
+    std::vector<vertex> _active;
+    static_map<vertex, std::size_t> _in_count_map;
+    static_map<vertex, std::size_t> _out_count_map;
+    static_filter_map<vertex> _trimmed_map;
+    static_filter_map<vertex> _forward_map;
+    static_filter_map<vertex> _backward_map;
+    static_map<vertex, vertex> _color_map;
+    static_filter_map<vertex> _recolored_map;
+    std::vector<std::vector<vertex>> _thread_buffers;
+    std::vector<std::size_t> _offsets;
+
+public:
+    template <typename _G>
+    [[nodiscard]] parallel_strongly_connected_components(
+        const parallel_policy & policy, _G && g)
+        : _graph(views::graph_all(std::forward<_G>(g)))
+        , _num_threads(detail::num_threads(policy))
+        , _component_map(num_vertices(_graph))
+        , _component_sizes()
+        , _active()
+        , _in_count_map(num_vertices(_graph))
+        , _out_count_map(num_vertices(_graph))
+        , _trimmed_map(num_vertices(_graph))
+        , _forward_map(num_vertices(_graph))
+        , _backward_map(num_vertices(_graph))
+        , _color_map(num_vertices(_graph))
+        , _recolored_map(num_vertices(_graph))
+        , _thread_buffers(_num_threads)
+        , _offsets(_num_threads + 1) {}
+
+    template <typename _G>
+    [[nodiscard]] explicit parallel_strongly_connected_components(_G && g)
+        : parallel_strongly_connected_components(parallel_policy{1},
+                                                 std::forward<_G>(g)) {}
+
+    [[nodiscard]] parallel_strongly_connected_components(
+        const parallel_strongly_connected_components &) = default;
+    [[nodiscard]] parallel_strongly_connected_components(
+        parallel_strongly_connected_components &&) = default;
+
+    parallel_strongly_connected_components & operator=(
+        const parallel_strongly_connected_components &) = default;
+    parallel_strongly_connected_components & operator=(
+        parallel_strongly_connected_components &&) = default;
+
+private:
+    [[nodiscard]] bool active(const vertex & u) const noexcept {
+        return _component_map[u] == INVALID_COMPONENT;
+    }
+
+    [[nodiscard]] std::size_t num_chunks(const std::size_t n) const noexcept {
+        return std::max(std::size_t{1}, std::min(_num_threads, n / grain_size));
+    }
+    // Calls f(buffer, u) for every u of the vertices, in parallel, where
+    // buffer is the vertex buffer of the thread, and returns the
+    // concatenation of the buffers.
+    template <typename F>
+    std::vector<vertex> parallel_collect(const std::vector<vertex> & vertices,
+                                         F && f) {
+        const std::size_t chunks = num_chunks(vertices.size());
+        detail::parallel_for_chunks(
+            chunks, vertices.size(),
+            [&](const std::size_t c, std::size_t begin, const std::size_t end) {
+                std::vector<vertex> & buffer = _thread_buffers[c];
+                buffer.resize(0);
+                for(; begin < end; ++begin) f(buffer, vertices[begin]);
+            });
+        for(std::size_t c = 0; c < chunks; ++c)
+            _offsets[c + 1] = _offsets[c] + _thread_buffers[c].size();
+        std::vector<vertex> collected(_offsets[chunks]);
+        detail::parallel_for(chunks, chunks, [&](const std::size_t c) {
+            std::ranges::copy(_thread_buffers[c],
+                              collected.begin() +
+                                  static_cast<std::ptrdiff_t>(_offsets[c]));
+        });
+        return collected;
+    }
+
+    // Level synchronous parallel BFS from s through the neighbors w given by
+    // the neighbors function that satisfy the filter, claiming the reached
+    // vertices in the reached bitmap, and returns them.
+    template <typename N, typename F>
+    std::vector<vertex> parallel_reach(const vertex & s,
+                                       static_filter_map<vertex> & reached,
+                                       N && neighbors, F && filter) {
+        std::vector<vertex> visited = {s};
+        std::vector<vertex> frontier = {s};
+        reached[s] = true;
+        while(!frontier.empty()) {
+            frontier = parallel_collect(
+                frontier, [&](std::vector<vertex> & buffer, const vertex & u) {
+                    for(auto && w : neighbors(u)) {
+                        if(!filter(w) || reached.atomic_test_and_set(w))
+                            continue;
+                        buffer.push_back(w);
+                    }
+                });
+            visited.insert(visited.end(), frontier.begin(), frontier.end());
+        }
+        return visited;
+    }
+
+    void new_component(const vertex & u) noexcept {
+        _component_map[u] = static_cast<component_num>(_component_sizes.size());
+        _component_sizes.push_back(1);
+    }
+
+    // Decrements the counts of the remaining neighbors of the vertices that
+    // have just been given a component and returns the neighbors left without
+    // in or out neighbors.
+    std::vector<vertex> remove(const std::vector<vertex> & vertices) {
+        const auto decrement = [this](std::vector<vertex> & buffer,
+                                      static_map<vertex, std::size_t> & counts,
+                                      const vertex & w) {
+            if(std::atomic_ref<std::size_t>(counts[w]).fetch_sub(
+                   1, std::memory_order_relaxed) == 1 &&
+               !_trimmed_map.atomic_test_and_set(w))
+                buffer.push_back(w);
+        };
+        return parallel_collect(
+            vertices, [&](std::vector<vertex> & buffer, const vertex & u) {
+                for(auto && w : out_neighbors(_graph, u))
+                    if(w != u && active(w))
+                        decrement(buffer, _in_count_map, w);
+                for(auto && w : in_neighbors(_graph, u))
+                    if(w != u && active(w))
+                        decrement(buffer, _out_count_map, w);
+            });
+    }
+
+    void trim(std::vector<vertex> && trimmed) {
+        while(!trimmed.empty()) {
+            for(auto && u : trimmed) new_component(u);
+            trimmed = remove(trimmed);
+        }
+    }
+
+    void remove_inactive() {
+        std::erase_if(_active, [this](const vertex & u) { return !active(u); });
+    }
+
+    void init() {
+        _component_map.fill(INVALID_COMPONENT);
+        _component_sizes.resize(0);
+        _trimmed_map.fill(false);
+        _recolored_map.fill(false);
+        _active.resize(0);
+        for(auto && u : vertices(_graph)) _active.push_back(u);
+        trim(parallel_collect(
+            _active, [this](std::vector<vertex> & buffer, const vertex & u) {
+                std::size_t in_count = 0, out_count = 0;
+                for(auto && w : out_neighbors(_graph, u))
+                    out_count += static_cast<std::size_t>(w != u);
+                for(auto && w : in_neighbors(_graph, u))
+                    in_count += static_cast<std::size_t>(w != u);
+                _in_count_map[u] = in_count;
+                _out_count_map[u] = out_count;
+                if(in_count > 0 && out_count > 0) return;
+                _trimmed_map.atomic_test_and_set(u);
+                buffer.push_back(u);
+            }));
+        remove_inactive();
+    }
+
+    void forward_backward() {
+        vertex pivot = _active.front();
+        std::size_t pivot_score = 0;
+        for(auto && u : _active) {
+            const std::size_t score = _in_count_map[u] * _out_count_map[u];
+            if(score <= pivot_score) continue;
+            pivot = u;
+            pivot_score = score;
+        }
+        _forward_map.fill(false);
+        _backward_map.fill(false);
+        parallel_reach(
+            pivot, _forward_map,
+            [this](const vertex & u) { return out_neighbors(_graph, u); },
+            [this](const vertex & w) { return active(w); });
+        const std::vector<vertex> component = parallel_reach(
+            pivot, _backward_map,
+            [this](const vertex & u) { return in_neighbors(_graph, u); },
+            [this](const vertex & w) {
+                return _forward_map[w] && active(w);
+            });
+        const component_num c =
+            static_cast<component_num>(_component_sizes.size());
+        _component_sizes.push_back(component.size());
+        for(auto && u : component) _component_map[u] = c;
+        trim(remove(component));
+        remove_inactive();
+    }
+
+    void coloring() {
+        detail::parallel_for(_num_threads, _active.size(),
+                             [this](const std::size_t i) {
+                                 _color_map[_active[i]] = _active[i];
+                             });
+        std::vector<vertex> recolored = _active;
+        while(!recolored.empty()) {
+            recolored = parallel_collect(
+                recolored,
+                [this](std::vector<vertex> & buffer, const vertex & u) {
+                    const vertex color = std::atomic_ref<vertex>(_color_map[u])
+                                             .load(std::memory_order_relaxed);
+                    for(auto && w : out_neighbors(_graph, u)) {
+                        if(!active(w)) continue;
+                        std::atomic_ref<vertex> w_color(_color_map[w]);
+                        vertex old_color =
+                            w_color.load(std::memory_order_relaxed);
+                        bool raised = false;
+                        while(old_color < color && !raised)
+                            raised = w_color.compare_exchange_weak(
+                                old_color, color, std::memory_order_relaxed);
+                        if(raised && !_recolored_map.atomic_test_and_set(w))
+                            buffer.push_back(w);
+                    }
+                });
+            for(auto && w : recolored) _recolored_map[w] = false;
+        }
+
+        const std::vector<vertex> roots = parallel_collect(
+            _active, [this](std::vector<vertex> & buffer, const vertex & u) {
+                if(_color_map[u] == u) buffer.push_back(u);
+            });
+        const component_num first_component =
+            static_cast<component_num>(_component_sizes.size());
+        _component_sizes.resize(_component_sizes.size() + roots.size());
+        // the roots are shared among the threads, each one running sequential
+        // backward BFSs, which only touch the vertices of the root color, and
+        // are sorted since _active is, so that lower_bound gives their index
+        const std::vector<vertex> components = parallel_collect(
+            roots, [&](std::vector<vertex> & buffer, const vertex & r) {
+                const component_num c = static_cast<component_num>(
+                    first_component +
+                    static_cast<std::size_t>(
+                        std::ranges::lower_bound(roots, r) - roots.begin()));
+                const std::size_t first = buffer.size();
+                buffer.push_back(r);
+                _component_map[r] = c;
+                for(std::size_t i = first; i < buffer.size(); ++i) {
+                    for(auto && w : in_neighbors(_graph, buffer[i])) {
+                        if(_color_map[w] != r || !active(w)) continue;
+                        _component_map[w] = c;
+                        buffer.push_back(w);
+                    }
+                }
+                _component_sizes[c] = buffer.size() - first;
+            });
+        trim(remove(components));
+        remove_inactive();
+    }
+
+public:
+    void run() {
+        init();
+        if(!_active.empty()) forward_backward();
+        while(!_active.empty()) coloring();
+    }
+
+    [[nodiscard]] std::size_t num_components() const noexcept {
+        return _component_sizes.size();
+    }
+    [[nodiscard]] component_num component(const vertex & u) const noexcept {
+        assert(_component_map[u] != INVALID_COMPONENT);
+        return _component_map[u];
+    }
+    [[nodiscard]] bool same_component(const vertex & u,
+                                      const vertex & v) const noexcept {
+        return component(u) == component(v);
+    }
+    [[nodiscard]] const auto & components_map() const noexcept {
+        return _component_map;
+    }
+    [[nodiscard]] const std::vector<std::size_t> & component_sizes()
+        const noexcept {
+        return _component_sizes;
+    }
+};
+
+template <typename _Graph>
+parallel_strongly_connected_components(_Graph &&)
+    -> parallel_strongly_connected_components<views::graph_all_t<_Graph>>;
+
+template <typename _Graph>
+parallel_strongly_connected_components(const parallel_policy &, _Graph &&)
+    -> parallel_strongly_connected_components<views::graph_all_t<_Graph>>;
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_PARALLEL_STRONGLY_CONNECTED_COMPONENTS_HPP
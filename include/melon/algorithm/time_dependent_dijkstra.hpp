@@ -0,0 +1,444 @@
+#ifndef MELON_ALGORITHM_TIME_DEPENDENT_DIJKSTRA_HPP
+#define MELON_ALGORITHM_TIME_DEPENDENT_DIJKSTRA_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/d_ary_heap.hpp"
+#include "melon/detail/intrusive_view.hpp"
+#include "melon/detail/map_if.hpp"
+#include "melon/detail/prefetch.hpp"
+#include "melon/graph.hpp"
+#include "melon/mapping.hpp"
+#include "melon/utility/algorithmic_generator.hpp"
+#include "melon/utility/piecewise_linear_function.hpp"
+#include "melon/utility/priority_queue.hpp"
+#include "melon/utility/semiring.hpp"
+#include "melon/views/graph_view.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Maps the arcs to their travel time functions, invocable with the time at
+// which the arc is entered.
+template <typename _Map, typename _Arc, typename _Time>
+concept travel_time_mapping =
+    input_mapping<_Map, _Arc> &&
+    std::regular_invocable<const mapped_value_t<_Map, _Arc> &, const _Time &> &&
+    std::convertible_to<
+        std::invoke_result_t<const mapped_value_t<_Map, _Arc> &, const _Time &>,
+        _Time>;
+
+template <typename _Graph, typename _TimeType>
+using time_dependent_dijkstra_default_traits =
+    dijkstra_default_traits<_Graph, _TimeType>;
+
+// Earliest arrival times from given departure times, the travel time of an
+// arc being evaluated at the arrival time at its source. Since the travel
+// time functions are assumed to be FIFO, i.e. t + f(t) nondecreasing, the
+// vertices are settled by increasing earliest arrival time as in Dijkstra.
+template <outward_incidence_graph _Graph, typename _TravelTimeMap,
+          dijkstra_trait _Traits>
+    requires has_vertex_map<_Graph> &&
+             travel_time_mapping<_TravelTimeMap, arc_t<_Graph>,
+                                 typename _Traits::semiring::value_type>
+class time_dependent_dijkstra {
+private:
+    using vertex = vertex_t<_Graph>;
+    using arc = arc_t<_Graph>;
+
+    using time_type = typename _Traits::semiring::value_type;
+    using traversal_entry = std::pair<vertex, time_type>;
+
+    using heap = _Traits::heap;
+    enum vertex_status : char { PRE_HEAP = 0, IN_HEAP = 1, POST_HEAP = 2 };
+
+    static_assert(std::is_same_v<typename heap::value_type,
+                                 std::pair<vertex, time_type>>,
+                  "time_dependent_dijkstra requires heap entries type.");
+
+private:
+    _Graph _graph;
+    _TravelTimeMap _travel_time_map;
+    heap _heap;
+    vertex_map_t<_Graph, vertex_status> _vertex_status_map;
+
+    [[no_unique_address]] vertex_map_if<_Traits::store_paths &&
+                                            !has_arc_source<_Graph>,
+                                        _Graph, vertex> _pred_vertices_map;
+    [[no_unique_address]] vertex_map_if<_Traits::store_paths, _Graph,
+                                        std::optional<arc>> _pred_arcs_map;
+    [[no_unique_address]] vertex_map_if<_Traits::store_distances, _Graph,
+                                        time_type> _arrivals_map;
+
+public:
+    template <typename _G, typename _M>
+    [[nodiscard]] constexpr time_dependent_dijkstra(_G && g, _M && f)
+        : _graph(views::graph_all(std::forward<_G>(g)))
+        , _travel_time_map(views::mapping_all(std::forward<_M>(f)))
+        , _heap(typename _Traits::semiring::less_t(),
+                create_vertex_map<std::size_t>(_graph))
+        , _vertex_status_map(create_vertex_map<vertex_status>(_graph, PRE_HEAP))
+        , _pred_vertices_map(_graph)
+        , _pred_arcs_map(_graph)
+        , _arrivals_map(_graph) {}
+
+    template <typename _G, typename _M>
+    [[nodiscard]] constexpr time_dependent_dijkstra(_G && g, _M && f,
+                                                    const vertex & s,
+                                                    const time_type & t)
+        : time_dependent_dijkstra(std::forward<_G>(g), std::forward<_M>(f)) {
+        add_source(s, t);
+    }
+
+    template <typename... _Args>
+    [[nodiscard]] constexpr time_dependent_dijkstra(_Traits, _Args &&... args)
+        : time_dependent_dijkstra(std::forward<_Args>(args)...) {}
+
+    [[nodiscard]] constexpr time_dependent_dijkstra(
+        const time_dependent_dijkstra &) = default;
+    [[nodiscard]] constexpr time_dependent_dijkstra(
+        time_dependent_dijkstra &&) = default;
+
+    constexpr time_dependent_dijkstra & operator=(
+        const time_dependent_dijkstra &) = default;
+    constexpr time_dependent_dijkstra & operator=(time_dependent_dijkstra &&) =
+        default;
+
+    constexpr time_dependent_dijkstra & reset() noexcept {
+        _heap.clear();
+        _vertex_status_map.fill(PRE_HEAP);
+        return *this;
+    }
+    constexpr time_dependent_dijkstra & add_source(
+        const vertex & s,
+        const time_type & departure = _Traits::semiring::zero) noexcept {
+        assert(_vertex_status_map[s] != IN_HEAP);
+        _heap.push(std::make_pair(s, departure));
+        _vertex_status_map[s] = IN_HEAP;
+        if constexpr(_Traits::store_paths) {
+            _pred_arcs_map[s].reset();
+            if constexpr(!has_arc_source<_Graph>) _pred_vertices_map[s] = s;
+        }
+        return *this;
+    }
+
+    [[nodiscard]] constexpr bool finished() const noexcept {
+        return _heap.empty();
+    }
+
+    [[nodiscard]] constexpr traversal_entry current() const noexcept {
+        assert(!finished());
+        return _heap.top();
+    }
+
+    constexpr void advance() noexcept {
+        assert(!finished());
+        const auto [t, t_arrival] = _heap.top();
+        if constexpr(_Traits::store_distances) _arrivals_map[t] = t_arrival;
+        _vertex_status_map[t] = POST_HEAP;
+        auto && out_arcs_range = melon::out_arcs(_graph, t);
+        prefetch_range(out_arcs_range);
+        prefetch_mapped_values(out_arcs_range, arc_targets_map(_graph));
+        _heap.pop();
+        for(const arc & a : out_arcs_range) {
+            const vertex & w = melon::arc_target(_graph, a);
+            const vertex_status & w_status = _vertex_status_map[w];
+            if(w_status == POST_HEAP) continue;
+            const time_type w_arrival = _Traits::semiring::plus(
+                t_arrival,
+                static_cast<time_type>(_travel_time_map[a](t_arrival)));
+            if(w_status == IN_HEAP) {
+                if(!_Traits::semiring::less(w_arrival, _heap.priority(w)))
+                    continue;
+                _heap.promote(w, w_arrival);
+            } else {
+                _heap.push(std::make_pair(w, w_arrival));
+                _vertex_status_map[w] = IN_HEAP;
+            }
+            if constexpr(_Traits::store_paths) {
+                _pred_arcs_map[w].emplace(a);
+                if constexpr(!has_arc_source<_Graph>) _pred_vertices_map[w] = t;
+            }
+        }
+    }
+
+    constexpr void run() noexcept {
+        while(!finished()) advance();
+    }
+    // Runs the search until t is settled or cannot be reached.
+    constexpr void run_until(const vertex & t) noexcept {
+        while(!finished() && !visited(t)) advance();
+    }
+    [[nodiscard]] constexpr auto begin() noexcept {
+        return algorithm_iterator(*this);
+    }
+    [[nodiscard]] constexpr auto end() noexcept {
+        return algorithm_end_sentinel();
+    }
+
+    [[nodiscard]] constexpr bool reached(const vertex & u) const noexcept {
+        return _vertex_status_map[u] != PRE_HEAP;
+    }
+    [[nodiscard]] constexpr bool visited(const vertex & u) const noexcept {
+        return _vertex_status_map[u] == POST_HEAP;
+    }
+    [[nodiscard]] constexpr arc pred_arc(const vertex & u) const noexcept
+        requires(_Traits::store_paths)
+    {
+        assert(reached(u));
+        return _pred_arcs_map[u].value();
+    }
+    [[nodiscard]] constexpr vertex pred_vertex(const vertex & u) const noexcept
+        requires(_Traits::store_paths)
+    {
+        assert(reached(u) && _pred_arcs_map[u].has_value());
+        if constexpr(has_arc_source<_Graph>)
+            return melon::arc_source(_graph, pred_arc(u));
+        else
+            return _pred_vertices_map[u];
+    }
+    [[nodiscard]] constexpr time_type arrival(const vertex & u) const noexcept
+        requires(_Traits::store_distances)
+    {
+        assert(visited(u));
+        return _arrivals_map[u];
+    }
+
+    [[nodiscard]] constexpr auto path_to(const vertex & t) const noexcept
+        requires(_Traits::store_paths)
+    {
+        assert(reached(t));
+        return intrusive_view(
+            static_cast<vertex>(t),
+            [this](const vertex & v) -> arc {
+                return _pred_arcs_map[v].value();
+            },
+            [this](const vertex & v) -> vertex { return pred_vertex(v); },
+            [this](const vertex & v) -> bool {
+                return _pred_arcs_map[v].has_value();
+            });
+    }
+};
+
+template <typename _Graph, typename _TravelTimeMap,
+          typename _Traits = time_dependent_dijkstra_default_traits<
+              _Graph, typename mapped_value_t<_TravelTimeMap,
+                                              arc_t<_Graph>>::time_type>>
+time_dependent_dijkstra(_Graph &&, _TravelTimeMap &&)
+    -> time_dependent_dijkstra<views::graph_all_t<_Graph>,
+                               views::mapping_all_t<_TravelTimeMap>, _Traits>;
+
+template <typename _Graph, typename _TravelTimeMap, typename _TimeType,
+          typename _Traits = time_dependent_dijkstra_default_traits<
+              _Graph, typename mapped_value_t<_TravelTimeMap,
+                                              arc_t<_Graph>>::time_type>>
+time_dependent_dijkstra(_Graph &&, _TravelTimeMap &&, const vertex_t<_Graph> &,
+                        const _TimeType &)
+    -> time_dependent_dijkstra<views::graph_all_t<_Graph>,
+                               views::mapping_all_t<_TravelTimeMap>, _Traits>;
+
+template <typename _Graph, typename _TravelTimeMap, typename _Traits>
+time_dependent_dijkstra(_Traits, _Graph &&, _TravelTimeMap &&)
+    -> time_dependent_dijkstra<views::graph_all_t<_Graph>,
+                               views::mapping_all_t<_TravelTimeMap>, _Traits>;
+
+template <typename _Graph, typename _TravelTimeMap, typename _TimeType,
+          typename _Traits>
+time_dependent_dijkstra(_Traits, _Graph &&, _TravelTimeMap &&,
+                        const vertex_t<_Graph> &, const _TimeType &)
+    -> time_dependent_dijkstra<views::graph_all_t<_Graph>,
+                               views::mapping_all_t<_TravelTimeMap>, _Traits>;
+
+template <typename _Graph, typename _TimeType>
+struct time_dependent_profile_search_default_traits {
+    using semiring = shortest_path_semiring<_TimeType>;
+    using heap =
+        updatable_d_ary_heap<2, std::pair<vertex_t<_Graph>, _TimeType>,
+                             typename semiring::less_t,
+                             vertex_map_t<_Graph, std::size_t>,
+                             views::get_map<1>, views::get_map<0>>;
+};
+
+// Profile search : computes, for every vertex u, the travel time function
+// from the source to u, i.e. the travel time of the fastest path for every
+// departure time. It is a label-correcting algorithm on piecewise linear
+// functions, which links the profile of a vertex with the travel time
+// functions of its outgoing arcs and merges the results by pointwise minimum,
+// vertices being scanned by increasing minimum travel time and scanned again
+// when their profile improves. Intended for floating-point times, integral
+// times rounding the breakpoints of the linked functions.
+template <outward_incidence_graph _Graph, typename _TravelTimeMap,
+          typename _Traits>
+    requires has_vertex_map<_Graph> &&
+             updatable_priority_queue<typename _Traits::heap>
+class time_dependent_profile_search {
+private:
+    using vertex = vertex_t<_Graph>;
+    using arc = arc_t<_Graph>;
+
+    using time_type = typename _Traits::semiring::value_type;
+    using profile_type = piecewise_linear_function<time_type>;
+    using traversal_entry = std::pair<vertex, time_type>;
+
+    using heap = _Traits::heap;
+    enum vertex_status : char { PRE_HEAP = 0, IN_HEAP = 1, POST_HEAP = 2 };
+
+    static_assert(piecewise_linear<mapped_value_t<_TravelTimeMap, arc>>,
+                  "time_dependent_profile_search requires piecewise linear "
+                  "travel time functions.");
+
+private:
+    _Graph _graph;
+    _TravelTimeMap _travel_time_map;
+    heap _heap;
+    vertex_map_t<_Graph, vertex_status> _vertex_status_map;
+    vertex_map_t<_Graph, profile_type> _profiles_map;
+
+public:
+    template <typename _G, typename _M>
+    [[nodiscard]] constexpr time_dependent_profile_search(_G && g, _M && f)
+        : _graph(views::graph_all(std::forward<_G>(g)))
+        , _travel_time_map(views::mapping_all(std::forward<_M>(f)))
+        , _heap(typename _Traits::semiring::less_t(),
+                create_vertex_map<std::size_t>(_graph))
+        , _vertex_status_map(create_vertex_map<vertex_status>(_graph, PRE_HEAP))
+        , _profiles_map(create_vertex_map<profile_type>(_graph)) {}
+
+    template <typename _G, typename _M>
+    [[nodiscard]] constexpr time_dependent_profile_search(_G && g, _M && f,
+                                                          const vertex & s)
+        : time_dependent_profile_search(std::forward<_G>(g),
+                                        std::forward<_M>(f)) {
+        add_source(s);
+    }
+
+    template <typename... _Args>
+    [[nodiscard]] constexpr time_dependent_profile_search(_Traits,
+                                                          _Args &&... args)
+        : time_dependent_profile_search(std::forward<_Args>(args)...) {}
+
+    [[nodiscard]] constexpr time_dependent_profile_search(
+        const time_dependent_profile_search &) = default;
+    [[nodiscard]] constexpr time_dependent_profile_search(
+        time_dependent_profile_search &&) = default;
+
+    constexpr time_dependent_profile_search & operator=(
+        const time_dependent_profile_search &) = default;
+    constexpr time_dependent_profile_search & operator=(
+        time_dependent_profile_search &&) = default;
+
+    constexpr time_dependent_profile_search & reset() noexcept {
+        _heap.clear();
+        _vertex_status_map.fill(PRE_HEAP);
+        return *this;
+    }
+    constexpr time_dependent_profile_search & add_source(const vertex & s) {
+        assert(_vertex_status_map[s] == PRE_HEAP);
+        _profiles_map[s] = profile_type(_Traits::semiring::zero);
+        _heap.push(std::make_pair(s, _Traits::semiring::zero));
+        _vertex_status_map[s] = IN_HEAP;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr bool finished() const noexcept {
+        return _heap.empty();
+    }
+
+    [[nodiscard]] constexpr traversal_entry current() const noexcept {
+        assert(!finished());
+        return _heap.top();
+    }
+
+    constexpr void advance() {
+        assert(!finished());
+        const vertex t = _heap.top().first;
+        _vertex_status_map[t] = POST_HEAP;
+        _heap.pop();
+        for(const arc & a : melon::out_arcs(_graph, t)) {
+            const vertex & w = melon::arc_target(_graph, a);
+            profile_type w_profile =
+                link_piecewise_linear(_profiles_map[t], _travel_time_map[a]);
+            const vertex_status w_status = _vertex_status_map[w];
+            if(w_status != PRE_HEAP) {
+                if(piecewise_linear_less_equal(_profiles_map[w], w_profile))
+                    continue;
+                w_profile = min_piecewise_linear(_profiles_map[w], w_profile);
+            }
+            const time_type w_min = w_profile.min_value();
+            _profiles_map[w] = std::move(w_profile);
+            if(w_status == IN_HEAP) {
+                if(_Traits::semiring::less(w_min, _heap.priority(w)))
+                    _heap.promote(w, w_min);
+            } else {
+                _heap.push(std::make_pair(w, w_min));
+                _vertex_status_map[w] = IN_HEAP;
+            }
+        }
+    }
+
+    constexpr void run() {
+        while(!finished()) advance();
+    }
+    [[nodiscard]] constexpr auto begin() noexcept {
+        return algorithm_iterator(*this);
+    }
+    [[nodiscard]] constexpr auto end() noexcept {
+        return algorithm_end_sentinel();
+    }
+
+    [[nodiscard]] constexpr bool reached(const vertex & u) const noexcept {
+        return _vertex_status_map[u] != PRE_HEAP;
+    }
+    // Travel time function from the source to u, final once finished().
+    [[nodiscard]] constexpr const profile_type & profile(
+        const vertex & u) const noexcept {
+        assert(reached(u));
+        return _profiles_map[u];
+    }
+};
+
+template <typename _Graph, typename _TravelTimeMap,
+          typename _Traits = time_dependent_profile_search_default_traits<
+              _Graph, typename mapped_value_t<_TravelTimeMap,
+                                              arc_t<_Graph>>::time_type>>
+time_dependent_profile_search(_Graph &&, _TravelTimeMap &&)
+    -> time_dependent_profile_search<views::graph_all_t<_Graph>,
+                                     views::mapping_all_t<_TravelTimeMap>,
+                                     _Traits>;
+
+template <typename _Graph, typename _TravelTimeMap,
+          typename _Traits = time_dependent_profile_search_default_traits<
+              _Graph, typename mapped_value_t<_TravelTimeMap,
+                                              arc_t<_Graph>>::time_type>>
+time_dependent_profile_search(_Graph &&, _TravelTimeMap &&,
+                              const vertex_t<_Graph> &)
+    -> time_dependent_profile_search<views::graph_all_t<_Graph>,
+                                     views::mapping_all_t<_TravelTimeMap>,
+                                     _Traits>;
+
+template <typename _Graph, typename _TravelTimeMap, typename _Traits>
+time_dependent_profile_search(_Traits, _Graph &&, _TravelTimeMap &&)
+    -> time_dependent_profile_search<views::graph_all_t<_Graph>,
+                                     views::mapping_all_t<_TravelTimeMap>,
+                                     _Traits>;
+
+template <typename _Graph, typename _TravelTimeMap, typename _Traits>
+time_dependent_profile_search(_Traits, _Graph &&, _TravelTimeMap &&,
+                              const vertex_t<_Graph> &)
+    -> time_dependent_profile_search<views::graph_all_t<_Graph>,
+                                     views::mapping_all_t<_TravelTimeMap>,
+                                     _Traits>;
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_ALGORITHM_TIME_DEPENDENT_DIJKSTRA_HPP
@@ -11,22 +11,45 @@
 #ifndef FHAMONIC_MELON_HPP
 #define FHAMONIC_MELON_HPP
 
+#include "melon/container/compressed_static_digraph.hpp"
+#include "melon/container/mapped_static_digraph.hpp"
 #include "melon/container/mutable_digraph.hpp"
+#include "melon/container/dynamic_digraph.hpp"
 #include "melon/container/static_digraph.hpp"
 #include "melon/utility/static_digraph_builder.hpp"
+#include "melon/utility/condensation.hpp"
+#include "melon/utility/vertex_reordering.hpp"
 #include "melon/container/static_forward_digraph.hpp"
 #include "melon/container/static_forward_weighted_digraph.hpp"
+#include "melon/container/versioned_digraph.hpp"
 
+#include "melon/algorithm/a_star.hpp"
+#include "melon/algorithm/alt_landmarks.hpp"
+#include "melon/algorithm/bellman_ford.hpp"
 #include "melon/algorithm/bidirectional_dijkstra.hpp"
+#include "melon/algorithm/contraction_hierarchy.hpp"
+#include "melon/algorithm/customizable_route_planning.hpp"
+#include "melon/algorithm/delta_stepping.hpp"
 #include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/direction_optimizing_breadth_first_search.hpp"
 #include "melon/algorithm/depth_first_search.hpp"
 #include "melon/algorithm/dijkstra.hpp"
+#include "melon/algorithm/distance_table.hpp"
 #include "melon/algorithm/dinitz.hpp"
 #include "melon/algorithm/edmonds_karp.hpp"
+#include "melon/algorithm/multi_source_breadth_first_search.hpp"
+#include "melon/algorithm/parallel_breadth_first_search.hpp"
+#include "melon/algorithm/parallel_strongly_connected_components.hpp"
+#include "melon/algorithm/multicriteria_dijkstra.hpp"
+#include "melon/algorithm/time_dependent_dijkstra.hpp"
 #include "melon/algorithm/competing_dijkstras.hpp"
 
+#include "melon/container/bucket_queue.hpp"
 #include "melon/container/d_ary_heap.hpp"
+#include "melon/container/piecewise_linear_functions.hpp"
+#include "melon/container/radix_heap.hpp"
 #include "melon/container/static_map.hpp"
+#include "melon/container/timestamped_map.hpp"
 
 #include "melon/mapping.hpp"
 #include "melon/utility/semirings.hpp"
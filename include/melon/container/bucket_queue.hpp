@@ -0,0 +1,195 @@
+#ifndef MELON_BUCKET_QUEUE_HPP
+#define MELON_BUCKET_QUEUE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "melon/mapping.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Dial's bucket queue for non-negative integer priorities : a circular array
+// of buckets indexed by the priorities modulo its size, that must exceed the
+// difference between the largest and the smallest priority in the queue,
+// i.e. the maximum arc length for Dijkstra. The queue is monotone : the
+// priorities pushed or promoted must not be lower than the last popped one,
+// but can be lower than the current minimum before the first pop.
+//
+// Push and promote are O(1) and pop scans the empty buckets up to the next
+// minimum. The array doubles when a priority does not fit in, such that the
+// maximum arc length does not need to be known in advance.
+// The index map stores the bucket and position of every entry.
+template <typename _Entry,
+          typename _PriorityComparator =
+              std::less<mapped_value_t<views::identity_map, _Entry>>,
+          typename _IndicesMap =
+              mapping_owning_view<std::unordered_map<_Entry, std::size_t>>,
+          input_mapping<_Entry> _EntryPriorityMap = views::identity_map,
+          input_mapping<_Entry> _EntryIdMap = views::identity_map>
+    requires std::integral<mapped_value_t<_EntryPriorityMap, _Entry>> &&
+             std::same_as<_PriorityComparator,
+                          std::less<mapped_value_t<_EntryPriorityMap, _Entry>>> &&
+             output_mapping<_IndicesMap, mapped_value_t<_EntryIdMap, _Entry>>
+class bucket_queue {
+public:
+    using value_type = _Entry;
+    using size_type = std::size_t;
+    using priority_type = mapped_value_t<_EntryPriorityMap, _Entry>;
+    using id_type = mapped_value_t<_EntryIdMap, _Entry>;
+
+private:
+    using unsigned_priority = std::make_unsigned_t<priority_type>;
+    static constexpr size_type initial_num_buckets = 64;
+
+    std::vector<std::vector<value_type>> _buckets;
+    int _num_buckets_log;
+    size_type _size;
+    priority_type _min;
+    priority_type _max;
+    [[no_unique_address]] _EntryPriorityMap _entry_priority_map;
+    [[no_unique_address]] _EntryIdMap _entry_id_map;
+    [[no_unique_address]] _IndicesMap _heap_index_map;
+
+public:
+    [[nodiscard]] bucket_queue()
+        : _buckets(initial_num_buckets)
+        , _num_buckets_log(std::countr_zero(initial_num_buckets))
+        , _size(0)
+        , _min(0)
+        , _max(0)
+        , _entry_priority_map()
+        , _entry_id_map()
+        , _heap_index_map() {}
+
+    template <typename PC, typename HIM>
+    [[nodiscard]] bucket_queue(PC &&, HIM && heap_index_map)
+        : _buckets(initial_num_buckets)
+        , _num_buckets_log(std::countr_zero(initial_num_buckets))
+        , _size(0)
+        , _min(0)
+        , _max(0)
+        , _entry_priority_map()
+        , _entry_id_map()
+        , _heap_index_map(std::forward<HIM>(heap_index_map)) {}
+
+    [[nodiscard]] bucket_queue(const bucket_queue &) = default;
+    [[nodiscard]] bucket_queue(bucket_queue &&) = default;
+
+    bucket_queue & operator=(const bucket_queue &) = default;
+    bucket_queue & operator=(bucket_queue &&) = default;
+
+    [[nodiscard]] constexpr size_type size() const noexcept { return _size; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return _size == 0; }
+    constexpr void clear() noexcept {
+        for(auto & bucket : _buckets) bucket.resize(0);
+        _size = 0;
+    }
+
+private:
+    [[nodiscard]] constexpr size_type bucket_of(
+        const priority_type p) const noexcept {
+        return static_cast<size_type>(static_cast<unsigned_priority>(p)) &
+               (_buckets.size() - 1);
+    }
+    constexpr void insert(value_type && e) noexcept {
+        const size_type b = bucket_of(_entry_priority_map[e]);
+        _heap_index_map[_entry_id_map[e]] =
+            (_buckets[b].size() << _num_buckets_log) | b;
+        _buckets[b].push_back(std::move(e));
+    }
+    constexpr value_type erase(const size_type index) noexcept {
+        const size_type b = index & (_buckets.size() - 1);
+        const size_type pos = index >> _num_buckets_log;
+        std::vector<value_type> & bucket = _buckets[b];
+        value_type e = std::move(bucket[pos]);
+        if(pos + 1 < bucket.size()) {
+            bucket[pos] = std::move(bucket.back());
+            _heap_index_map[_entry_id_map[bucket[pos]]] = index;
+        }
+        bucket.pop_back();
+        return e;
+    }
+    // Extends [_min,_max] to contain p, making room for it by growing the
+    // number of buckets to a power of two and redistributing the entries.
+    constexpr void include(const priority_type p) {
+        if(_size == 0) {
+            _min = _max = p;
+            return;
+        }
+        _min = std::min(_min, p);
+        _max = std::max(_max, p);
+        const auto range = static_cast<size_type>(
+            static_cast<unsigned_priority>(_max) -
+            static_cast<unsigned_priority>(_min));
+        if(range < _buckets.size()) return;
+        std::vector<std::vector<value_type>> old_buckets(std::bit_ceil(range + 1));
+        std::swap(old_buckets, _buckets);
+        _num_buckets_log = std::countr_zero(_buckets.size());
+        for(auto & bucket : old_buckets)
+            for(auto && e : bucket) insert(std::move(e));
+    }
+    constexpr void advance_min() noexcept {
+        if(_size == 0) return;
+        while(_buckets[bucket_of(_min)].empty()) ++_min;
+    }
+
+public:
+    constexpr void push(value_type e) noexcept {
+        include(_entry_priority_map[e]);
+        insert(std::move(e));
+        ++_size;
+    }
+    [[nodiscard]] constexpr value_type top() const noexcept {
+        assert(!empty());
+        return _buckets[bucket_of(_min)].back();
+    }
+    constexpr void pop() noexcept {
+        assert(!empty());
+        _buckets[bucket_of(_min)].pop_back();
+        --_size;
+        advance_min();
+    }
+
+    [[nodiscard]] constexpr priority_type priority(
+        const id_type & k) const noexcept {
+        const size_type index = _heap_index_map[k];
+        return _entry_priority_map[_buckets[index & (_buckets.size() - 1)]
+                                           [index >> _num_buckets_log]];
+    }
+    [[nodiscard]] constexpr bool contains(const id_type & k) const noexcept {
+        const size_type index = _heap_index_map[k];
+        const std::vector<value_type> & bucket =
+            _buckets[index & (_buckets.size() - 1)];
+        const size_type pos = index >> _num_buckets_log;
+        return pos < bucket.size() && _entry_id_map[bucket[pos]] == k;
+    }
+    constexpr void promote(const id_type & k,
+                           const priority_type & p) noexcept {
+        value_type e = erase(_heap_index_map[k]);
+        assert(!(_entry_priority_map[e] < p));
+        _entry_priority_map[e] = p;
+        include(p);
+        insert(std::move(e));
+    }
+    constexpr void demote(const id_type & k, const priority_type & p) noexcept {
+        value_type e = erase(_heap_index_map[k]);
+        assert(_entry_priority_map[e] < p);
+        _entry_priority_map[e] = p;
+        include(p);
+        insert(std::move(e));
+        advance_min();
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_BUCKET_QUEUE_HPP
@@ -0,0 +1,632 @@
+#ifndef MELON_COMPRESSED_STATIC_DIGRAPH_HPP
+#define MELON_COMPRESSED_STATIC_DIGRAPH_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+
+#include "melon/container/static_map.hpp"
+#include "melon/mapping.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Static digraph whose adjacency lists are gap encoded with zigzag varints.
+// Out-neighbors are encoded relatively to their predecessor in the list (the
+// first one relatively to the source vertex) and in-arcs store both their arc
+// id and source gaps. Arcs are handles carrying their endpoints so that
+// arc_source and arc_target stay O(1) without decoding, and they convert to
+// their integral id for indexing arc maps.
+class compressed_static_digraph {
+public:
+    using vertex = unsigned int;
+    using arc_id = unsigned int;
+
+    struct arc {
+        arc_id id;
+        vertex source;
+        vertex target;
+
+        [[nodiscard]] constexpr operator arc_id() const noexcept { return id; }
+        [[nodiscard]] friend constexpr bool operator==(const arc &,
+                                                       const arc &) = default;
+        [[nodiscard]] friend constexpr auto operator<=>(const arc &,
+                                                        const arc &) = default;
+    };
+
+private:
+    using byte = std::uint8_t;
+
+    static_map<vertex, arc_id> _out_arc_begin;
+    static_map<vertex, std::size_t> _out_offset;
+    static_map<std::size_t, byte> _out_bytes;
+
+    static_map<vertex, arc_id> _in_arc_begin;
+    static_map<vertex, std::size_t> _in_offset;
+    static_map<std::size_t, byte> _in_bytes;
+
+    std::size_t _num_arcs = 0;
+
+    [[nodiscard]] static constexpr std::uint64_t zigzag(
+        const std::int64_t d) noexcept {
+        return (static_cast<std::uint64_t>(d) << 1) ^
+               static_cast<std::uint64_t>(d >> 63);
+    }
+    [[nodiscard]] static constexpr std::int64_t unzigzag(
+        const std::uint64_t z) noexcept {
+        return static_cast<std::int64_t>(z >> 1) ^
+               -static_cast<std::int64_t>(z & 1);
+    }
+    [[nodiscard]] static constexpr std::uint64_t delta(
+        const std::uint64_t prev, const std::uint64_t value) noexcept {
+        return zigzag(static_cast<std::int64_t>(value) -
+                      static_cast<std::int64_t>(prev));
+    }
+    [[nodiscard]] static constexpr std::size_t varint_size(
+        std::uint64_t z) noexcept {
+        std::size_t size = 1;
+        while(z >= 0x80) {
+            z >>= 7;
+            ++size;
+        }
+        return size;
+    }
+    static constexpr byte * write_varint(byte * p, std::uint64_t z) noexcept {
+        while(z >= 0x80) {
+            *p++ = static_cast<byte>(z | 0x80);
+            z >>= 7;
+        }
+        *p++ = static_cast<byte>(z);
+        return p;
+    }
+    static constexpr const byte * read_varint(const byte * p,
+                                              std::uint64_t & z) noexcept {
+        z = *p & 0x7f;
+        for(unsigned shift = 7; *p++ & 0x80; shift += 7)
+            z |= static_cast<std::uint64_t>(*p & 0x7f) << shift;
+        return p;
+    }
+    template <typename T>
+    [[nodiscard]] static constexpr T apply_delta(const T prev,
+                                                 const std::uint64_t z) {
+        return static_cast<T>(static_cast<std::int64_t>(prev) + unzigzag(z));
+    }
+
+public:
+    class out_neighbors_view : public std::ranges::view_base {
+    private:
+        const byte * _begin;
+        const byte * _end;
+        vertex _source;
+
+    public:
+        class iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = vertex;
+            using difference_type = std::ptrdiff_t;
+
+        private:
+            const byte * _p;
+            const byte * _next;
+            const byte * _end;
+            vertex _target;
+
+        public:
+            [[nodiscard]] constexpr iterator() = default;
+            [[nodiscard]] constexpr iterator(const byte * p, const byte * end,
+                                             const vertex s) noexcept
+                : _p(p), _next(p), _end(end), _target(s) {
+                decode();
+            }
+
+        private:
+            constexpr void decode() noexcept {
+                if(_p == _end) return;
+                std::uint64_t z;
+                _next = read_varint(_p, z);
+                _target = apply_delta(_target, z);
+            }
+
+        public:
+            [[nodiscard]] constexpr vertex operator*() const noexcept {
+                return _target;
+            }
+            constexpr iterator & operator++() noexcept {
+                _p = _next;
+                decode();
+                return *this;
+            }
+            constexpr iterator operator++(int) noexcept {
+                iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+            [[nodiscard]] friend constexpr bool operator==(
+                const iterator & it1, const iterator & it2) noexcept {
+                return it1._p == it2._p;
+            }
+            [[nodiscard]] friend constexpr bool operator==(
+                const iterator & it, std::default_sentinel_t) noexcept {
+                return it._p == it._end;
+            }
+        };
+
+        [[nodiscard]] constexpr out_neighbors_view() = default;
+        [[nodiscard]] constexpr out_neighbors_view(const byte * begin,
+                                                   const byte * end,
+                                                   const vertex s) noexcept
+            : _begin(begin), _end(end), _source(s) {}
+
+        [[nodiscard]] constexpr iterator begin() const noexcept {
+            return iterator(_begin, _end, _source);
+        }
+        [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept {
+            return std::default_sentinel;
+        }
+        [[nodiscard]] constexpr bool empty() const noexcept {
+            return _begin == _end;
+        }
+    };
+
+    class out_arcs_view : public std::ranges::view_base {
+    private:
+        out_neighbors_view _neighbors;
+        arc_id _first_arc;
+        vertex _source;
+
+    public:
+        class iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = arc;
+            using difference_type = std::ptrdiff_t;
+
+        private:
+            out_neighbors_view::iterator _it;
+            arc_id _id;
+            vertex _source;
+
+        public:
+            [[nodiscard]] constexpr iterator() = default;
+            [[nodiscard]] constexpr iterator(out_neighbors_view::iterator it,
+                                             const arc_id a,
+                                             const vertex s) noexcept
+                : _it(it), _id(a), _source(s) {}
+
+            [[nodiscard]] constexpr arc operator*() const noexcept {
+                return arc{_id, _source, *_it};
+            }
+            constexpr iterator & operator++() noexcept {
+                ++_it;
+                ++_id;
+                return *this;
+            }
+            constexpr iterator operator++(int) noexcept {
+                iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+            [[nodiscard]] friend constexpr bool operator==(
+                const iterator & it1, const iterator & it2) noexcept {
+                return it1._it == it2._it;
+            }
+            [[nodiscard]] friend constexpr bool operator==(
+                const iterator & it, std::default_sentinel_t s) noexcept {
+                return it._it == s;
+            }
+        };
+
+        [[nodiscard]] constexpr out_arcs_view() = default;
+        [[nodiscard]] constexpr out_arcs_view(out_neighbors_view neighbors,
+                                              const arc_id first_arc,
+                                              const vertex s) noexcept
+            : _neighbors(neighbors), _first_arc(first_arc), _source(s) {}
+
+        [[nodiscard]] constexpr iterator begin() const noexcept {
+            return iterator(_neighbors.begin(), _first_arc, _source);
+        }
+        [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept {
+            return std::default_sentinel;
+        }
+        [[nodiscard]] constexpr bool empty() const noexcept {
+            return _neighbors.empty();
+        }
+    };
+
+    class in_arcs_view : public std::ranges::view_base {
+    private:
+        const byte * _begin;
+        const byte * _end;
+        arc_id _arc_origin;
+        vertex _target;
+
+    public:
+        class iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = arc;
+            using difference_type = std::ptrdiff_t;
+
+        private:
+            const byte * _p;
+            const byte * _next;
+            const byte * _end;
+            arc _arc;
+
+        public:
+            [[nodiscard]] constexpr iterator() = default;
+            [[nodiscard]] constexpr iterator(const byte * p, const byte * end,
+                                             const arc_id a,
+                                             const vertex t) noexcept
+                : _p(p), _next(p), _end(end), _arc{a, t, t} {
+                decode();
+            }
+
+        private:
+            constexpr void decode() noexcept {
+                if(_p == _end) return;
+                std::uint64_t z;
+                _next = read_varint(_p, z);
+                _arc.id = apply_delta(_arc.id, z);
+                _next = read_varint(_next, z);
+                _arc.source = apply_delta(_arc.source, z);
+            }
+
+        public:
+            [[nodiscard]] constexpr arc operator*() const noexcept {
+                return _arc;
+            }
+            constexpr iterator & operator++() noexcept {
+                _p = _next;
+                decode();
+                return *this;
+            }
+            constexpr iterator operator++(int) noexcept {
+                iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+            [[nodiscard]] friend constexpr bool operator==(
+                const iterator & it1, const iterator & it2) noexcept {
+                return it1._p == it2._p;
+            }
+            [[nodiscard]] friend constexpr bool operator==(
+                const iterator & it, std::default_sentinel_t) noexcept {
+                return it._p == it._end;
+            }
+        };
+
+        [[nodiscard]] constexpr in_arcs_view() = default;
+        [[nodiscard]] constexpr in_arcs_view(const byte * begin,
+                                             const byte * end,
+                                             const arc_id arc_origin,
+                                             const vertex t) noexcept
+            : _begin(begin), _end(end), _arc_origin(arc_origin), _target(t) {}
+
+        [[nodiscard]] constexpr iterator begin() const noexcept {
+            return iterator(_begin, _end, _arc_origin, _target);
+        }
+        [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept {
+            return std::default_sentinel;
+        }
+        [[nodiscard]] constexpr bool empty() const noexcept {
+            return _begin == _end;
+        }
+    };
+
+    class in_neighbors_view : public std::ranges::view_base {
+    private:
+        in_arcs_view _arcs;
+
+    public:
+        class iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = vertex;
+            using difference_type = std::ptrdiff_t;
+
+        private:
+            in_arcs_view::iterator _it;
+
+        public:
+            [[nodiscard]] constexpr iterator() = default;
+            [[nodiscard]] constexpr explicit iterator(
+                in_arcs_view::iterator it) noexcept
+                : _it(it) {}
+
+            [[nodiscard]] constexpr vertex operator*() const noexcept {
+                return (*_it).source;
+            }
+            constexpr iterator & operator++() noexcept {
+                ++_it;
+                return *this;
+            }
+            constexpr iterator operator++(int) noexcept {
+                iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+            [[nodiscard]] friend constexpr bool operator==(
+                const iterator & it1, const iterator & it2) noexcept {
+                return it1._it == it2._it;
+            }
+            [[nodiscard]] friend constexpr bool operator==(
+                const iterator & it, std::default_sentinel_t s) noexcept {
+                return it._it == s;
+            }
+        };
+
+        [[nodiscard]] constexpr in_neighbors_view() = default;
+        [[nodiscard]] constexpr explicit in_neighbors_view(
+            in_arcs_view arcs) noexcept
+            : _arcs(arcs) {}
+
+        [[nodiscard]] constexpr iterator begin() const noexcept {
+            return iterator(_arcs.begin());
+        }
+        [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept {
+            return std::default_sentinel;
+        }
+        [[nodiscard]] constexpr bool empty() const noexcept {
+            return _arcs.empty();
+        }
+    };
+
+public:
+    [[nodiscard]] compressed_static_digraph() = default;
+    [[nodiscard]] compressed_static_digraph(
+        const compressed_static_digraph & graph) = default;
+    [[nodiscard]] compressed_static_digraph(
+        compressed_static_digraph && graph) = default;
+
+    compressed_static_digraph & operator=(const compressed_static_digraph &) =
+        default;
+    compressed_static_digraph & operator=(compressed_static_digraph &&) =
+        default;
+
+    [[nodiscard]] constexpr auto num_vertices() const noexcept {
+        return _out_arc_begin.size();
+    }
+    [[nodiscard]] constexpr std::size_t num_arcs() const noexcept {
+        return _num_arcs;
+    }
+    [[nodiscard]] constexpr std::size_t num_bytes() const noexcept {
+        return _out_bytes.size() + _in_bytes.size() +
+               num_vertices() * (2 * sizeof(arc_id) + 2 * sizeof(std::size_t));
+    }
+
+    [[nodiscard]] constexpr bool is_valid_vertex(
+        const vertex u) const noexcept {
+        return u < num_vertices();
+    }
+    [[nodiscard]] constexpr bool is_valid_arc(const arc & a) const noexcept {
+        return a.id < num_arcs() && is_valid_vertex(a.source) &&
+               is_valid_vertex(a.target);
+    }
+
+    [[nodiscard]] constexpr auto vertices() const noexcept {
+        return std::views::iota(static_cast<vertex>(0),
+                                static_cast<vertex>(num_vertices()));
+    }
+    [[nodiscard]] constexpr auto arcs() const noexcept {
+        return std::views::join(std::views::transform(
+            vertices(), [this](const vertex u) { return out_arcs(u); }));
+    }
+
+    [[nodiscard]] constexpr out_neighbors_view out_neighbors(
+        const vertex u) const noexcept {
+        assert(is_valid_vertex(u));
+        return out_neighbors_view(
+            _out_bytes.data() + _out_offset[u],
+            _out_bytes.data() + (u + 1 < num_vertices() ? _out_offset[u + 1]
+                                                        : _out_bytes.size()),
+            u);
+    }
+    [[nodiscard]] constexpr out_arcs_view out_arcs(
+        const vertex u) const noexcept {
+        assert(is_valid_vertex(u));
+        return out_arcs_view(out_neighbors(u), _out_arc_begin[u], u);
+    }
+    [[nodiscard]] constexpr in_arcs_view in_arcs(
+        const vertex u) const noexcept {
+        assert(is_valid_vertex(u));
+        return in_arcs_view(
+            _in_bytes.data() + _in_offset[u],
+            _in_bytes.data() +
+                (u + 1 < num_vertices() ? _in_offset[u + 1] : _in_bytes.size()),
+            _out_arc_begin[u], u);
+    }
+    [[nodiscard]] constexpr in_neighbors_view in_neighbors(
+        const vertex u) const noexcept {
+        return in_neighbors_view(in_arcs(u));
+    }
+
+    [[nodiscard]] constexpr std::size_t out_degree(
+        const vertex u) const noexcept {
+        assert(is_valid_vertex(u));
+        return (u + 1 < num_vertices() ? _out_arc_begin[u + 1] : num_arcs()) -
+               _out_arc_begin[u];
+    }
+    [[nodiscard]] constexpr std::size_t in_degree(
+        const vertex u) const noexcept {
+        assert(is_valid_vertex(u));
+        return (u + 1 < num_vertices() ? _in_arc_begin[u + 1] : num_arcs()) -
+               _in_arc_begin[u];
+    }
+
+    [[nodiscard]] constexpr vertex arc_source(const arc & a) const noexcept {
+        assert(is_valid_arc(a));
+        return a.source;
+    }
+    [[nodiscard]] constexpr vertex arc_target(const arc & a) const noexcept {
+        assert(is_valid_arc(a));
+        return a.target;
+    }
+
+    template <typename T>
+    [[nodiscard]] constexpr auto create_vertex_map() const noexcept {
+        return static_map<vertex, T>(num_vertices());
+    }
+    template <typename T>
+    [[nodiscard]] constexpr auto create_vertex_map(
+        const T & default_value) const noexcept {
+        return static_map<vertex, T>(num_vertices(), default_value);
+    }
+
+    template <typename T>
+    [[nodiscard]] constexpr auto create_arc_map() const noexcept {
+        return static_map<arc_id, T>(num_arcs());
+    }
+    template <typename T>
+    [[nodiscard]] constexpr auto create_arc_map(
+        const T & default_value) const noexcept {
+        return static_map<arc_id, T>(num_arcs(), default_value);
+    }
+
+public:
+    template <std::ranges::forward_range S, std::ranges::forward_range T>
+        requires std::convertible_to<std::ranges::range_value_t<S>, vertex> &&
+                     std::convertible_to<std::ranges::range_value_t<T>, vertex>
+    [[nodiscard]] compressed_static_digraph(const std::size_t & num_vertices,
+                                            S && sources, T && targets)
+        : _out_arc_begin(num_vertices, 0)
+        , _out_offset(num_vertices, 0)
+        , _in_arc_begin(num_vertices, 0)
+        , _in_offset(num_vertices, 0)
+        , _num_arcs(static_cast<std::size_t>(std::ranges::distance(sources))) {
+        assert(std::ranges::all_of(
+            sources, [n = num_vertices](auto && v) { return v < n; }));
+        assert(std::ranges::all_of(
+            targets, [n = num_vertices](auto && v) { return v < n; }));
+        assert(std::ranges::is_sorted(sources));
+        assert(static_cast<std::size_t>(std::ranges::distance(targets)) ==
+               _num_arcs);
+
+        // out adjacency : gaps between consecutive targets of each source
+        std::size_t num_out_bytes = 0;
+        {
+            vertex prev_source = 0, prev_target = 0;
+            bool first = true;
+            auto t_it = std::ranges::begin(targets);
+            for(auto && s : sources) {
+                const vertex u = static_cast<vertex>(s);
+                const vertex t = static_cast<vertex>(*t_it);
+                ++t_it;
+                if(first || u != prev_source) prev_target = u;
+                const std::size_t size = varint_size(delta(prev_target, t));
+                ++_out_arc_begin[u];
+                _out_offset[u] += size;
+                num_out_bytes += size;
+                prev_source = u;
+                prev_target = t;
+                first = false;
+            }
+        }
+        std::exclusive_scan(_out_arc_begin.data(),
+                            _out_arc_begin.data() + num_vertices,
+                            _out_arc_begin.data(), arc_id{0});
+        std::exclusive_scan(_out_offset.data(),
+                            _out_offset.data() + num_vertices,
+                            _out_offset.data(), std::size_t{0});
+        _out_bytes.resize(num_out_bytes);
+        {
+            byte * p = _out_bytes.data();
+            vertex prev_source = 0, prev_target = 0;
+            bool first = true;
+            auto t_it = std::ranges::begin(targets);
+            for(auto && s : sources) {
+                const vertex u = static_cast<vertex>(s);
+                const vertex t = static_cast<vertex>(*t_it);
+                ++t_it;
+                if(first || u != prev_source) prev_target = u;
+                p = write_varint(p, delta(prev_target, t));
+                prev_source = u;
+                prev_target = t;
+                first = false;
+            }
+        }
+
+        // in adjacency : arcs bucketed by target in increasing id order, so
+        // both ids and sources are nondecreasing in each list
+        static_map<arc_id, arc_id> in_arcs(_num_arcs);
+        static_map<arc_id, vertex> in_sources(_num_arcs);
+        {
+            auto t_it = std::ranges::begin(targets);
+            for(auto && s : sources) {
+                (void)s;
+                ++_in_arc_begin[static_cast<vertex>(*t_it)];
+                ++t_it;
+            }
+        }
+        std::exclusive_scan(_in_arc_begin.data(),
+                            _in_arc_begin.data() + num_vertices,
+                            _in_arc_begin.data(), arc_id{0});
+        {
+            static_map<vertex, arc_id> in_arc_end(num_vertices);
+            std::copy(_in_arc_begin.begin(), _in_arc_begin.end(),
+                      in_arc_end.begin());
+            arc_id a = 0;
+            auto t_it = std::ranges::begin(targets);
+            for(auto && s : sources) {
+                const vertex t = static_cast<vertex>(*t_it);
+                ++t_it;
+                const arc_id pos = in_arc_end[t]++;
+                in_arcs[pos] = a++;
+                in_sources[pos] = static_cast<vertex>(s);
+            }
+        }
+        std::size_t num_in_bytes = 0;
+        for(vertex t = 0; t < num_vertices; ++t) {
+            arc_id prev_arc = _out_arc_begin[t];
+            vertex prev_source = t;
+            const arc_id end =
+                t + 1 < num_vertices ? _in_arc_begin[t + 1] : arc_id(_num_arcs);
+            _in_offset[t] = num_in_bytes;
+            for(arc_id i = _in_arc_begin[t]; i < end; ++i) {
+                num_in_bytes += varint_size(delta(prev_arc, in_arcs[i])) +
+                                varint_size(delta(prev_source, in_sources[i]));
+                prev_arc = in_arcs[i];
+                prev_source = in_sources[i];
+            }
+        }
+        _in_bytes.resize(num_in_bytes);
+        {
+            byte * p = _in_bytes.data();
+            for(vertex t = 0; t < num_vertices; ++t) {
+                arc_id prev_arc = _out_arc_begin[t];
+                vertex prev_source = t;
+                const arc_id end = t + 1 < num_vertices ? _in_arc_begin[t + 1]
+                                                        : arc_id(_num_arcs);
+                for(arc_id i = _in_arc_begin[t]; i < end; ++i) {
+                    p = write_varint(p, delta(prev_arc, in_arcs[i]));
+                    p = write_varint(p, delta(prev_source, in_sources[i]));
+                    prev_arc = in_arcs[i];
+                    prev_source = in_sources[i];
+                }
+            }
+        }
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    fhamonic::melon::compressed_static_digraph::out_neighbors_view> = true;
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    fhamonic::melon::compressed_static_digraph::out_arcs_view> = true;
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    fhamonic::melon::compressed_static_digraph::in_arcs_view> = true;
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    fhamonic::melon::compressed_static_digraph::in_neighbors_view> = true;
+
+#endif  // MELON_COMPRESSED_STATIC_DIGRAPH_HPP
@@ -308,8 +308,10 @@ public:
     }
     [[nodiscard]] constexpr bool contains(const id_type & k) const noexcept {
         const size_type i = index_of(k);
-        if(i >= base_class::_heap_array.size()) return false;
-        return _entry_id_map[base_class::_heap_array[i]] == k;
+        if(i >= base_class::_heap_array.size() * sizeof(value_type) ||
+           i % sizeof(value_type) != 0)
+            return false;
+        return _entry_id_map[base_class::entry_ref(i)] == k;
     }
     constexpr void promote(const id_type & k,
                            const priority_type & p) noexcept {
@@ -324,7 +326,9 @@ public:
         assert(
             base_class::_priority_cmp(base_class::_entry_priority_map[e], p));
         base_class::_entry_priority_map[e] = p;
-        base_class::adjust_heap(_heap_index_map[k], std::move(e));
+        base_class::adjust_heap(
+            _heap_index_map[k],
+            base_class::_heap_array.size() * sizeof(value_type), std::move(e));
     }
 };
 
@@ -0,0 +1,280 @@
+#ifndef MELON_DYNAMIC_DIGRAPH_HPP
+#define MELON_DYNAMIC_DIGRAPH_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include "melon/container/static_map.hpp"
+#include "melon/mapping.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Mutable digraph storing the out and in arcs and neighbors of each vertex in
+// contiguous arrays, such that out_arcs and out_neighbors are spans. Arcs are
+// removed by swapping them with the last arc of the arrays, hence the order of
+// the out and in arcs of a vertex is not preserved by removals.
+template <std::unsigned_integral V = unsigned int,
+          std::unsigned_integral A = unsigned int>
+class basic_dynamic_digraph {
+public:
+    using vertex = V;
+    using arc = A;
+
+private:
+    struct vertex_struct {
+        std::vector<arc> out_arcs;
+        std::vector<vertex> out_neighbors;
+        std::vector<arc> in_arcs;
+        std::vector<vertex> in_neighbors;
+    };
+    struct arc_struct {
+        vertex source;
+        vertex target;
+        arc out_index;
+        arc in_index;
+    };
+    std::vector<vertex_struct> _vertices;
+    std::vector<arc_struct> _arcs;
+    std::vector<bool> _vertices_filter;
+    std::vector<bool> _arcs_filter;
+    std::vector<vertex> _free_vertices;
+    std::vector<arc> _free_arcs;
+    std::size_t _num_vertices;
+    std::size_t _num_arcs;
+
+public:
+    [[nodiscard]] constexpr basic_dynamic_digraph() noexcept
+        : _num_vertices(0), _num_arcs(0){};
+    [[nodiscard]] constexpr basic_dynamic_digraph(
+        const basic_dynamic_digraph & graph) = default;
+    [[nodiscard]] constexpr basic_dynamic_digraph(
+        basic_dynamic_digraph && graph) = default;
+
+    constexpr basic_dynamic_digraph & operator=(
+        const basic_dynamic_digraph &) = default;
+    constexpr basic_dynamic_digraph & operator=(basic_dynamic_digraph &&) =
+        default;
+
+    [[nodiscard]] constexpr bool is_valid_vertex(
+        const vertex v) const noexcept {
+        if(v >= _vertices.size()) return false;
+        return _vertices_filter[v];
+    }
+    [[nodiscard]] constexpr bool is_valid_arc(const arc a) const noexcept {
+        if(a >= _arcs.size()) return false;
+        return _arcs_filter[a];
+    }
+    [[nodiscard]] constexpr auto num_vertices() const noexcept {
+        return _num_vertices;
+    }
+    [[nodiscard]] constexpr auto num_arcs() const noexcept { return _num_arcs; }
+
+    [[nodiscard]] constexpr auto vertices() const noexcept {
+        return std::views::filter(
+            std::views::iota(static_cast<vertex>(0),
+                             static_cast<vertex>(_vertices.size())),
+            [this](const vertex v) -> bool { return _vertices_filter[v]; });
+    }
+    [[nodiscard]] constexpr auto arcs() const noexcept {
+        return std::views::filter(
+            std::views::iota(static_cast<arc>(0),
+                             static_cast<arc>(_arcs.size())),
+            [this](const arc a) -> bool { return _arcs_filter[a]; });
+    }
+    [[nodiscard]] constexpr auto arcs_entries() const noexcept {
+        return std::views::transform(arcs(), [this](const arc & a) {
+            return std::make_pair(
+                a, std::make_pair(_arcs[a].source, _arcs[a].target));
+        });
+    }
+
+    [[nodiscard]] constexpr vertex arc_source(const arc a) const noexcept {
+        assert(is_valid_arc(a));
+        return _arcs[a].source;
+    }
+    [[nodiscard]] constexpr auto arc_sources_map() const noexcept {
+        return views::map(
+            [this](const arc a) -> vertex { return _arcs[a].source; });
+    }
+    [[nodiscard]] constexpr vertex arc_target(const arc a) const noexcept {
+        assert(is_valid_arc(a));
+        return _arcs[a].target;
+    }
+    [[nodiscard]] constexpr auto arc_targets_map() const noexcept {
+        return views::map(
+            [this](const arc a) -> vertex { return _arcs[a].target; });
+    }
+
+    [[nodiscard]] constexpr auto out_arcs(const vertex v) const noexcept {
+        assert(is_valid_vertex(v));
+        return std::span<const arc>(_vertices[v].out_arcs);
+    }
+    [[nodiscard]] constexpr auto in_arcs(const vertex v) const noexcept {
+        assert(is_valid_vertex(v));
+        return std::span<const arc>(_vertices[v].in_arcs);
+    }
+    [[nodiscard]] constexpr auto out_neighbors(const vertex v) const noexcept {
+        assert(is_valid_vertex(v));
+        return std::span<const vertex>(_vertices[v].out_neighbors);
+    }
+    [[nodiscard]] constexpr auto in_neighbors(const vertex v) const noexcept {
+        assert(is_valid_vertex(v));
+        return std::span<const vertex>(_vertices[v].in_neighbors);
+    }
+
+    constexpr void reserve(const std::size_t num_vertices,
+                           const std::size_t num_arcs) {
+        _vertices.reserve(num_vertices);
+        _vertices_filter.reserve(num_vertices);
+        _arcs.reserve(num_arcs);
+        _arcs_filter.reserve(num_arcs);
+    }
+
+    [[nodiscard]] constexpr vertex create_vertex() noexcept {
+        vertex new_vertex;
+        if(_free_vertices.empty()) {
+            assert(_vertices.size() < std::numeric_limits<vertex>::max());
+            new_vertex = static_cast<vertex>(_vertices.size());
+            _vertices.emplace_back();
+            _vertices_filter.emplace_back(true);
+        } else {
+            new_vertex = _free_vertices.back();
+            _free_vertices.pop_back();
+            _vertices_filter[new_vertex] = true;
+        }
+        ++_num_vertices;
+        return new_vertex;
+    }
+
+private:
+    constexpr void push_out_arc(const arc a) noexcept {
+        arc_struct & as = _arcs[a];
+        vertex_struct & ss = _vertices[as.source];
+        as.out_index = static_cast<arc>(ss.out_arcs.size());
+        ss.out_arcs.push_back(a);
+        ss.out_neighbors.push_back(as.target);
+    }
+    constexpr void push_in_arc(const arc a) noexcept {
+        arc_struct & as = _arcs[a];
+        vertex_struct & ts = _vertices[as.target];
+        as.in_index = static_cast<arc>(ts.in_arcs.size());
+        ts.in_arcs.push_back(a);
+        ts.in_neighbors.push_back(as.source);
+    }
+    constexpr void erase_out_arc(const arc a) noexcept {
+        const arc_struct & as = _arcs[a];
+        vertex_struct & ss = _vertices[as.source];
+        const arc last = ss.out_arcs.back();
+        ss.out_arcs[as.out_index] = last;
+        ss.out_neighbors[as.out_index] = ss.out_neighbors.back();
+        _arcs[last].out_index = as.out_index;
+        ss.out_arcs.pop_back();
+        ss.out_neighbors.pop_back();
+    }
+    constexpr void erase_in_arc(const arc a) noexcept {
+        const arc_struct & as = _arcs[a];
+        vertex_struct & ts = _vertices[as.target];
+        const arc last = ts.in_arcs.back();
+        ts.in_arcs[as.in_index] = last;
+        ts.in_neighbors[as.in_index] = ts.in_neighbors.back();
+        _arcs[last].in_index = as.in_index;
+        ts.in_arcs.pop_back();
+        ts.in_neighbors.pop_back();
+    }
+
+public:
+    [[nodiscard]] constexpr arc create_arc(const vertex from,
+                                           const vertex to) noexcept {
+        assert(is_valid_vertex(from));
+        assert(is_valid_vertex(to));
+        arc new_arc;
+        if(_free_arcs.empty()) {
+            assert(_arcs.size() < std::numeric_limits<arc>::max());
+            new_arc = static_cast<arc>(_arcs.size());
+            _arcs.push_back({from, to, 0, 0});
+            _arcs_filter.emplace_back(true);
+        } else {
+            new_arc = _free_arcs.back();
+            _free_arcs.pop_back();
+            _arcs[new_arc] = {from, to, 0, 0};
+            _arcs_filter[new_arc] = true;
+        }
+        push_out_arc(new_arc);
+        push_in_arc(new_arc);
+        ++_num_arcs;
+        return new_arc;
+    }
+
+    constexpr void remove_arc(const arc a) noexcept {
+        assert(is_valid_arc(a));
+        erase_out_arc(a);
+        erase_in_arc(a);
+        _arcs_filter[a] = false;
+        _free_arcs.push_back(a);
+        --_num_arcs;
+    }
+    // The arrays of the removed vertex are cleared but keep their capacity
+    // for the vertex that will reuse its id.
+    constexpr void remove_vertex(const vertex v) noexcept {
+        assert(is_valid_vertex(v));
+        vertex_struct & vs = _vertices[v];
+        while(!vs.out_arcs.empty()) remove_arc(vs.out_arcs.back());
+        while(!vs.in_arcs.empty()) remove_arc(vs.in_arcs.back());
+        _vertices_filter[v] = false;
+        _free_vertices.push_back(v);
+        --_num_vertices;
+    }
+    constexpr void change_arc_target(const arc a, const vertex t) noexcept {
+        assert(is_valid_arc(a));
+        assert(is_valid_vertex(t));
+        arc_struct & as = _arcs[a];
+        if(as.target == t) return;
+        erase_in_arc(a);
+        as.target = t;
+        _vertices[as.source].out_neighbors[as.out_index] = t;
+        push_in_arc(a);
+    }
+    constexpr void change_arc_source(const arc a, const vertex s) noexcept {
+        assert(is_valid_arc(a));
+        assert(is_valid_vertex(s));
+        arc_struct & as = _arcs[a];
+        if(as.source == s) return;
+        erase_out_arc(a);
+        as.source = s;
+        _vertices[as.target].in_neighbors[as.in_index] = s;
+        push_out_arc(a);
+    }
+
+    template <typename T>
+    [[nodiscard]] constexpr static_map<vertex, T> create_vertex_map()
+        const noexcept {
+        return static_map<vertex, T>(_vertices.size());
+    }
+    template <typename T>
+    [[nodiscard]] constexpr static_map<vertex, T> create_vertex_map(
+        const T & default_value) const noexcept {
+        return static_map<vertex, T>(_vertices.size(), default_value);
+    }
+    template <typename T>
+    [[nodiscard]] constexpr static_map<arc, T> create_arc_map() const noexcept {
+        return static_map<arc, T>(_arcs.size());
+    }
+    template <typename T>
+    [[nodiscard]] constexpr static_map<arc, T> create_arc_map(
+        const T & default_value) const noexcept {
+        return static_map<arc, T>(_arcs.size(), default_value);
+    }
+};
+
+using dynamic_digraph = basic_dynamic_digraph<>;
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_DYNAMIC_DIGRAPH_HPP
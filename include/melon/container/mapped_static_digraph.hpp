@@ -0,0 +1,417 @@
+#ifndef MELON_MAPPED_STATIC_DIGRAPH_HPP
+#define MELON_MAPPED_STATIC_DIGRAPH_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "melon/container/static_digraph.hpp"
+#include "melon/container/static_map.hpp"
+#include "melon/detail/mapped_file.hpp"
+#include "melon/graph.hpp"
+#include "melon/mapping.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Binary layout of a static_digraph file. Every section starts on a 64 bytes
+// boundary so that the mapped arrays can be used in place.
+namespace mapped_static_digraph_format {
+inline constexpr char magic[8] = {'M', 'E', 'L', 'O', 'N', 'S', 'D', 'G'};
+inline constexpr std::uint32_t version = 1;
+inline constexpr std::uint32_t byte_order_mark = 0x01020304;
+inline constexpr std::uint64_t alignment = 64;
+
+enum class property_kind : std::uint32_t { vertex = 0, arc = 1 };
+
+struct header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order_mark;
+    std::uint32_t vertex_size;
+    std::uint32_t arc_size;
+    std::uint64_t num_vertices;
+    std::uint64_t num_arcs;
+    std::uint64_t num_properties;
+    std::uint64_t out_arc_begin_offset;
+    std::uint64_t arc_target_offset;
+    std::uint64_t arc_source_offset;
+    std::uint64_t in_arc_begin_offset;
+    std::uint64_t in_arcs_offset;
+    std::uint64_t properties_offset;
+};
+
+struct property_header {
+    property_kind kind;
+    std::uint32_t element_size;
+    std::uint64_t data_offset;
+    std::uint64_t name_offset;
+    std::uint64_t name_size;
+};
+
+[[nodiscard]] constexpr std::uint64_t align(const std::uint64_t n) noexcept {
+    return (n + alignment - 1) & ~(alignment - 1);
+}
+}  // namespace mapped_static_digraph_format
+
+// Writes a static_digraph and named vertex or arc properties in the format
+// read by mapped_static_digraph.
+class mapped_static_digraph_writer {
+private:
+    using vertex = vertex_t<static_digraph>;
+    using arc = arc_t<static_digraph>;
+    using property_kind = mapped_static_digraph_format::property_kind;
+
+    struct property {
+        std::string name;
+        property_kind kind;
+        std::uint32_t element_size;
+        std::vector<std::byte> data;
+    };
+
+    const static_digraph & _graph;
+    std::vector<property> _properties;
+
+    template <typename T, typename R, typename M>
+    void add_property(std::string name, const property_kind kind, R && keys,
+                      const M & map) {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "mapped properties must be trivially copyable.");
+        std::vector<std::byte> data(
+            static_cast<std::size_t>(std::ranges::distance(keys)) * sizeof(T));
+        std::byte * p = data.data();
+        for(auto && k : keys) {
+            const T value = map[k];
+            std::memcpy(p, &value, sizeof(T));
+            p += sizeof(T);
+        }
+        _properties.emplace_back(std::move(name), kind,
+                                 static_cast<std::uint32_t>(sizeof(T)),
+                                 std::move(data));
+    }
+
+public:
+    [[nodiscard]] explicit mapped_static_digraph_writer(
+        const static_digraph & g) noexcept
+        : _graph(g) {}
+
+    template <input_mapping<vertex> M,
+              typename T = mapped_value_t<M, vertex>>
+    mapped_static_digraph_writer & add_vertex_map(std::string name,
+                                                  const M & map) {
+        add_property<T>(std::move(name), property_kind::vertex,
+                        melon::vertices(_graph), map);
+        return *this;
+    }
+    template <input_mapping<arc> M, typename T = mapped_value_t<M, arc>>
+    mapped_static_digraph_writer & add_arc_map(std::string name,
+                                               const M & map) {
+        add_property<T>(std::move(name), property_kind::arc,
+                        melon::arcs(_graph), map);
+        return *this;
+    }
+
+    void write(const std::filesystem::path & path) const {
+        namespace format = mapped_static_digraph_format;
+        const std::uint64_t n = melon::num_vertices(_graph);
+        const std::uint64_t m = melon::num_arcs(_graph);
+
+        format::header h{};
+        std::copy(std::begin(format::magic), std::end(format::magic), h.magic);
+        h.version = format::version;
+        h.byte_order_mark = format::byte_order_mark;
+        h.vertex_size = sizeof(vertex);
+        h.arc_size = sizeof(arc);
+        h.num_vertices = n;
+        h.num_arcs = m;
+        h.num_properties = _properties.size();
+
+        std::uint64_t offset = format::align(sizeof(format::header));
+        const auto reserve = [&offset](const std::uint64_t size) {
+            const std::uint64_t section_offset = offset;
+            offset = format::align(offset + size);
+            return section_offset;
+        };
+        h.out_arc_begin_offset = reserve(n * sizeof(arc));
+        h.arc_target_offset = reserve(m * sizeof(vertex));
+        h.arc_source_offset = reserve(m * sizeof(vertex));
+        h.in_arc_begin_offset = reserve(n * sizeof(arc));
+        h.in_arcs_offset = reserve(m * sizeof(arc));
+        h.properties_offset =
+            reserve(_properties.size() * sizeof(format::property_header));
+
+        std::vector<format::property_header> property_headers;
+        for(auto && p : _properties) {
+            format::property_header ph{};
+            ph.kind = p.kind;
+            ph.element_size = p.element_size;
+            ph.name_size = p.name.size();
+            ph.name_offset = reserve(p.name.size());
+            ph.data_offset = reserve(p.data.size());
+            property_headers.push_back(ph);
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if(!file)
+            throw std::runtime_error("Cannot create '" + path.string() + "'.");
+        std::uint64_t position = 0;
+        const auto write_at = [&](const std::uint64_t at, const void * data,
+                                  const std::uint64_t size) {
+            assert(position <= at);
+            static constexpr char zeros[format::alignment] = {};
+            while(position < at) {
+                const std::uint64_t pad =
+                    std::min(at - position, format::alignment);
+                file.write(zeros, static_cast<std::streamsize>(pad));
+                position += pad;
+            }
+            file.write(static_cast<const char *>(data),
+                       static_cast<std::streamsize>(size));
+            position += size;
+        };
+        const auto write_array = [&](const std::uint64_t at, auto && range) {
+            using T = std::ranges::range_value_t<decltype(range)>;
+            std::vector<T> buffer;
+            buffer.reserve(static_cast<std::size_t>(m));
+            std::ranges::copy(range, std::back_inserter(buffer));
+            write_at(at, buffer.data(), buffer.size() * sizeof(T));
+        };
+
+        write_at(0, &h, sizeof(format::header));
+        std::vector<arc> out_arc_begin;
+        out_arc_begin.reserve(static_cast<std::size_t>(n));
+        arc num_out_arcs = 0;
+        for(auto && u : melon::vertices(_graph)) {
+            out_arc_begin.push_back(num_out_arcs);
+            num_out_arcs += std::ranges::size(melon::out_arcs(_graph, u));
+        }
+        write_at(h.out_arc_begin_offset, out_arc_begin.data(),
+                 out_arc_begin.size() * sizeof(arc));
+        write_array(h.arc_target_offset,
+                    std::views::transform(melon::arcs(_graph), [&](auto a) {
+                        return melon::arc_target(_graph, a);
+                    }));
+        write_array(h.arc_source_offset,
+                    std::views::transform(melon::arcs(_graph), [&](auto a) {
+                        return melon::arc_source(_graph, a);
+                    }));
+        std::vector<arc> in_arc_begin;
+        std::vector<arc> in_arcs;
+        in_arc_begin.reserve(static_cast<std::size_t>(n));
+        in_arcs.reserve(static_cast<std::size_t>(m));
+        for(auto && u : melon::vertices(_graph)) {
+            in_arc_begin.push_back(static_cast<arc>(in_arcs.size()));
+            std::ranges::copy(melon::in_arcs(_graph, u),
+                              std::back_inserter(in_arcs));
+        }
+        write_at(h.in_arc_begin_offset, in_arc_begin.data(),
+                 in_arc_begin.size() * sizeof(arc));
+        write_at(h.in_arcs_offset, in_arcs.data(), in_arcs.size() * sizeof(arc));
+        write_at(h.properties_offset, property_headers.data(),
+                 property_headers.size() * sizeof(format::property_header));
+        for(std::size_t i = 0; i < _properties.size(); ++i) {
+            write_at(property_headers[i].name_offset,
+                     _properties[i].name.data(), _properties[i].name.size());
+            write_at(property_headers[i].data_offset,
+                     _properties[i].data.data(), _properties[i].data.size());
+        }
+        write_at(offset, nullptr, 0);
+        if(!file)
+            throw std::runtime_error("Cannot write '" + path.string() + "'.");
+    }
+};
+
+// static_digraph whose arrays live in a memory mapped file written by
+// mapped_static_digraph_writer. Loading only validates the header and the
+// section bounds, so it takes constant time regardless of the graph size and
+// processes mapping the same file share its pages.
+class mapped_static_digraph {
+private:
+    using vertex = unsigned int;
+    using arc = unsigned int;
+    using property_kind = mapped_static_digraph_format::property_kind;
+
+    detail::mapped_file _file;
+    std::span<const arc> _out_arc_begin;
+    std::span<const vertex> _arc_target;
+    std::span<const vertex> _arc_source;
+    std::span<const arc> _in_arc_begin;
+    std::span<const arc> _in_arcs;
+    std::span<const mapped_static_digraph_format::property_header>
+        _properties;
+
+    [[noreturn]] static void format_error(const std::string & what) {
+        throw std::runtime_error("Invalid static_digraph file: " + what + ".");
+    }
+
+    template <typename T>
+    [[nodiscard]] std::span<const T> section(const std::uint64_t offset,
+                                             const std::uint64_t count) const {
+        if(offset % alignof(T) != 0 || offset > _file.size() ||
+           count > (_file.size() - offset) / sizeof(T))
+            format_error("section out of bounds");
+        return std::span<const T>(
+            reinterpret_cast<const T *>(_file.data() + offset),
+            static_cast<std::size_t>(count));
+    }
+
+    template <typename T>
+    [[nodiscard]] std::span<const T> property(const property_kind kind,
+                                              const std::string_view name,
+                                              const std::size_t count) const {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "mapped properties must be trivially copyable.");
+        for(auto && p : _properties) {
+            if(p.kind != kind) continue;
+            const auto chars = section<char>(p.name_offset, p.name_size);
+            if(std::string_view(chars.data(), chars.size()) != name) continue;
+            if(p.element_size != sizeof(T))
+                throw std::invalid_argument("Property '" + std::string(name) +
+                                            "' has a different element size.");
+            return section<T>(p.data_offset, count);
+        }
+        throw std::out_of_range("No property named '" + std::string(name) +
+                                "'.");
+    }
+
+public:
+    [[nodiscard]] mapped_static_digraph() = default;
+    [[nodiscard]] explicit mapped_static_digraph(
+        const std::filesystem::path & path)
+        : _file(path) {
+        namespace format = mapped_static_digraph_format;
+        if(_file.size() < sizeof(format::header)) format_error("truncated header");
+        format::header h;
+        std::memcpy(&h, _file.data(), sizeof(format::header));
+        if(!std::equal(std::begin(format::magic), std::end(format::magic), h.magic))
+            format_error("bad magic number");
+        if(h.version != format::version) format_error("unsupported version");
+        if(h.byte_order_mark != format::byte_order_mark)
+            format_error("byte order mismatch");
+        if(h.vertex_size != sizeof(vertex) || h.arc_size != sizeof(arc))
+            format_error("index width mismatch");
+        _out_arc_begin = section<arc>(h.out_arc_begin_offset, h.num_vertices);
+        _arc_target = section<vertex>(h.arc_target_offset, h.num_arcs);
+        _arc_source = section<vertex>(h.arc_source_offset, h.num_arcs);
+        _in_arc_begin = section<arc>(h.in_arc_begin_offset, h.num_vertices);
+        _in_arcs = section<arc>(h.in_arcs_offset, h.num_arcs);
+        _properties = section<format::property_header>(h.properties_offset,
+                                                    h.num_properties);
+    }
+
+    mapped_static_digraph(const mapped_static_digraph &) = delete;
+    mapped_static_digraph & operator=(const mapped_static_digraph &) = delete;
+    [[nodiscard]] mapped_static_digraph(mapped_static_digraph && graph) =
+        default;
+    mapped_static_digraph & operator=(mapped_static_digraph &&) = default;
+
+    [[nodiscard]] constexpr auto num_vertices() const noexcept {
+        return _out_arc_begin.size();
+    }
+    [[nodiscard]] constexpr auto num_arcs() const noexcept {
+        return _arc_target.size();
+    }
+
+    [[nodiscard]] constexpr bool is_valid_vertex(
+        const vertex u) const noexcept {
+        return u < num_vertices();
+    }
+    [[nodiscard]] constexpr bool is_valid_arc(const arc u) const noexcept {
+        return u < num_arcs();
+    }
+
+    [[nodiscard]] constexpr auto vertices() const noexcept {
+        return std::views::iota(static_cast<vertex>(0),
+                                static_cast<vertex>(num_vertices()));
+    }
+    [[nodiscard]] constexpr auto arcs() const noexcept {
+        return std::views::iota(static_cast<arc>(0),
+                                static_cast<arc>(num_arcs()));
+    }
+
+    [[nodiscard]] constexpr auto out_arcs(const vertex u) const noexcept {
+        assert(is_valid_vertex(u));
+        return std::views::iota(
+            _out_arc_begin[u],
+            (u + 1 < num_vertices() ? _out_arc_begin[u + 1]
+                                    : static_cast<arc>(num_arcs())));
+    }
+    [[nodiscard]] constexpr auto in_arcs(const vertex u) const noexcept {
+        assert(is_valid_vertex(u));
+        return _in_arcs.subspan(
+            _in_arc_begin[u],
+            (u + 1 < num_vertices() ? _in_arc_begin[u + 1] : num_arcs()) -
+                _in_arc_begin[u]);
+    }
+
+    [[nodiscard]] constexpr vertex arc_source(const arc a) const noexcept {
+        assert(is_valid_arc(a));
+        return _arc_source[a];
+    }
+    [[nodiscard]] constexpr vertex arc_target(const arc a) const noexcept {
+        assert(is_valid_arc(a));
+        return _arc_target[a];
+    }
+
+    [[nodiscard]] constexpr auto arc_sources_map() const noexcept {
+        return _arc_source;
+    }
+    [[nodiscard]] constexpr auto arc_targets_map() const noexcept {
+        return _arc_target;
+    }
+
+    [[nodiscard]] constexpr auto out_neighbors(const vertex u) const noexcept {
+        assert(is_valid_vertex(u));
+        return _arc_target.subspan(
+            _out_arc_begin[u],
+            (u + 1 < num_vertices() ? _out_arc_begin[u + 1] : num_arcs()) -
+                _out_arc_begin[u]);
+    }
+
+    template <typename T>
+    [[nodiscard]] constexpr auto create_vertex_map() const noexcept {
+        return static_map<vertex, T>(num_vertices());
+    }
+    template <typename T>
+    [[nodiscard]] constexpr auto create_vertex_map(
+        const T & default_value) const noexcept {
+        return static_map<vertex, T>(num_vertices(), default_value);
+    }
+
+    template <typename T>
+    [[nodiscard]] constexpr auto create_arc_map() const noexcept {
+        return static_map<arc, T>(num_arcs());
+    }
+    template <typename T>
+    [[nodiscard]] constexpr auto create_arc_map(
+        const T & default_value) const noexcept {
+        return static_map<arc, T>(num_arcs(), default_value);
+    }
+
+    // Mapped properties are read-only spans indexed by vertex or arc.
+    template <typename T>
+    [[nodiscard]] std::span<const T> vertex_map(
+        const std::string_view name) const {
+        return property<T>(property_kind::vertex, name, num_vertices());
+    }
+    template <typename T>
+    [[nodiscard]] std::span<const T> arc_map(
+        const std::string_view name) const {
+        return property<T>(property_kind::arc, name, num_arcs());
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_MAPPED_STATIC_DIGRAPH_HPP
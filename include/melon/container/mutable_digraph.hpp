@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <concepts>
 #include <functional>
 #include <limits>
 #include <ranges>
@@ -15,10 +16,12 @@
 namespace fhamonic {
 namespace melon {
 
-class mutable_digraph {
+template <std::unsigned_integral V = unsigned int,
+          std::unsigned_integral A = unsigned int>
+class basic_mutable_digraph {
 public:
-    using vertex = unsigned int;
-    using arc = unsigned int;
+    using vertex = V;
+    using arc = A;
 
 private:
     static constexpr vertex INVALID_VERTEX = std::numeric_limits<vertex>::max();
@@ -48,18 +51,21 @@ private:
     std::size_t _num_arcs;
 
 public:
-    [[nodiscard]] constexpr mutable_digraph() noexcept
+    [[nodiscard]] constexpr basic_mutable_digraph() noexcept
         : _first_vertex(INVALID_VERTEX)
         , _first_free_vertex(INVALID_VERTEX)
         , _first_free_arc(INVALID_ARC)
         , _num_vertices(0)
         , _num_arcs(0){};
-    [[nodiscard]] constexpr mutable_digraph(const mutable_digraph & graph) =
-        default;
-    [[nodiscard]] constexpr mutable_digraph(mutable_digraph && graph) = default;
+    [[nodiscard]] constexpr basic_mutable_digraph(
+        const basic_mutable_digraph & graph) = default;
+    [[nodiscard]] constexpr basic_mutable_digraph(
+        basic_mutable_digraph && graph) = default;
 
-    constexpr mutable_digraph & operator=(const mutable_digraph &) = default;
-    constexpr mutable_digraph & operator=(mutable_digraph &&) = default;
+    constexpr basic_mutable_digraph & operator=(
+        const basic_mutable_digraph &) = default;
+    constexpr basic_mutable_digraph & operator=(basic_mutable_digraph &&) =
+        default;
 
     [[nodiscard]] constexpr bool is_valid_vertex(
         const vertex v) const noexcept {
@@ -187,6 +193,31 @@ public:
         return new_arc;
     }
 
+    // Creates the arcs of a range of (source, target) pairs and returns their
+    // ids in the range order, reserving the storage at most once.
+    template <std::ranges::input_range R>
+    [[nodiscard]] constexpr std::vector<arc> create_arcs(R && arc_pairs) {
+        std::vector<arc> new_arcs;
+        if constexpr(std::ranges::sized_range<R>) {
+            const auto n =
+                static_cast<std::size_t>(std::ranges::size(arc_pairs));
+            new_arcs.reserve(n);
+            // the free arcs are reused first, and the storage grows
+            // geometrically such that repeated batches stay amortized O(1)
+            const std::size_t required = std::max(_arcs.size(), _num_arcs + n);
+            if(_arcs.capacity() < required) {
+                const std::size_t capacity =
+                    std::max(required, 2 * _arcs.capacity());
+                _arcs.reserve(capacity);
+                _arcs_filter.reserve(capacity);
+            }
+        }
+        for(auto && [from, to] : arc_pairs)
+            new_arcs.push_back(create_arc(static_cast<vertex>(from),
+                                          static_cast<vertex>(to)));
+        return new_arcs;
+    }
+
 private:
     constexpr void remove_from_source_out_arcs(const arc a) noexcept {
         assert(is_valid_arc(a));
@@ -266,6 +297,64 @@ public:
         _arcs_filter[a] = false;
         --_num_arcs;
     }
+    // Removes a range of distinct arcs, each unlinked in O(1) from the out
+    // arcs list of its source and the in arcs list of its target, such that
+    // removing a few arcs of a high degree vertex does not scan its lists.
+    template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_value_t<R>, arc>
+    constexpr void remove_arcs(R && removed_arcs) noexcept {
+        for(const arc a : removed_arcs) remove_arc(a);
+    }
+
+    // Renumbers the arcs to [0, num_arcs()) such that the out arcs of each
+    // vertex are consecutive and follow the vertex ids, which restores the
+    // locality of out_arcs traversals after many modifications. The orders of
+    // the out and in arcs lists are preserved and on_arc_moved(old_arc,
+    // new_arc) is called for every arc, to allow the remapping of arc maps.
+    template <typename F>
+        requires std::invocable<F &, const arc, const arc>
+    constexpr void compact(F && on_arc_moved) {
+        std::vector<arc> new_arc_id(_arcs.size(), INVALID_ARC);
+        std::vector<arc_struct> new_arcs;
+        new_arcs.reserve(_num_arcs);
+        for(std::size_t i = 0; i < _vertices.size(); ++i) {
+            if(!_vertices_filter[i]) continue;
+            vertex_struct & vs = _vertices[i];
+            arc prev = INVALID_ARC;
+            for(arc a = vs.first_out_arc; a != INVALID_ARC;
+                a = _arcs[a].next_out_arc) {
+                const arc new_a = static_cast<arc>(new_arcs.size());
+                new_arc_id[a] = new_a;
+                arc_struct & as = new_arcs.emplace_back(_arcs[a]);
+                as.prev_out_arc = prev;
+                if(as.next_out_arc != INVALID_ARC)
+                    as.next_out_arc = static_cast<arc>(new_a + 1u);
+                prev = new_a;
+            }
+        }
+        const auto remap = [&new_arc_id](const arc a) {
+            return a == INVALID_ARC ? INVALID_ARC : new_arc_id[a];
+        };
+        for(arc_struct & as : new_arcs) {
+            as.prev_in_arc = remap(as.prev_in_arc);
+            as.next_in_arc = remap(as.next_in_arc);
+        }
+        for(std::size_t i = 0; i < _vertices.size(); ++i) {
+            if(!_vertices_filter[i]) continue;
+            _vertices[i].first_out_arc = remap(_vertices[i].first_out_arc);
+            _vertices[i].first_in_arc = remap(_vertices[i].first_in_arc);
+        }
+        for(std::size_t i = 0; i < new_arc_id.size(); ++i)
+            if(new_arc_id[i] != INVALID_ARC)
+                on_arc_moved(static_cast<arc>(i), new_arc_id[i]);
+        _arcs = std::move(new_arcs);
+        _arcs_filter.assign(_arcs.size(), true);
+        _first_free_arc = INVALID_ARC;
+    }
+    constexpr void compact() {
+        compact([](const arc, const arc) {});
+    }
+
     constexpr void change_arc_target(const arc a, const vertex t) noexcept {
         assert(is_valid_arc(a));
         assert(is_valid_vertex(t));
@@ -316,6 +405,8 @@ public:
     }
 };
 
+using mutable_digraph = basic_mutable_digraph<>;
+
 }  // namespace melon
 }  // namespace fhamonic
 
@@ -0,0 +1,108 @@
+#ifndef MELON_PIECEWISE_LINEAR_FUNCTIONS_HPP
+#define MELON_PIECEWISE_LINEAR_FUNCTIONS_HPP
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "melon/utility/piecewise_linear_function.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Map from the integral keys 0..size()-1, usually arcs, to piecewise linear
+// functions, whose breakpoints are stored contiguously in two shared arrays
+// of times and values, the ith function ranging over [offsets[i],
+// offsets[i+1]). Values are lightweight piecewise_linear_function_view.
+template <std::integral K = std::size_t, typename T = double>
+class piecewise_linear_functions {
+public:
+    using key_type = K;
+    using time_type = T;
+    using mapped_type = piecewise_linear_function_view<T>;
+    using size_type = std::size_t;
+
+private:
+    std::vector<size_type> _offsets;
+    std::vector<T> _times;
+    std::vector<T> _values;
+
+public:
+    [[nodiscard]] constexpr piecewise_linear_functions()
+        : _offsets{0}, _times(), _values() {}
+    // Constant functions of value c.
+    [[nodiscard]] constexpr piecewise_linear_functions(const size_type size,
+                                                       const T & c)
+        : _offsets(size + 1), _times(size, T{}), _values(size, c) {
+        for(size_type i = 0; i <= size; ++i) _offsets[i] = i;
+    }
+
+    [[nodiscard]] constexpr piecewise_linear_functions(
+        const piecewise_linear_functions &) = default;
+    [[nodiscard]] constexpr piecewise_linear_functions(
+        piecewise_linear_functions &&) = default;
+
+    constexpr piecewise_linear_functions & operator=(
+        const piecewise_linear_functions &) = default;
+    constexpr piecewise_linear_functions & operator=(
+        piecewise_linear_functions &&) = default;
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return _offsets.size() - 1;
+    }
+    [[nodiscard]] constexpr size_type num_breakpoints() const noexcept {
+        return _times.size();
+    }
+    constexpr void reserve(const size_type num_functions,
+                           const size_type num_breakpoints) {
+        _offsets.reserve(num_functions + 1);
+        _times.reserve(num_breakpoints);
+        _values.reserve(num_breakpoints);
+    }
+
+    // Appends the function of key size() given by its breakpoints (t, v).
+    template <std::ranges::input_range R>
+    constexpr piecewise_linear_functions & push_back(R && breakpoints) {
+        for(auto && [t, v] : breakpoints) {
+            assert(_times.size() == _offsets.back() || _times.back() < t);
+            _times.push_back(t);
+            _values.push_back(v);
+        }
+        assert(_times.size() > _offsets.back());
+        _offsets.push_back(_times.size());
+        return *this;
+    }
+    constexpr piecewise_linear_functions & push_back(
+        std::initializer_list<std::pair<T, T>> breakpoints) {
+        return push_back(std::span(breakpoints.begin(), breakpoints.size()));
+    }
+    template <piecewise_linear F>
+        requires std::same_as<typename F::time_type, T>
+    constexpr piecewise_linear_functions & push_back(const F & f) {
+        assert(f.times().size() > 0);
+        _times.insert(_times.end(), f.times().begin(), f.times().end());
+        _values.insert(_values.end(), f.values().begin(), f.values().end());
+        _offsets.push_back(_times.size());
+        return *this;
+    }
+
+    [[nodiscard]] constexpr mapped_type operator[](
+        const key_type & k) const noexcept {
+        const size_type i = static_cast<size_type>(k);
+        assert(i < size());
+        const size_type b = _offsets[i];
+        const size_type n = _offsets[i + 1] - b;
+        return mapped_type(std::span<const T>(_times.data() + b, n),
+                           std::span<const T>(_values.data() + b, n));
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_PIECEWISE_LINEAR_FUNCTIONS_HPP
@@ -0,0 +1,200 @@
+#ifndef MELON_RADIX_HEAP_HPP
+#define MELON_RADIX_HEAP_HPP
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "melon/mapping.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Monotone radix heap for non-negative integer priorities : the priorities
+// pushed or promoted must not be lower than the last popped one, which holds
+// for Dijkstra with non-negative integer lengths.
+//
+// The bucket i > 0 holds the entries whose priority first differs from the
+// last popped priority, or 0 before the first pop, at the bit i-1, and the
+// bucket 0 the entries equal to it. When popping from an empty bucket 0, the
+// first non empty bucket is redistributed around its minimum, which becomes
+// the last popped priority, into lower buckets, such that each entry moves at
+// most as many times as there are bits, and push, promote and pop are O(1)
+// amortized. The index map stores the bucket and position of every entry.
+template <typename _Entry,
+          typename _PriorityComparator =
+              std::less<mapped_value_t<views::identity_map, _Entry>>,
+          typename _IndicesMap =
+              mapping_owning_view<std::unordered_map<_Entry, std::size_t>>,
+          input_mapping<_Entry> _EntryPriorityMap = views::identity_map,
+          input_mapping<_Entry> _EntryIdMap = views::identity_map>
+    requires std::integral<mapped_value_t<_EntryPriorityMap, _Entry>> &&
+             std::same_as<_PriorityComparator,
+                          std::less<mapped_value_t<_EntryPriorityMap, _Entry>>> &&
+             output_mapping<_IndicesMap, mapped_value_t<_EntryIdMap, _Entry>>
+class radix_heap {
+public:
+    using value_type = _Entry;
+    using size_type = std::size_t;
+    using priority_type = mapped_value_t<_EntryPriorityMap, _Entry>;
+    using id_type = mapped_value_t<_EntryIdMap, _Entry>;
+
+private:
+    using unsigned_priority = std::make_unsigned_t<priority_type>;
+    static constexpr size_type num_buckets =
+        std::numeric_limits<unsigned_priority>::digits + 1;
+
+    std::array<std::vector<value_type>, num_buckets> _buckets;
+    std::vector<value_type> _redistributed;
+    size_type _size;
+    priority_type _last_min;
+    [[no_unique_address]] _EntryPriorityMap _entry_priority_map;
+    [[no_unique_address]] _EntryIdMap _entry_id_map;
+    [[no_unique_address]] _IndicesMap _heap_index_map;
+
+public:
+    [[nodiscard]] radix_heap()
+        : _buckets()
+        , _redistributed()
+        , _size(0)
+        , _last_min(0)
+        , _entry_priority_map()
+        , _entry_id_map()
+        , _heap_index_map() {}
+
+    template <typename PC, typename HIM>
+    [[nodiscard]] radix_heap(PC &&, HIM && heap_index_map)
+        : _buckets()
+        , _redistributed()
+        , _size(0)
+        , _last_min(0)
+        , _entry_priority_map()
+        , _entry_id_map()
+        , _heap_index_map(std::forward<HIM>(heap_index_map)) {}
+
+    [[nodiscard]] radix_heap(const radix_heap &) = default;
+    [[nodiscard]] radix_heap(radix_heap &&) = default;
+
+    radix_heap & operator=(const radix_heap &) = default;
+    radix_heap & operator=(radix_heap &&) = default;
+
+    [[nodiscard]] constexpr size_type size() const noexcept { return _size; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return _size == 0; }
+    constexpr void clear() noexcept {
+        for(auto & bucket : _buckets) bucket.resize(0);
+        _size = 0;
+        _last_min = 0;
+    }
+
+private:
+    [[nodiscard]] constexpr size_type bucket_of(
+        const priority_type p) const noexcept {
+        assert(!(p < _last_min));
+        return static_cast<size_type>(
+            std::bit_width(static_cast<unsigned_priority>(p) ^
+                           static_cast<unsigned_priority>(_last_min)));
+    }
+    constexpr void insert(value_type && e) noexcept {
+        const size_type b = bucket_of(_entry_priority_map[e]);
+        _heap_index_map[_entry_id_map[e]] =
+            _buckets[b].size() * num_buckets + b;
+        _buckets[b].push_back(std::move(e));
+    }
+    constexpr value_type erase(const size_type index) noexcept {
+        std::vector<value_type> & bucket = _buckets[index % num_buckets];
+        const size_type pos = index / num_buckets;
+        value_type e = std::move(bucket[pos]);
+        if(pos + 1 < bucket.size()) {
+            bucket[pos] = std::move(bucket.back());
+            _heap_index_map[_entry_id_map[bucket[pos]]] = index;
+        }
+        bucket.pop_back();
+        return e;
+    }
+    [[nodiscard]] constexpr size_type first_non_empty_bucket() const noexcept {
+        size_type b = 0;
+        while(_buckets[b].empty()) ++b;
+        return b;
+    }
+    // Position of the last minimum entry of the bucket, i.e. of the entry
+    // that ends at the back of the bucket 0 once the bucket is redistributed.
+    [[nodiscard]] constexpr size_type min_position(
+        const std::vector<value_type> & bucket) const noexcept {
+        size_type pos = 0;
+        for(size_type i = 1; i < bucket.size(); ++i)
+            if(!(_entry_priority_map[bucket[pos]] <
+                 _entry_priority_map[bucket[i]]))
+                pos = i;
+        return pos;
+    }
+    // Makes the minimum entry the back of the bucket 0, which is only done
+    // when popping, such that the last minimum is always the last popped
+    // priority and the entries pushed in between are not redistributed.
+    constexpr void refill() noexcept {
+        assert(_size > 0);
+        if(!_buckets[0].empty()) return;
+        std::swap(_redistributed, _buckets[first_non_empty_bucket()]);
+        _last_min =
+            _entry_priority_map[_redistributed[min_position(_redistributed)]];
+        for(auto && e : _redistributed) insert(std::move(e));
+        _redistributed.resize(0);
+    }
+
+public:
+    constexpr void push(value_type e) noexcept {
+        insert(std::move(e));
+        ++_size;
+    }
+    // The entry that pop() removes, found without redistributing its bucket.
+    [[nodiscard]] constexpr value_type top() const noexcept {
+        assert(!empty());
+        if(!_buckets[0].empty()) return _buckets[0].back();
+        const std::vector<value_type> & bucket =
+            _buckets[first_non_empty_bucket()];
+        return bucket[min_position(bucket)];
+    }
+    constexpr void pop() noexcept {
+        assert(!empty());
+        refill();
+        _buckets[0].pop_back();
+        --_size;
+    }
+
+    [[nodiscard]] constexpr priority_type priority(
+        const id_type & k) const noexcept {
+        const size_type index = _heap_index_map[k];
+        return _entry_priority_map
+            [_buckets[index % num_buckets][index / num_buckets]];
+    }
+    [[nodiscard]] constexpr bool contains(const id_type & k) const noexcept {
+        const size_type index = _heap_index_map[k];
+        const std::vector<value_type> & bucket = _buckets[index % num_buckets];
+        const size_type pos = index / num_buckets;
+        return pos < bucket.size() && _entry_id_map[bucket[pos]] == k;
+    }
+    constexpr void promote(const id_type & k,
+                           const priority_type & p) noexcept {
+        value_type e = erase(_heap_index_map[k]);
+        assert(!(_entry_priority_map[e] < p));
+        _entry_priority_map[e] = p;
+        insert(std::move(e));
+    }
+    constexpr void demote(const id_type & k, const priority_type & p) noexcept {
+        value_type e = erase(_heap_index_map[k]);
+        assert(_entry_priority_map[e] < p);
+        _entry_priority_map[e] = p;
+        insert(std::move(e));
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_RADIX_HEAP_HPP
@@ -2,7 +2,10 @@
 #define MELON_STATIC_DIGRAPH_HPP
 
 #include <algorithm>
+#include <bit>
 #include <cassert>
+#include <concepts>
+#include <limits>
 #include <numeric>
 #include <ranges>
 #include <span>
@@ -10,15 +13,18 @@
 
 #include "melon/container/static_filter_map.hpp"
 #include "melon/container/static_map.hpp"
+#include "melon/detail/parallel.hpp"
 #include "melon/mapping.hpp"
 
 namespace fhamonic {
 namespace melon {
 
-class static_digraph {
+template <std::unsigned_integral V = unsigned int,
+          std::unsigned_integral A = unsigned int>
+class basic_static_digraph {
 private:
-    using vertex = unsigned int;
-    using arc = unsigned int;
+    using vertex = V;
+    using arc = A;
 
     static_map<vertex, arc> _out_arc_begin;
     static_map<arc, vertex> _arc_target;
@@ -28,12 +34,13 @@ private:
     static_map<arc, arc> _in_arcs;
 
 public:
-    [[nodiscard]] static_digraph() = default;
-    [[nodiscard]] static_digraph(const static_digraph & graph) = default;
-    [[nodiscard]] static_digraph(static_digraph && graph) = default;
+    [[nodiscard]] basic_static_digraph() = default;
+    [[nodiscard]] basic_static_digraph(const basic_static_digraph & graph) =
+        default;
+    [[nodiscard]] basic_static_digraph(basic_static_digraph && graph) = default;
 
-    static_digraph & operator=(const static_digraph &) = default;
-    static_digraph & operator=(static_digraph &&) = default;
+    basic_static_digraph & operator=(const basic_static_digraph &) = default;
+    basic_static_digraph & operator=(basic_static_digraph &&) = default;
 
     [[nodiscard]] constexpr auto num_vertices() const noexcept {
         return _out_arc_begin.size();
@@ -59,18 +66,27 @@ public:
                                 static_cast<arc>(num_arcs()));
     }
 
+private:
+    [[nodiscard]] constexpr arc out_arcs_end(const vertex u) const noexcept {
+        return u + 1u < num_vertices()
+                   ? _out_arc_begin[static_cast<vertex>(u + 1u)]
+                   : static_cast<arc>(num_arcs());
+    }
+    [[nodiscard]] constexpr arc in_arcs_end(const vertex u) const noexcept {
+        return u + 1u < num_vertices()
+                   ? _in_arc_begin[static_cast<vertex>(u + 1u)]
+                   : static_cast<arc>(num_arcs());
+    }
+
+public:
     [[nodiscard]] constexpr auto out_arcs(const vertex u) const noexcept {
         assert(is_valid_vertex(u));
-        return std::views::iota(
-            _out_arc_begin[u],
-            (u + 1 < num_vertices() ? _out_arc_begin[u + 1] : num_arcs()));
+        return std::views::iota(_out_arc_begin[u], out_arcs_end(u));
     }
     [[nodiscard]] constexpr auto in_arcs(const vertex u) const noexcept {
         assert(is_valid_vertex(u));
-        return std::span(
-            _in_arcs.data() + _in_arc_begin[u],
-            (u + 1 < num_vertices() ? _in_arcs.data() + _in_arc_begin[u + 1]
-                                   : _in_arcs.data() + num_arcs()));
+        return std::span(_in_arcs.data() + _in_arc_begin[u],
+                         _in_arcs.data() + in_arcs_end(u));
     }
 
     [[nodiscard]] constexpr vertex arc_source(const arc a) const noexcept {
@@ -91,65 +107,125 @@ public:
 
     [[nodiscard]] constexpr auto out_neighbors(const vertex u) const noexcept {
         assert(is_valid_vertex(u));
-        return std::span(
-            _arc_target.data() + _out_arc_begin[u],
-            (u + 1 < num_vertices() ? _arc_target.data() + _out_arc_begin[u + 1]
-                                   : _arc_target.data() + num_arcs()));
+        return std::span(_arc_target.data() + _out_arc_begin[u],
+                         _arc_target.data() + out_arcs_end(u));
     }
 
     template <typename T>
     [[nodiscard]] constexpr auto create_vertex_map() const noexcept {
-        return static_map<vertex, T>(num_vertices());
+        return static_map<vertex, T>(num_vertices(), _out_arc_begin.policy());
     }
     template <typename T>
     [[nodiscard]] constexpr auto create_vertex_map(
         const T & default_value) const noexcept {
-        return static_map<vertex, T>(num_vertices(), default_value);
+        return static_map<vertex, T>(num_vertices(), default_value,
+                                     _out_arc_begin.policy());
     }
 
     template <typename T>
     [[nodiscard]] constexpr auto create_arc_map() const noexcept {
-        return static_map<arc, T>(num_arcs());
+        return static_map<arc, T>(num_arcs(), _out_arc_begin.policy());
     }
     template <typename T>
     [[nodiscard]] constexpr auto create_arc_map(
         const T & default_value) const noexcept {
-        return static_map<arc, T>(num_arcs(), default_value);
+        return static_map<arc, T>(num_arcs(), default_value,
+                                  _out_arc_begin.policy());
     }
 
 public:
     template <std::ranges::forward_range S, std::ranges::forward_range T>
         requires std::convertible_to<std::ranges::range_value_t<S>, vertex> &&
                      std::convertible_to<std::ranges::range_value_t<T>, vertex>
-    [[nodiscard]] static_digraph(const std::size_t & num_vertices, S && sources,
-                                 T && targets) noexcept
-        : _out_arc_begin(num_vertices, 0)
-        , _arc_target(std::forward<T>(targets))
-        , _arc_source(std::forward<S>(sources))
-        , _in_arc_begin(num_vertices, 0)
-        , _in_arcs(_arc_target.size()) {
+    [[nodiscard]] basic_static_digraph(const std::size_t & num_vertices,
+                                       S && sources, T && targets,
+                                       const allocation_policy & alloc = {})
+        : _out_arc_begin(num_vertices, 0, alloc)
+        , _arc_target(std::forward<T>(targets), alloc)
+        , _arc_source(std::forward<S>(sources), alloc)
+        , _in_arc_begin(num_vertices, 0, alloc)
+        , _in_arcs(_arc_target.size(), alloc) {
         assert(std::ranges::all_of(
             sources, [n = num_vertices](auto && v) { return v < n; }));
         assert(std::ranges::all_of(
             targets, [n = num_vertices](auto && v) { return v < n; }));
         assert(std::ranges::is_sorted(sources));
-        static_map<vertex, arc> in_arc_count(num_vertices, 0);
-        for(auto && s : sources) ++_out_arc_begin[s];
-        for(auto && t : targets) ++in_arc_count[t];
+        assert(num_vertices <= std::numeric_limits<vertex>::max());
+        assert(_arc_target.size() <= std::numeric_limits<arc>::max());
+        static_map<vertex, arc> in_arc_count(num_vertices, 0, alloc);
+        for(auto && s : sources) ++_out_arc_begin[static_cast<vertex>(s)];
+        for(auto && t : targets) ++in_arc_count[static_cast<vertex>(t)];
         std::exclusive_scan(_out_arc_begin.data(),
                             _out_arc_begin.data() + num_vertices,
-                            _out_arc_begin.data(), 0);
+                            _out_arc_begin.data(), arc{0});
         std::exclusive_scan(in_arc_count.data(),
                             in_arc_count.data() + num_vertices,
-                            _in_arc_begin.data(), 0);
+                            _in_arc_begin.data(), arc{0});
         for(auto && a : arcs()) {
             vertex t = _arc_target[a];
             --in_arc_count[t];
-            _in_arcs[_in_arc_begin[t] + in_arc_count[t]] = a;
+            _in_arcs[static_cast<arc>(_in_arc_begin[t] + in_arc_count[t])] = a;
         }
     }
+
+    // Same graph as the serial constructor, including the order of in_arcs,
+    // but built with parallel copies, a parallel radix sort of the arcs by
+    // target and a parallel computation of the adjacency offsets.
+    template <std::ranges::random_access_range S,
+              std::ranges::random_access_range T>
+        requires std::convertible_to<std::ranges::range_value_t<S>, vertex> &&
+                     std::convertible_to<std::ranges::range_value_t<T>, vertex>
+    [[nodiscard]] basic_static_digraph(const parallel_policy & policy,
+                                       const std::size_t & num_vertices,
+                                       S && sources, T && targets,
+                                       const allocation_policy & alloc = {})
+        : _out_arc_begin(num_vertices, alloc)
+        , _arc_target(static_cast<std::size_t>(std::ranges::size(targets)),
+                      alloc)
+        , _arc_source(static_cast<std::size_t>(std::ranges::size(sources)),
+                      alloc)
+        , _in_arc_begin(num_vertices, alloc)
+        , _in_arcs(_arc_target.size(), alloc) {
+        assert(std::ranges::all_of(
+            sources, [n = num_vertices](auto && v) { return v < n; }));
+        assert(std::ranges::all_of(
+            targets, [n = num_vertices](auto && v) { return v < n; }));
+        assert(std::ranges::is_sorted(sources));
+        assert(_arc_source.size() == _arc_target.size());
+        assert(num_vertices <= std::numeric_limits<vertex>::max());
+        assert(_arc_target.size() <= std::numeric_limits<arc>::max());
+        const std::size_t num_threads = detail::num_threads(policy);
+        const std::size_t m = _arc_target.size();
+        const auto nth = [](auto && it, const std::size_t i) {
+            return static_cast<vertex>(
+                it[static_cast<std::iter_difference_t<decltype(it)>>(i)]);
+        };
+        static_map<arc, vertex> sorted_targets(m, alloc);
+        detail::parallel_for(num_threads, m, [&](const std::size_t i) {
+            _arc_source[static_cast<arc>(i)] =
+                nth(std::ranges::begin(sources), i);
+            _arc_target[static_cast<arc>(i)] =
+                nth(std::ranges::begin(targets), i);
+            // arcs are listed backward to match the serial scatter order
+            sorted_targets[static_cast<arc>(i)] =
+                nth(std::ranges::begin(targets), m - 1 - i);
+            _in_arcs[static_cast<arc>(i)] = static_cast<arc>(m - 1 - i);
+        });
+        detail::parallel_sorted_keys_begin(
+            num_threads, std::span<const vertex>(_arc_source.data(), m),
+            std::span<arc>(_out_arc_begin.data(), num_vertices));
+        detail::parallel_radix_sort(
+            num_threads, std::span<vertex>(sorted_targets.data(), m),
+            std::span<arc>(_in_arcs.data(), m),
+            static_cast<unsigned int>(std::bit_width(num_vertices)));
+        detail::parallel_sorted_keys_begin(
+            num_threads, std::span<const vertex>(sorted_targets.data(), m),
+            std::span<arc>(_in_arc_begin.data(), num_vertices));
+    }
 };
 
+using static_digraph = basic_static_digraph<>;
+
 }  // namespace melon
 }  // namespace fhamonic
 
@@ -2,6 +2,7 @@
 #define MELON_STATIC_FILTER_MAP_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <bit>
 #include <cassert>
 #include <memory>
@@ -297,6 +298,16 @@ public:
         return reference(_data.get() + i / N, i & span_index_mask);
     }
 
+    // Sets the ith bit with an atomic fetch_or, for threads claiming keys
+    // concurrently, and returns whether it was already set.
+    bool atomic_test_and_set(const size_type i) noexcept {
+        assert(i < size());
+        std::atomic_ref<span_type> span(_data[i / N]);
+        const span_type mask = span_type(1) << (i & span_index_mask);
+        if(span.load(std::memory_order_relaxed) & mask) return true;
+        return span.fetch_or(mask, std::memory_order_relaxed) & mask;
+    }
+
     void fill(bool b) noexcept {
         std::fill(_data.get(), _data.get() + nb_spans(_size),
                   b ? ~span_type(0) : span_type(0));
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cassert>
 #include <concepts>
+#include <limits>
 #include <numeric>
 #include <ranges>
 #include <span>
@@ -13,10 +14,12 @@
 namespace fhamonic {
 namespace melon {
 
-class static_forward_digraph {
+template <std::unsigned_integral V = unsigned int,
+          std::unsigned_integral A = unsigned int>
+class basic_static_forward_digraph {
 private:
-    using vertex = unsigned int;
-    using arc = unsigned int;
+    using vertex = V;
+    using arc = A;
 
     static_map<vertex, arc> _out_arc_begin;
     static_map<arc, vertex> _arc_target;
@@ -25,27 +28,34 @@ public:
     template <std::ranges::forward_range S, std::ranges::forward_range T>
         requires std::convertible_to<std::ranges::range_value_t<S>, vertex> &&
                      std::convertible_to<std::ranges::range_value_t<T>, vertex>
-    static_forward_digraph(const std::size_t & num_vertices, S && sources,
-                           T && targets) noexcept
-        : _out_arc_begin(num_vertices, 0), _arc_target(std::move(targets)) {
+    basic_static_forward_digraph(const std::size_t & num_vertices,
+                                 S && sources, T && targets,
+                                 const allocation_policy & alloc = {})
+        : _out_arc_begin(num_vertices, 0, alloc)
+        , _arc_target(std::move(targets), alloc) {
         assert(std::ranges::all_of(
             sources, [n = num_vertices](auto && v) { return v < n; }));
         assert(std::ranges::all_of(
             targets, [n = num_vertices](auto && v) { return v < n; }));
         assert(std::ranges::is_sorted(sources));
-        for(auto && s : sources) ++_out_arc_begin[s];
+        assert(num_vertices <= std::numeric_limits<vertex>::max());
+        assert(_arc_target.size() <= std::numeric_limits<arc>::max());
+        for(auto && s : sources) ++_out_arc_begin[static_cast<vertex>(s)];
         std::exclusive_scan(_out_arc_begin.data(),
                             _out_arc_begin.data() + num_vertices,
-                            _out_arc_begin.data(), 0);
+                            _out_arc_begin.data(), arc{0});
     }
 
-    static_forward_digraph() = default;
-    static_forward_digraph(const static_forward_digraph & graph) = default;
-    static_forward_digraph(static_forward_digraph && graph) = default;
+    basic_static_forward_digraph() = default;
+    basic_static_forward_digraph(const basic_static_forward_digraph & graph) =
+        default;
+    basic_static_forward_digraph(basic_static_forward_digraph && graph) =
+        default;
 
-    static_forward_digraph & operator=(const static_forward_digraph &) =
+    basic_static_forward_digraph & operator=(
+        const basic_static_forward_digraph &) = default;
+    basic_static_forward_digraph & operator=(basic_static_forward_digraph &&) =
         default;
-    static_forward_digraph & operator=(static_forward_digraph &&) = default;
 
     auto num_vertices() const noexcept { return _out_arc_begin.size(); }
     auto num_arcs() const noexcept { return _arc_target.size(); }
@@ -63,11 +73,18 @@ public:
         return std::views::iota(static_cast<arc>(0),
                                 static_cast<arc>(num_arcs()));
     }
+
+private:
+    arc out_arcs_end(const vertex & u) const noexcept {
+        return u + 1u < num_vertices()
+                   ? _out_arc_begin[static_cast<vertex>(u + 1u)]
+                   : static_cast<arc>(num_arcs());
+    }
+
+public:
     auto out_arcs(const vertex & u) const noexcept {
         assert(is_valid_vertex(u));
-        return std::views::iota(
-            _out_arc_begin[u],
-            (u + 1 < num_vertices() ? _out_arc_begin[u + 1] : num_arcs()));
+        return std::views::iota(_out_arc_begin[u], out_arcs_end(u));
     }
     vertex arc_target(const arc & a) const noexcept {
         assert(is_valid_arc(a));
@@ -76,32 +93,34 @@ public:
     const auto & arc_targets_map() const { return _arc_target; }
     auto out_neighbors(const vertex & u) const noexcept {
         assert(is_valid_vertex(u));
-        return std::span(
-            _arc_target.data() + _out_arc_begin[u],
-            (u + 1 < num_vertices() ? _arc_target.data() + _out_arc_begin[u + 1]
-                                   : _arc_target.data() + num_arcs()));
+        return std::span(_arc_target.data() + _out_arc_begin[u],
+                         _arc_target.data() + out_arcs_end(u));
     }
 
     template <typename T>
     static_map<vertex, T> create_vertex_map() const noexcept {
-        return static_map<vertex, T>(num_vertices());
+        return static_map<vertex, T>(num_vertices(), _out_arc_begin.policy());
     }
     template <typename T>
     static_map<vertex, T> create_vertex_map(
         const T & default_value) const noexcept {
-        return static_map<vertex, T>(num_vertices(), default_value);
+        return static_map<vertex, T>(num_vertices(), default_value,
+                                     _out_arc_begin.policy());
     }
 
     template <typename T>
     static_map<arc, T> create_arc_map() const noexcept {
-        return static_map<arc, T>(num_arcs());
+        return static_map<arc, T>(num_arcs(), _out_arc_begin.policy());
     }
     template <typename T>
     static_map<arc, T> create_arc_map(const T & default_value) const noexcept {
-        return static_map<arc, T>(num_arcs(), default_value);
+        return static_map<arc, T>(num_arcs(), default_value,
+                                  _out_arc_begin.policy());
     }
 };
 
+using static_forward_digraph = basic_static_forward_digraph<>;
+
 }  // namespace melon
 }  // namespace fhamonic
 
@@ -0,0 +1,186 @@
+#ifndef MELON_STATIC_FORWARD_WEIGHTED_DIGRAPH_HPP
+#define MELON_STATIC_FORWARD_WEIGHTED_DIGRAPH_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <ranges>
+
+#include "melon/container/static_map.hpp"
+#include "melon/mapping.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Forward static graph whose arcs store their target and their weight
+// contiguously, such that traversals reading both touch a single array.
+template <typename W, std::unsigned_integral V = unsigned int,
+          std::unsigned_integral A = unsigned int>
+class basic_static_forward_weighted_digraph {
+private:
+    using vertex = V;
+    using arc = A;
+
+    struct arc_entry {
+        vertex target;
+        W weight;
+    };
+
+    // Read only view of a field of the arc entries, whose address_of allows
+    // prefetch_mapped_values to prefetch the interleaved entries.
+    template <auto _Member>
+    class arc_entry_field_map : public mapping_view_base {
+    private:
+        const arc_entry * _entries;
+
+    public:
+        [[nodiscard]] constexpr arc_entry_field_map() noexcept
+            : _entries(nullptr) {}
+        [[nodiscard]] constexpr explicit arc_entry_field_map(
+            const arc_entry * entries) noexcept
+            : _entries(entries) {}
+
+        [[nodiscard]] constexpr const auto & operator[](
+            const arc a) const noexcept {
+            return _entries[a].*_Member;
+        }
+        [[nodiscard]] constexpr const auto * address_of(
+            const arc a) const noexcept {
+            return std::addressof(_entries[a].*_Member);
+        }
+    };
+
+    static_map<vertex, arc> _out_arc_begin;
+    static_map<arc, arc_entry> _arcs;
+
+public:
+    template <std::ranges::forward_range S, std::ranges::forward_range T,
+              std::ranges::forward_range P>
+        requires std::convertible_to<std::ranges::range_value_t<S>, vertex> &&
+                     std::convertible_to<std::ranges::range_value_t<T>,
+                                         vertex> &&
+                     std::convertible_to<std::ranges::range_value_t<P>, W>
+    [[nodiscard]] basic_static_forward_weighted_digraph(
+        const std::size_t & num_vertices, S && sources, T && targets,
+        P && weights) noexcept
+        : _out_arc_begin(num_vertices, 0)
+        , _arcs(static_cast<std::size_t>(std::ranges::distance(targets))) {
+        assert(std::ranges::all_of(
+            sources, [n = num_vertices](auto && v) { return v < n; }));
+        assert(std::ranges::all_of(
+            targets, [n = num_vertices](auto && v) { return v < n; }));
+        assert(std::ranges::is_sorted(sources));
+        assert(static_cast<std::size_t>(std::ranges::distance(sources)) ==
+               _arcs.size());
+        assert(static_cast<std::size_t>(std::ranges::distance(weights)) ==
+               _arcs.size());
+        assert(num_vertices <= std::numeric_limits<vertex>::max());
+        assert(_arcs.size() <= std::numeric_limits<arc>::max());
+        for(auto && s : sources) ++_out_arc_begin[static_cast<vertex>(s)];
+        std::exclusive_scan(_out_arc_begin.data(),
+                            _out_arc_begin.data() + num_vertices,
+                            _out_arc_begin.data(), arc{0});
+        auto target_it = std::ranges::begin(targets);
+        auto weight_it = std::ranges::begin(weights);
+        for(auto && entry : _arcs) {
+            entry.target = static_cast<vertex>(*target_it);
+            entry.weight = static_cast<W>(*weight_it);
+            ++target_it;
+            ++weight_it;
+        }
+    }
+
+    [[nodiscard]] basic_static_forward_weighted_digraph() = default;
+    [[nodiscard]] basic_static_forward_weighted_digraph(
+        const basic_static_forward_weighted_digraph & graph) = default;
+    [[nodiscard]] basic_static_forward_weighted_digraph(
+        basic_static_forward_weighted_digraph && graph) = default;
+
+    basic_static_forward_weighted_digraph & operator=(
+        const basic_static_forward_weighted_digraph &) = default;
+    basic_static_forward_weighted_digraph & operator=(
+        basic_static_forward_weighted_digraph &&) = default;
+
+    [[nodiscard]] constexpr auto num_vertices() const noexcept {
+        return _out_arc_begin.size();
+    }
+    [[nodiscard]] constexpr auto num_arcs() const noexcept {
+        return _arcs.size();
+    }
+
+    [[nodiscard]] constexpr bool is_valid_vertex(
+        const vertex u) const noexcept {
+        return u < num_vertices();
+    }
+    [[nodiscard]] constexpr bool is_valid_arc(const arc a) const noexcept {
+        return a < num_arcs();
+    }
+
+    [[nodiscard]] constexpr auto vertices() const noexcept {
+        return std::views::iota(static_cast<vertex>(0),
+                                static_cast<vertex>(num_vertices()));
+    }
+    [[nodiscard]] constexpr auto arcs() const noexcept {
+        return std::views::iota(static_cast<arc>(0),
+                                static_cast<arc>(num_arcs()));
+    }
+
+private:
+    [[nodiscard]] constexpr arc out_arcs_end(const vertex u) const noexcept {
+        return u + 1u < num_vertices()
+                   ? _out_arc_begin[static_cast<vertex>(u + 1u)]
+                   : static_cast<arc>(num_arcs());
+    }
+
+public:
+    [[nodiscard]] constexpr auto out_arcs(const vertex u) const noexcept {
+        assert(is_valid_vertex(u));
+        return std::views::iota(_out_arc_begin[u], out_arcs_end(u));
+    }
+    [[nodiscard]] constexpr vertex arc_target(const arc a) const noexcept {
+        assert(is_valid_arc(a));
+        return _arcs[a].target;
+    }
+    [[nodiscard]] constexpr const W & arc_weight(const arc a) const noexcept {
+        assert(is_valid_arc(a));
+        return _arcs[a].weight;
+    }
+
+    [[nodiscard]] constexpr auto arc_targets_map() const noexcept {
+        return arc_entry_field_map<&arc_entry::target>(_arcs.data());
+    }
+    [[nodiscard]] constexpr auto arc_weights_map() const noexcept {
+        return arc_entry_field_map<&arc_entry::weight>(_arcs.data());
+    }
+
+    template <typename T>
+    [[nodiscard]] constexpr auto create_vertex_map() const noexcept {
+        return static_map<vertex, T>(num_vertices());
+    }
+    template <typename T>
+    [[nodiscard]] constexpr auto create_vertex_map(
+        const T & default_value) const noexcept {
+        return static_map<vertex, T>(num_vertices(), default_value);
+    }
+
+    template <typename T>
+    [[nodiscard]] constexpr auto create_arc_map() const noexcept {
+        return static_map<arc, T>(num_arcs());
+    }
+    template <typename T>
+    [[nodiscard]] constexpr auto create_arc_map(
+        const T & default_value) const noexcept {
+        return static_map<arc, T>(num_arcs(), default_value);
+    }
+};
+
+template <typename W>
+using static_forward_weighted_digraph = basic_static_forward_weighted_digraph<W>;
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_STATIC_FORWARD_WEIGHTED_DIGRAPH_HPP
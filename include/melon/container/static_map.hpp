@@ -7,6 +7,10 @@
 #include <iterator>
 #include <memory>
 #include <ranges>
+#include <stdexcept>
+
+#include "melon/detail/allocation.hpp"
+#include "melon/detail/parallel.hpp"
 
 namespace fhamonic {
 namespace melon {
@@ -27,36 +31,71 @@ public:
     using const_iterator = const mapped_type *;
 
 private:
-    std::unique_ptr<mapped_type[]> _data;
+    detail::policy_array<mapped_type> _data;
     size_type _size;
+    allocation_policy _policy;
+
+    template <std::random_access_iterator IT>
+    void copy_from(IT it_begin) {
+        detail::parallel_for_chunks(
+            num_chunks(), _size,
+            [this, it_begin](std::size_t, const std::size_t b,
+                             const std::size_t e) {
+                std::copy(
+                    it_begin + static_cast<std::iter_difference_t<IT>>(b),
+                    it_begin + static_cast<std::iter_difference_t<IT>>(e),
+                    _data.get() + b);
+            });
+    }
+    // Maps smaller than grain_size per thread are not worth spawning threads.
+    static constexpr std::size_t grain_size = 256;
+    [[nodiscard]] std::size_t num_chunks() const noexcept {
+        if(_policy.num_threads == 1) return 1;
+        return std::max(std::size_t{1}, std::min(detail::num_threads(_policy),
+                                                 _size / grain_size));
+    }
 
 public:
-    [[nodiscard]] constexpr static_map() noexcept : _data(nullptr), _size(0){};
-    [[nodiscard]] constexpr explicit static_map(const size_type size)
-        : _data(std::make_unique_for_overwrite<mapped_type[]>(size))
-        , _size(size){};
+    [[nodiscard]] constexpr static_map() noexcept
+        : _data(nullptr), _size(0), _policy(){};
+    [[nodiscard]] constexpr explicit static_map(
+        const size_type size, const allocation_policy & policy = {})
+        : _data(detail::allocate_array<mapped_type>(size, policy))
+        , _size(size)
+        , _policy(policy){};
 
     [[nodiscard]] constexpr static_map(const size_type size,
-                                       const mapped_type & init_value)
-        : static_map(size) {
-        std::fill(_data.get(), _data.get() + _size, init_value);
+                                       const mapped_type & init_value,
+                                       const allocation_policy & policy = {})
+        : static_map(size, policy) {
+        fill(init_value);
     }
 
     template <std::random_access_iterator IT>
-    [[nodiscard]] constexpr static_map(IT && it_begin, IT && it_end)
-        : static_map(static_cast<size_type>(std::distance(it_begin, it_end))) {
-        std::copy(it_begin, it_end, _data.get());
+    [[nodiscard]] constexpr static_map(IT && it_begin, IT && it_end,
+                                       const allocation_policy & policy = {})
+        : static_map(static_cast<size_type>(std::distance(it_begin, it_end)),
+                     policy) {
+        copy_from(it_begin);
     }
     template <std::ranges::random_access_range R>
-    [[nodiscard]] constexpr explicit static_map(R && r)
-        : static_map(r.begin(), r.end()) {}
+        requires(!std::same_as<std::remove_cvref_t<R>, static_map>)
+    [[nodiscard]] constexpr explicit static_map(
+        R && r, const allocation_policy & policy = {})
+        : static_map(r.begin(), r.end(), policy) {}
     static_map(const static_map & other)
-        : static_map(other.data(), other.data() + other.size()){};
+        : static_map(other.data(), other.data() + other.size(),
+                     other.policy()){};
     [[nodiscard]] constexpr static_map(static_map &&) = default;
 
     static_map & operator=(const static_map & other) {
-        resize(other.size());
-        std::copy(other.data(), other.data() + other.size(), _data.get());
+        if(_policy != other._policy) {
+            _policy = other._policy;
+            _data = detail::allocate_array<mapped_type>(other.size(), _policy);
+            _size = other.size();
+        } else
+            resize(other.size());
+        copy_from(other.data());
         return *this;
     }
     static_map & operator=(static_map &&) = default;
@@ -75,9 +114,12 @@ public:
     [[nodiscard]] constexpr size_type size() const noexcept { return _size; }
     constexpr void resize(const size_type n) {
         if(n == size()) return;
-        _data = std::make_unique_for_overwrite<mapped_type[]>(n);
+        _data = detail::allocate_array<mapped_type>(n, _policy);
         _size = n;
     }
+    [[nodiscard]] constexpr const allocation_policy & policy() const noexcept {
+        return _policy;
+    }
 
     [[nodiscard]] constexpr mapped_type & operator[](
         const key_type i) noexcept {
@@ -95,8 +137,20 @@ public:
         return _data[static_cast<size_type>(i)];
     }
 
-    void fill(const mapped_type & v) noexcept {
-        std::fill(_data.get(), _data.get() + size(), v);
+    // Runs in parallel with the policy threads, such that with the first
+    // touch policy the values are written by the threads that placed them.
+    // Small maps are filled by the calling thread.
+    void fill(const mapped_type & v) {
+        const std::size_t chunks = num_chunks();
+        if(chunks == 1) {
+            std::fill(_data.get(), _data.get() + _size, v);
+            return;
+        }
+        detail::parallel_for_chunks(
+            chunks, _size,
+            [this, &v](std::size_t, const std::size_t b, const std::size_t e) {
+                std::fill(_data.get() + b, _data.get() + e, v);
+            });
     }
 
     [[nodiscard]] constexpr mapped_type * data() noexcept {
@@ -0,0 +1,96 @@
+#ifndef MELON_TIMESTAMPED_MAP_HPP
+#define MELON_TIMESTAMPED_MAP_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <vector>
+
+namespace fhamonic {
+namespace melon {
+
+// Static map whose fill is O(1) : every value is stored with the timestamp
+// of its last write, and fill only records the new default value and starts
+// a new timestamp, the values of older timestamps reading as the default.
+// Writing through the non-const operator[] first restores the default value
+// of a stale key. Meant for the status maps of the searches that only reach
+// a few vertices of a large graph between two resets.
+//
+// The timestamps are reset once every 2^digits(S) - 1 fills.
+template <std::integral K = std::size_t, typename V = std::size_t,
+          std::unsigned_integral S = unsigned int>
+class timestamped_map {
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using size_type = std::size_t;
+    using timestamp_type = S;
+
+private:
+    struct entry {
+        timestamp_type timestamp;
+        mapped_type value;
+    };
+
+    std::vector<entry> _entries;
+    timestamp_type _timestamp;
+    mapped_type _default_value;
+
+public:
+    [[nodiscard]] constexpr timestamped_map()
+        : _entries(), _timestamp(1), _default_value() {}
+    [[nodiscard]] constexpr explicit timestamped_map(const size_type size)
+        : _entries(size, entry{0, mapped_type()})
+        , _timestamp(1)
+        , _default_value() {}
+    [[nodiscard]] constexpr timestamped_map(const size_type size,
+                                            const mapped_type & init_value)
+        : _entries(size, entry{0, init_value})
+        , _timestamp(1)
+        , _default_value(init_value) {}
+
+    [[nodiscard]] constexpr timestamped_map(const timestamped_map &) = default;
+    [[nodiscard]] constexpr timestamped_map(timestamped_map &&) = default;
+
+    constexpr timestamped_map & operator=(const timestamped_map &) = default;
+    constexpr timestamped_map & operator=(timestamped_map &&) = default;
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return _entries.size();
+    }
+    constexpr void resize(const size_type n) {
+        _entries.assign(n, entry{0, _default_value});
+        _timestamp = 1;
+    }
+
+    [[nodiscard]] constexpr mapped_type & operator[](
+        const key_type i) noexcept {
+        assert(static_cast<size_type>(i) < size());
+        entry & e = _entries[static_cast<size_type>(i)];
+        if(e.timestamp != _timestamp) {
+            e.timestamp = _timestamp;
+            e.value = _default_value;
+        }
+        return e.value;
+    }
+    [[nodiscard]] constexpr const mapped_type & operator[](
+        const key_type i) const noexcept {
+        assert(static_cast<size_type>(i) < size());
+        const entry & e = _entries[static_cast<size_type>(i)];
+        if(e.timestamp != _timestamp) return _default_value;
+        return e.value;
+    }
+
+    constexpr void fill(const mapped_type & v) noexcept {
+        _default_value = v;
+        if(++_timestamp != 0) return;
+        for(entry & e : _entries) e.timestamp = 0;
+        _timestamp = 1;
+    }
+};
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_TIMESTAMPED_MAP_HPP
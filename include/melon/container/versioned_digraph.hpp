@@ -0,0 +1,474 @@
+#ifndef MELON_VERSIONED_DIGRAPH_HPP
+#define MELON_VERSIONED_DIGRAPH_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "melon/container/static_map.hpp"
+#include "melon/mapping.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Forward digraph with arc properties serving immutable snapshots to
+// concurrent readers while a single writer prepares the next version.
+//
+// The CSR arrays are split in segments of 2^segment_bits consecutive source
+// vertices. Publishing a version copies only the segments touched by the
+// pending modifications, the other ones being shared with the previous
+// version. Readers pin the current version by announcing the epoch they
+// started at, and the writer frees the retired versions and segments once no
+// reader announces an epoch older than their retirement.
+//
+// Arc ids are dense in each version but are not stable across versions :
+// arcs are handles carrying their source and target, which convert to their
+// id for indexing the arc maps of the snapshot they come from.
+template <typename P, std::unsigned_integral V = unsigned int,
+          std::unsigned_integral A = unsigned int>
+class basic_versioned_digraph {
+public:
+    using vertex = V;
+    using arc_id = A;
+    using property_type = P;
+
+    struct arc {
+        arc_id id;
+        vertex source;
+        vertex target;
+
+        [[nodiscard]] constexpr operator arc_id() const noexcept { return id; }
+        [[nodiscard]] friend constexpr bool operator==(const arc &,
+                                                       const arc &) = default;
+        [[nodiscard]] friend constexpr auto operator<=>(const arc &,
+                                                        const arc &) = default;
+    };
+
+private:
+    struct segment {
+        std::vector<arc_id> out_arc_begin;  // local offsets, one per vertex + 1
+        std::vector<vertex> targets;
+        std::vector<P> properties;
+    };
+    struct version {
+        std::uint64_t number;
+        std::size_t num_vertices;
+        std::size_t num_arcs;
+        unsigned int segment_bits;
+        std::vector<const segment *> segments;
+        std::vector<arc_id> segment_arc_begin;
+    };
+    struct retired {
+        std::uint64_t epoch;
+        std::unique_ptr<const version> old_version;
+        std::vector<std::unique_ptr<const segment>> old_segments;
+    };
+    struct segment_delta {
+        std::vector<arc_id> removed;
+        std::vector<std::pair<arc_id, P>> changed;
+        std::vector<std::tuple<vertex, vertex, P>> added;
+    };
+
+    // 0 for a free reader slot, otherwise the epoch the reader started at
+    std::unique_ptr<std::atomic<std::uint64_t>[]> _reader_epochs;
+    std::size_t _max_readers;
+    std::atomic<std::uint64_t> _epoch;
+    std::atomic<const version *> _current;
+
+    // writer state
+    std::unique_ptr<const version> _current_owner;
+    std::vector<std::unique_ptr<const segment>> _segments_owners;
+    std::vector<retired> _retired;
+    std::vector<segment_delta> _deltas;
+    std::vector<std::size_t> _touched_segments;
+
+public:
+    // Immutable view of a version, that keeps it alive until destruction.
+    class snapshot {
+    private:
+        const version * _version;
+        std::atomic<std::uint64_t> * _slot;
+
+        friend class basic_versioned_digraph;
+        [[nodiscard]] snapshot(const version * v,
+                               std::atomic<std::uint64_t> * slot) noexcept
+            : _version(v), _slot(slot) {}
+
+        [[nodiscard]] constexpr std::size_t segment_of(
+            const vertex u) const noexcept {
+            return static_cast<std::size_t>(u) >> _version->segment_bits;
+        }
+        [[nodiscard]] constexpr std::size_t local_vertex(
+            const vertex u) const noexcept {
+            return static_cast<std::size_t>(u) &
+                   ((std::size_t{1} << _version->segment_bits) - 1);
+        }
+
+    public:
+        // Read only arc map of the arc properties of the snapshot.
+        class property_map : public mapping_view_base {
+        private:
+            const version * _version;
+
+        public:
+            [[nodiscard]] constexpr property_map() noexcept
+                : _version(nullptr) {}
+            [[nodiscard]] constexpr explicit property_map(
+                const version * v) noexcept
+                : _version(v) {}
+
+            [[nodiscard]] constexpr const P & operator[](
+                const arc & a) const noexcept {
+                const std::size_t s =
+                    static_cast<std::size_t>(a.source) >> _version->segment_bits;
+                return _version->segments[s]
+                    ->properties[a.id - _version->segment_arc_begin[s]];
+            }
+        };
+
+        [[nodiscard]] snapshot() noexcept : _version(nullptr), _slot(nullptr) {}
+        [[nodiscard]] snapshot(snapshot && other) noexcept
+            : _version(std::exchange(other._version, nullptr))
+            , _slot(std::exchange(other._slot, nullptr)) {}
+        snapshot & operator=(snapshot && other) noexcept {
+            if(this != &other) {
+                release();
+                _version = std::exchange(other._version, nullptr);
+                _slot = std::exchange(other._slot, nullptr);
+            }
+            return *this;
+        }
+        snapshot(const snapshot &) = delete;
+        snapshot & operator=(const snapshot &) = delete;
+        ~snapshot() { release(); }
+
+        void release() noexcept {
+            if(_slot != nullptr) _slot->store(0);
+            _version = nullptr;
+            _slot = nullptr;
+        }
+
+        [[nodiscard]] constexpr std::uint64_t version_number() const noexcept {
+            return _version->number;
+        }
+        [[nodiscard]] constexpr std::size_t num_vertices() const noexcept {
+            return _version->num_vertices;
+        }
+        [[nodiscard]] constexpr std::size_t num_arcs() const noexcept {
+            return _version->num_arcs;
+        }
+        [[nodiscard]] constexpr bool is_valid_vertex(
+            const vertex u) const noexcept {
+            return u < num_vertices();
+        }
+        [[nodiscard]] constexpr bool is_valid_arc(
+            const arc & a) const noexcept {
+            return a.id < num_arcs();
+        }
+
+        [[nodiscard]] constexpr auto vertices() const noexcept {
+            return std::views::iota(static_cast<vertex>(0),
+                                    static_cast<vertex>(num_vertices()));
+        }
+        [[nodiscard]] constexpr auto out_arcs(const vertex u) const noexcept {
+            assert(is_valid_vertex(u));
+            const std::size_t s = segment_of(u);
+            const segment * seg = _version->segments[s];
+            const std::size_t i = local_vertex(u);
+            return std::views::transform(
+                std::views::iota(seg->out_arc_begin[i],
+                                 seg->out_arc_begin[i + 1]),
+                [seg, u, first = _version->segment_arc_begin[s]](
+                    const arc_id j) -> arc {
+                    return arc{static_cast<arc_id>(first + j), u,
+                               seg->targets[j]};
+                });
+        }
+        [[nodiscard]] constexpr auto out_neighbors(
+            const vertex u) const noexcept {
+            assert(is_valid_vertex(u));
+            const segment * seg = _version->segments[segment_of(u)];
+            const std::size_t i = local_vertex(u);
+            return std::span<const vertex>(
+                seg->targets.data() + seg->out_arc_begin[i],
+                seg->targets.data() + seg->out_arc_begin[i + 1]);
+        }
+        [[nodiscard]] constexpr auto arcs() const noexcept {
+            return std::views::join(std::views::transform(
+                vertices(), [this](const vertex u) { return out_arcs(u); }));
+        }
+        [[nodiscard]] constexpr vertex arc_source(
+            const arc & a) const noexcept {
+            assert(is_valid_arc(a));
+            return a.source;
+        }
+        [[nodiscard]] constexpr vertex arc_target(
+            const arc & a) const noexcept {
+            assert(is_valid_arc(a));
+            return a.target;
+        }
+        [[nodiscard]] constexpr property_map arc_property_map() const noexcept {
+            return property_map(_version);
+        }
+
+        template <typename T>
+        [[nodiscard]] constexpr auto create_vertex_map() const noexcept {
+            return static_map<vertex, T>(num_vertices());
+        }
+        template <typename T>
+        [[nodiscard]] constexpr auto create_vertex_map(
+            const T & default_value) const noexcept {
+            return static_map<vertex, T>(num_vertices(), default_value);
+        }
+        template <typename T>
+        [[nodiscard]] constexpr auto create_arc_map() const noexcept {
+            return static_map<arc_id, T>(num_arcs());
+        }
+        template <typename T>
+        [[nodiscard]] constexpr auto create_arc_map(
+            const T & default_value) const noexcept {
+            return static_map<arc_id, T>(num_arcs(), default_value);
+        }
+    };
+
+public:
+    template <std::ranges::forward_range S, std::ranges::forward_range T,
+              std::ranges::forward_range R>
+        requires std::convertible_to<std::ranges::range_value_t<S>, vertex> &&
+                     std::convertible_to<std::ranges::range_value_t<T>,
+                                         vertex> &&
+                     std::convertible_to<std::ranges::range_value_t<R>, P>
+    [[nodiscard]] basic_versioned_digraph(const std::size_t num_vertices,
+                                          S && sources, T && targets,
+                                          R && properties,
+                                          const unsigned int segment_bits = 8,
+                                          const std::size_t max_readers = 64)
+        : _reader_epochs(
+              std::make_unique<std::atomic<std::uint64_t>[]>(max_readers))
+        , _max_readers(max_readers)
+        , _epoch(1)
+        , _current(nullptr) {
+        assert(std::ranges::is_sorted(sources));
+        assert(num_vertices <= std::numeric_limits<vertex>::max());
+        assert(max_readers > 0);
+        for(std::size_t i = 0; i < max_readers; ++i) _reader_epochs[i] = 0;
+        auto v = std::make_unique<version>();
+        v->number = 0;
+        v->num_vertices = num_vertices;
+        v->segment_bits = segment_bits;
+        const std::size_t num_segments =
+            (num_vertices >> segment_bits) +
+            ((num_vertices & ((std::size_t{1} << segment_bits) - 1)) ? 1 : 0);
+        _segments_owners.resize(num_segments);
+        _deltas.resize(num_segments);
+
+        auto s_it = std::ranges::begin(sources);
+        auto t_it = std::ranges::begin(targets);
+        auto p_it = std::ranges::begin(properties);
+        const auto s_end = std::ranges::end(sources);
+        for(std::size_t s = 0; s < num_segments; ++s) {
+            auto seg = std::make_unique<segment>();
+            const std::size_t first_vertex = s << segment_bits;
+            const std::size_t segment_size = std::min(
+                std::size_t{1} << segment_bits, num_vertices - first_vertex);
+            seg->out_arc_begin.assign(segment_size + 1, arc_id{0});
+            for(; s_it != s_end &&
+                  static_cast<std::size_t>(*s_it) < first_vertex + segment_size;
+                ++s_it, ++t_it, ++p_it) {
+                assert(static_cast<std::size_t>(*t_it) < num_vertices);
+                ++seg->out_arc_begin[static_cast<std::size_t>(*s_it) -
+                                     first_vertex + 1];
+                seg->targets.push_back(static_cast<vertex>(*t_it));
+                seg->properties.push_back(static_cast<P>(*p_it));
+            }
+            std::partial_sum(seg->out_arc_begin.begin(),
+                             seg->out_arc_begin.end(),
+                             seg->out_arc_begin.begin());
+            _segments_owners[s] = std::move(seg);
+        }
+        v->segments.resize(num_segments);
+        for(std::size_t s = 0; s < num_segments; ++s)
+            v->segments[s] = _segments_owners[s].get();
+        compute_arc_offsets(*v);
+        _current.store(v.get());
+        _current_owner = std::move(v);
+    }
+
+    basic_versioned_digraph(const basic_versioned_digraph &) = delete;
+    basic_versioned_digraph & operator=(const basic_versioned_digraph &) =
+        delete;
+
+    [[nodiscard]] std::size_t max_readers() const noexcept {
+        return _max_readers;
+    }
+
+    // Thread safe, the snapshot must be destroyed before the graph.
+    // Returns std::nullopt if max_readers() snapshots are already alive.
+    [[nodiscard]] std::optional<snapshot> try_pin() const noexcept {
+        for(std::size_t i = 0; i < _max_readers; ++i) {
+            std::uint64_t expected = 0;
+            if(_reader_epochs[i].compare_exchange_strong(expected,
+                                                         _epoch.load()))
+                return snapshot(_current.load(), &_reader_epochs[i]);
+        }
+        return std::nullopt;
+    }
+
+    // Thread safe, the snapshot must be destroyed before the graph.
+    // At most max_readers() snapshots can be alive at once : when all the
+    // reader slots are taken, waits until another thread releases one, thus
+    // never returns if the calling thread holds them all.
+    [[nodiscard]] snapshot pin() const noexcept {
+        for(;;) {
+            if(auto s = try_pin()) return std::move(*s);
+            std::this_thread::yield();
+        }
+    }
+
+    // The following members must be called from the single writer thread.
+    // The arcs handles refer to the current version.
+
+    void add_arc(const vertex u, const vertex v, const P & property) {
+        assert(u < _current_owner->num_vertices);
+        assert(v < _current_owner->num_vertices);
+        delta_of(u).added.emplace_back(u, v, property);
+    }
+    void remove_arc(const arc & a) {
+        assert(a.id < _current_owner->num_arcs);
+        delta_of(a.source).removed.push_back(local_arc(a));
+    }
+    void set_arc_property(const arc & a, const P & property) {
+        assert(a.id < _current_owner->num_arcs);
+        delta_of(a.source).changed.emplace_back(local_arc(a), property);
+    }
+    [[nodiscard]] bool has_pending_modifications() const noexcept {
+        return !_touched_segments.empty();
+    }
+
+    // Publishes a new version holding the pending modifications and frees
+    // the retired versions that no reader can access anymore.
+    std::uint64_t publish() {
+        auto v = std::make_unique<version>(*_current_owner);
+        ++v->number;
+        retired r;
+        for(const std::size_t s : _touched_segments) {
+            auto seg = apply_delta(*_segments_owners[s], _deltas[s],
+                                   s << v->segment_bits);
+            v->segments[s] = seg.get();
+            r.old_segments.push_back(std::move(_segments_owners[s]));
+            _segments_owners[s] = std::move(seg);
+            _deltas[s] = segment_delta{};
+        }
+        _touched_segments.clear();
+        compute_arc_offsets(*v);
+        _current.store(v.get());
+        r.old_version = std::exchange(_current_owner, std::move(v));
+        r.epoch = _epoch.fetch_add(1) + 1;
+        _retired.push_back(std::move(r));
+        reclaim();
+        return _current_owner->number;
+    }
+
+    // Frees the retired versions and segments of epochs older than every
+    // active reader.
+    void reclaim() {
+        std::uint64_t min_epoch = std::numeric_limits<std::uint64_t>::max();
+        for(std::size_t i = 0; i < _max_readers; ++i) {
+            const std::uint64_t e = _reader_epochs[i].load();
+            if(e != 0) min_epoch = std::min(min_epoch, e);
+        }
+        std::erase_if(_retired,
+                      [min_epoch](const retired & r) {
+                          return r.epoch <= min_epoch;
+                      });
+    }
+    [[nodiscard]] std::size_t num_retired_versions() const noexcept {
+        return _retired.size();
+    }
+
+private:
+    [[nodiscard]] std::size_t segment_of(const vertex u) const noexcept {
+        return static_cast<std::size_t>(u) >> _current_owner->segment_bits;
+    }
+    [[nodiscard]] arc_id local_arc(const arc & a) const noexcept {
+        return static_cast<arc_id>(
+            a.id - _current_owner->segment_arc_begin[segment_of(a.source)]);
+    }
+    segment_delta & delta_of(const vertex u) {
+        const std::size_t s = segment_of(u);
+        segment_delta & d = _deltas[s];
+        if(d.removed.empty() && d.changed.empty() && d.added.empty())
+            _touched_segments.push_back(s);
+        return d;
+    }
+
+    static void compute_arc_offsets(version & v) {
+        v.segment_arc_begin.resize(v.segments.size() + 1);
+        v.segment_arc_begin[0] = 0;
+        for(std::size_t s = 0; s < v.segments.size(); ++s)
+            v.segment_arc_begin[s + 1] = static_cast<arc_id>(
+                v.segment_arc_begin[s] + v.segments[s]->targets.size());
+        v.num_arcs = v.segment_arc_begin.back();
+        assert(v.num_arcs <= std::numeric_limits<arc_id>::max());
+    }
+
+    [[nodiscard]] static std::unique_ptr<const segment> apply_delta(
+        const segment & old_segment, segment_delta & delta,
+        const std::size_t first_vertex) {
+        const std::size_t old_num_arcs = old_segment.targets.size();
+        std::vector<bool> removed(old_num_arcs, false);
+        for(const arc_id j : delta.removed) removed[j] = true;
+        std::vector<P> properties(old_segment.properties);
+        for(auto && [j, p] : delta.changed) properties[j] = p;
+        std::ranges::stable_sort(delta.added, {}, [](auto && t) {
+            return std::get<0>(t);
+        });
+
+        auto seg = std::make_unique<segment>();
+        const std::size_t segment_size = old_segment.out_arc_begin.size() - 1;
+        seg->out_arc_begin.resize(segment_size + 1);
+        seg->targets.reserve(old_num_arcs + delta.added.size());
+        seg->properties.reserve(old_num_arcs + delta.added.size());
+        auto added_it = delta.added.begin();
+        for(std::size_t i = 0; i < segment_size; ++i) {
+            seg->out_arc_begin[i] = static_cast<arc_id>(seg->targets.size());
+            for(std::size_t j = old_segment.out_arc_begin[i];
+                j < old_segment.out_arc_begin[i + 1]; ++j) {
+                if(removed[j]) continue;
+                seg->targets.push_back(old_segment.targets[j]);
+                seg->properties.push_back(std::move(properties[j]));
+            }
+            for(; added_it != delta.added.end() &&
+                  static_cast<std::size_t>(std::get<0>(*added_it)) ==
+                      first_vertex + i;
+                ++added_it) {
+                seg->targets.push_back(std::get<1>(*added_it));
+                seg->properties.push_back(std::get<2>(*added_it));
+            }
+        }
+        seg->out_arc_begin[segment_size] =
+            static_cast<arc_id>(seg->targets.size());
+        assert(added_it == delta.added.end());
+        return seg;
+    }
+};
+
+template <typename P>
+using versioned_digraph = basic_versioned_digraph<P>;
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_VERSIONED_DIGRAPH_HPP
@@ -0,0 +1,197 @@
+#ifndef MELON_DETAIL_ALLOCATION_HPP
+#define MELON_DETAIL_ALLOCATION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "melon/detail/parallel.hpp"
+
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+#define MELON_HAS_ANONYMOUS_MMAP 1
+#include <sys/mman.h>
+#include <unistd.h>
+#if __has_include(<sys/syscall.h>)
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace fhamonic {
+namespace melon {
+
+enum class huge_pages_mode {
+    none,
+    // 2MB aligned mapping advised with MADV_HUGEPAGE
+    transparent,
+    // MAP_HUGETLB mapping, falling back to transparent if no huge page is
+    // reserved
+    explicit_pages
+};
+
+enum class numa_mode {
+    none,
+    // pages interleaved round robin on the online nodes
+    interleave,
+    // pages initialized by num_threads threads, each touching a contiguous
+    // chunk, such that they land on the nodes of the threads using them
+    first_touch
+};
+
+// How the arrays of static_map are allocated and initialized. The policies
+// are hints : they only apply to trivial types on platforms providing
+// anonymous mmap, and silently fall back to operator new otherwise.
+// num_threads = 0 stands for std::thread::hardware_concurrency().
+struct allocation_policy {
+    huge_pages_mode huge_pages = huge_pages_mode::none;
+    numa_mode numa = numa_mode::none;
+    std::size_t num_threads = 1;
+
+    [[nodiscard]] friend constexpr bool operator==(
+        const allocation_policy &, const allocation_policy &) = default;
+};
+
+namespace detail {
+
+[[nodiscard]] inline std::size_t num_threads(
+    const allocation_policy & policy) noexcept {
+    return num_threads(parallel_policy{policy.num_threads});
+}
+
+// Frees arrays allocated by allocate_array, mapped_bytes being 0 for arrays
+// allocated by new[].
+template <typename T>
+struct policy_deleter {
+    std::size_t mapped_bytes = 0;
+
+    void operator()(T * p) const noexcept {
+#ifdef MELON_HAS_ANONYMOUS_MMAP
+        if(mapped_bytes > 0) {
+            ::munmap(static_cast<void *>(p), mapped_bytes);
+            return;
+        }
+#endif
+        delete[] p;
+    }
+};
+
+template <typename T>
+using policy_array = std::unique_ptr<T[], policy_deleter<T>>;
+
+#ifdef MELON_HAS_ANONYMOUS_MMAP
+inline constexpr std::size_t huge_page_size = std::size_t{1} << 21;
+
+// Anonymous mapping of bytes, a multiple of alignment, whose address is
+// aligned on alignment.
+[[nodiscard]] inline void * map_aligned(const std::size_t bytes,
+                                        const std::size_t alignment) noexcept {
+    const std::size_t padded = bytes + alignment;
+    void * p = ::mmap(nullptr, padded, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED) return nullptr;
+    const auto address = reinterpret_cast<std::uintptr_t>(p);
+    const std::uintptr_t aligned = (address + alignment - 1) & ~(alignment - 1);
+    const std::size_t head = aligned - address;
+    if(head > 0) ::munmap(p, head);
+    if(padded - head > bytes)
+        ::munmap(reinterpret_cast<void *>(aligned + bytes),
+                 padded - head - bytes);
+    return reinterpret_cast<void *>(aligned);
+}
+
+// Best effort MPOL_INTERLEAVE binding of [p, p+bytes) on the online nodes.
+inline void interleave_pages([[maybe_unused]] void * p,
+                             [[maybe_unused]] const std::size_t bytes) {
+#if defined(__linux__) && defined(SYS_mbind)
+    static constexpr int MPOL_INTERLEAVE = 3;
+    static constexpr std::size_t max_nodes = 1024;
+    static constexpr std::size_t word_bits = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> mask(max_nodes / word_bits, 0ul);
+    std::error_code ec;
+    for(auto && entry : std::filesystem::directory_iterator(
+            "/sys/devices/system/node", ec)) {
+        const std::string name = entry.path().filename().string();
+        if(name.size() <= 4 || name.compare(0, 4, "node") != 0 ||
+           !std::all_of(name.begin() + 4, name.end(),
+                        [](const char c) { return c >= '0' && c <= '9'; }))
+            continue;
+        const std::size_t node = std::stoul(name.substr(4));
+        if(node < max_nodes) mask[node / word_bits] |= 1ul << (node % word_bits);
+    }
+    if(std::ranges::all_of(mask, [](const unsigned long w) { return w == 0; }))
+        return;
+    ::syscall(SYS_mbind, p, bytes, MPOL_INTERLEAVE, mask.data(), max_nodes + 1,
+              0u);
+#endif
+}
+#endif
+
+template <typename T>
+inline constexpr bool is_mappable_v = std::is_trivially_default_constructible_v<
+                                          T> &&
+                                      std::is_trivially_destructible_v<T>;
+
+// Storage for n default initialized T following the policy. With the
+// first_touch policy, the pages are touched by the threads that will
+// initialize the corresponding chunks.
+template <typename T>
+[[nodiscard]] policy_array<T> allocate_array(const std::size_t n,
+                                             const allocation_policy & policy) {
+#ifdef MELON_HAS_ANONYMOUS_MMAP
+    if constexpr(is_mappable_v<T>) {
+        if(n > 0 && (policy.huge_pages != huge_pages_mode::none ||
+                     policy.numa != numa_mode::none)) {
+            const std::size_t page_size =
+                static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+            const std::size_t alignment =
+                policy.huge_pages == huge_pages_mode::none ? page_size
+                                                           : huge_page_size;
+            const std::size_t bytes =
+                (n * sizeof(T) + alignment - 1) / alignment * alignment;
+            void * p = nullptr;
+#ifdef MAP_HUGETLB
+            if(policy.huge_pages == huge_pages_mode::explicit_pages) {
+                p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                if(p == MAP_FAILED) p = nullptr;
+            }
+#endif
+            if(p == nullptr) {
+                p = map_aligned(bytes, alignment);
+                if(p == nullptr) throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+                if(policy.huge_pages != huge_pages_mode::none)
+                    ::madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+            }
+            if(policy.numa == numa_mode::interleave) interleave_pages(p, bytes);
+            if(policy.numa == numa_mode::first_touch) {
+                auto * bytes_p = static_cast<std::byte *>(p);
+                const std::size_t num_chunks =
+                    std::max(std::size_t{1},
+                             std::min(num_threads(policy), bytes / page_size));
+                parallel_for_chunks(num_chunks, bytes,
+                                    [bytes_p](std::size_t, std::size_t b,
+                                              const std::size_t e) {
+                                        std::memset(bytes_p + b, 0, e - b);
+                                    });
+            }
+            return policy_array<T>(static_cast<T *>(p),
+                                   policy_deleter<T>{bytes});
+        }
+    }
+#endif
+    return policy_array<T>(new T[n], policy_deleter<T>{});
+}
+
+}  // namespace detail
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_DETAIL_ALLOCATION_HPP
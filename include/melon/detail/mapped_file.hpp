@@ -0,0 +1,123 @@
+#ifndef MELON_DETAIL_MAPPED_FILE_HPP
+#define MELON_DETAIL_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+#define MELON_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fhamonic {
+namespace melon {
+namespace detail {
+
+// Read-only view of a whole file. The file is mmap'ed when the platform
+// allows it, such that its pages are shared through the page cache between
+// every process mapping it, and read into an aligned buffer otherwise.
+class mapped_file {
+private:
+    const std::byte * _data = nullptr;
+    std::size_t _size = 0;
+#ifndef MELON_HAS_MMAP
+    struct aligned_delete {
+        void operator()(std::byte * p) const noexcept {
+            ::operator delete[](p, std::align_val_t{64});
+        }
+    };
+    std::unique_ptr<std::byte[], aligned_delete> _buffer;
+#endif
+
+public:
+    [[nodiscard]] mapped_file() noexcept = default;
+    [[nodiscard]] explicit mapped_file(const std::filesystem::path & path) {
+#ifdef MELON_HAS_MMAP
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if(fd < 0)
+            throw std::runtime_error("Cannot open '" + path.string() + "'.");
+        struct stat st;
+        if(::fstat(fd, &st) < 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot stat '" + path.string() + "'.");
+        }
+        _size = static_cast<std::size_t>(st.st_size);
+        if(_size > 0) {
+            void * p = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+            if(p == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Cannot map '" + path.string() +
+                                         "'.");
+            }
+            _data = static_cast<const std::byte *>(p);
+        }
+        ::close(fd);
+#else
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if(!file)
+            throw std::runtime_error("Cannot open '" + path.string() + "'.");
+        _size = static_cast<std::size_t>(file.tellg());
+        _buffer.reset(static_cast<std::byte *>(
+            ::operator new[](_size, std::align_val_t{64})));
+        file.seekg(0);
+        if(!file.read(reinterpret_cast<char *>(_buffer.get()),
+                      static_cast<std::streamsize>(_size)))
+            throw std::runtime_error("Cannot read '" + path.string() + "'.");
+        _data = _buffer.get();
+#endif
+    }
+
+    mapped_file(const mapped_file &) = delete;
+    mapped_file & operator=(const mapped_file &) = delete;
+
+    [[nodiscard]] mapped_file(mapped_file && other) noexcept
+        : _data(std::exchange(other._data, nullptr))
+        , _size(std::exchange(other._size, 0))
+#ifndef MELON_HAS_MMAP
+        , _buffer(std::move(other._buffer))
+#endif
+    {
+    }
+    mapped_file & operator=(mapped_file && other) noexcept {
+        if(this == &other) return *this;
+        unmap();
+        _data = std::exchange(other._data, nullptr);
+        _size = std::exchange(other._size, 0);
+#ifndef MELON_HAS_MMAP
+        _buffer = std::move(other._buffer);
+#endif
+        return *this;
+    }
+
+    ~mapped_file() { unmap(); }
+
+    [[nodiscard]] const std::byte * data() const noexcept { return _data; }
+    [[nodiscard]] std::size_t size() const noexcept { return _size; }
+
+private:
+    void unmap() noexcept {
+#ifdef MELON_HAS_MMAP
+        if(_data != nullptr)
+            ::munmap(const_cast<std::byte *>(_data), _size);
+#else
+        _buffer.reset();
+#endif
+        _data = nullptr;
+        _size = 0;
+    }
+};
+
+}  // namespace detail
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_DETAIL_MAPPED_FILE_HPP
@@ -0,0 +1,152 @@
+#ifndef MELON_DETAIL_PARALLEL_HPP
+#define MELON_DETAIL_PARALLEL_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace fhamonic {
+namespace melon {
+
+// Requests the multi-threaded variant of a construction or an algorithm.
+// num_threads = 0 stands for std::thread::hardware_concurrency().
+struct parallel_policy {
+    std::size_t num_threads = 0;
+};
+
+namespace detail {
+
+[[nodiscard]] inline std::size_t num_threads(
+    const parallel_policy & policy) noexcept {
+    if(policy.num_threads > 0) return policy.num_threads;
+    return std::max(std::size_t{1},
+                    static_cast<std::size_t>(std::thread::hardware_concurrency()));
+}
+
+// Splits [0,n) into num_chunks contiguous chunks, the i-th one being
+// [chunk_begin(i), chunk_begin(i+1)).
+[[nodiscard]] constexpr std::size_t chunk_begin(const std::size_t n,
+                                                const std::size_t num_chunks,
+                                                const std::size_t i) noexcept {
+    return n / num_chunks * i + std::min(i, n % num_chunks);
+}
+
+// Calls f(chunk_index, begin, end) on num_chunks contiguous chunks of [0,n),
+// each in its own thread, and waits for all of them.
+template <typename F>
+void parallel_for_chunks(const std::size_t num_chunks, const std::size_t n,
+                         F && f) {
+    assert(num_chunks > 0);
+    if(num_chunks == 1) {
+        f(std::size_t{0}, std::size_t{0}, n);
+        return;
+    }
+    std::vector<std::jthread> threads;
+    threads.reserve(num_chunks - 1);
+    for(std::size_t i = 1; i < num_chunks; ++i)
+        threads.emplace_back(f, i, chunk_begin(n, num_chunks, i),
+                             chunk_begin(n, num_chunks, i + 1));
+    f(std::size_t{0}, std::size_t{0}, chunk_begin(n, num_chunks, 1));
+}
+
+// Calls f(i) for every i in [0,n) using num_threads threads.
+template <typename F>
+void parallel_for(const std::size_t num_threads, const std::size_t n, F && f) {
+    parallel_for_chunks(
+        std::max(std::size_t{1}, std::min(num_threads, n)), n,
+        [&f](std::size_t, std::size_t begin, const std::size_t end) {
+            for(; begin < end; ++begin) f(begin);
+        });
+}
+
+// Stable LSD radix sort of keys, whose values are lower than 2^key_bits,
+// applying the same permutation to values. Each pass counts the digits of
+// every thread chunk, then the threads scatter their chunk to the positions
+// following the chunk order, which preserves stability.
+template <std::unsigned_integral K, typename V>
+void parallel_radix_sort(const std::size_t num_threads,
+                         const std::span<K> keys, const std::span<V> values,
+                         const unsigned int key_bits) {
+    assert(keys.size() == values.size());
+    static constexpr unsigned int digit_bits = 11;
+    static constexpr std::size_t num_buckets = std::size_t{1} << digit_bits;
+    const std::size_t n = keys.size();
+    const std::size_t num_chunks =
+        std::max(std::size_t{1}, std::min(num_threads, n / num_buckets));
+
+    std::vector<K> keys_buffer(n);
+    std::vector<V> values_buffer(n);
+    std::span<K> keys_in = keys, keys_out = keys_buffer;
+    std::span<V> values_in = values, values_out = values_buffer;
+    std::vector<std::size_t> offsets(num_chunks * num_buckets);
+
+    for(unsigned int shift = 0; shift < key_bits; shift += digit_bits) {
+        const auto digit = [shift](const K k) {
+            return static_cast<std::size_t>(k >> shift) & (num_buckets - 1);
+        };
+        std::ranges::fill(offsets, std::size_t{0});
+        parallel_for_chunks(num_chunks, n,
+                            [&](const std::size_t c, std::size_t begin,
+                                const std::size_t end) {
+                                std::size_t * count =
+                                    offsets.data() + c * num_buckets;
+                                for(; begin < end; ++begin)
+                                    ++count[digit(keys_in[begin])];
+                            });
+        std::size_t sum = 0;
+        for(std::size_t d = 0; d < num_buckets; ++d) {
+            for(std::size_t c = 0; c < num_chunks; ++c) {
+                const std::size_t count = offsets[c * num_buckets + d];
+                offsets[c * num_buckets + d] = sum;
+                sum += count;
+            }
+        }
+        parallel_for_chunks(num_chunks, n,
+                            [&](const std::size_t c, std::size_t begin,
+                                const std::size_t end) {
+                                std::size_t * offset =
+                                    offsets.data() + c * num_buckets;
+                                for(; begin < end; ++begin) {
+                                    const std::size_t pos =
+                                        offset[digit(keys_in[begin])]++;
+                                    keys_out[pos] = keys_in[begin];
+                                    values_out[pos] = values_in[begin];
+                                }
+                            });
+        std::swap(keys_in, keys_out);
+        std::swap(values_in, values_out);
+    }
+    if(keys_in.data() != keys.data()) {
+        parallel_for(num_threads, n, [&](const std::size_t i) {
+            keys[i] = keys_in[i];
+            values[i] = values_in[i];
+        });
+    }
+}
+
+// Given keys sorted in increasing order and lower than begin.size(), sets
+// begin[k] to the index of the first key greater or equal to k.
+template <std::integral K, std::integral I>
+void parallel_sorted_keys_begin(const std::size_t num_threads,
+                                const std::span<const K> sorted_keys,
+                                const std::span<I> begin) {
+    const std::size_t n = sorted_keys.size();
+    parallel_for(num_threads, n + 1, [&](const std::size_t i) {
+        const std::size_t first =
+            i == 0 ? 0 : static_cast<std::size_t>(sorted_keys[i - 1]) + 1;
+        const std::size_t last =
+            i == n ? begin.size() : static_cast<std::size_t>(sorted_keys[i]) + 1;
+        for(std::size_t k = first; k < last; ++k) begin[k] = static_cast<I>(i);
+    });
+}
+
+}  // namespace detail
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_DETAIL_PARALLEL_HPP
@@ -32,6 +32,19 @@ constexpr void prefetch_mapped_values(const _Keys & __keys,
         if(std::ranges::begin(__keys) != std::ranges::end(__keys)) {
             __builtin_prefetch(__map.data() + *std::ranges::begin(__keys));
         }
+#endif
+    } else if constexpr(requires(const std::ranges::range_value_t<_Keys> & k) {
+                            std::ranges::begin(__keys);
+                            std::ranges::end(__keys);
+                            {
+                                __map.address_of(k)
+                            } -> std::convertible_to<const volatile void *>;
+                        }) {
+        // interleaved storage, e.g. the arcs entries of weighted graphs
+#if defined(__GNUC__)
+        if(std::ranges::begin(__keys) != std::ranges::end(__keys)) {
+            __builtin_prefetch(__map.address_of(*std::ranges::begin(__keys)));
+        }
 #endif
     }
 }
@@ -0,0 +1,64 @@
+#ifndef MELON_DETAIL_TRAITS_VERTEX_MAP_HPP
+#define MELON_DETAIL_TRAITS_VERTEX_MAP_HPP
+
+#include <type_traits>
+
+#include "melon/graph.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Traits can replace the vertex maps that the algorithms reset between two
+// searches by declaring
+//   template <typename V> using vertex_map = ...;
+// a type constructible from the number of vertices and an initial value,
+// such as timestamped_map. The other traits keep the graph vertex maps.
+template <typename _Traits, typename _ValueType>
+concept __has_traits_vertex_map =
+    requires { typename _Traits::template vertex_map<_ValueType>; };
+
+template <typename _Traits, typename _Graph, typename _ValueType>
+struct __traits_vertex_map {
+    using type = vertex_map_t<_Graph, _ValueType>;
+};
+
+template <typename _Traits, typename _Graph, typename _ValueType>
+    requires __has_traits_vertex_map<_Traits, _ValueType>
+struct __traits_vertex_map<_Traits, _Graph, _ValueType> {
+    using type = typename _Traits::template vertex_map<_ValueType>;
+};
+
+template <typename _Traits, typename _Graph, typename _ValueType>
+using traits_vertex_map_t =
+    typename __traits_vertex_map<_Traits, _Graph, _ValueType>::type;
+
+template <typename _Traits, typename _ValueType, typename _Graph>
+[[nodiscard]] constexpr traits_vertex_map_t<_Traits, _Graph, _ValueType>
+create_traits_vertex_map(_Graph & g) {
+    if constexpr(__has_traits_vertex_map<_Traits, _ValueType>) {
+        static_assert(has_num_vertices<_Graph>,
+                      "traits vertex maps require has_num_vertices.");
+        return traits_vertex_map_t<_Traits, _Graph, _ValueType>(
+            melon::num_vertices(g));
+    } else {
+        return create_vertex_map<_ValueType>(g);
+    }
+}
+
+template <typename _Traits, typename _ValueType, typename _Graph>
+[[nodiscard]] constexpr traits_vertex_map_t<_Traits, _Graph, _ValueType>
+create_traits_vertex_map(_Graph & g, const _ValueType & init_value) {
+    if constexpr(__has_traits_vertex_map<_Traits, _ValueType>) {
+        static_assert(has_num_vertices<_Graph>,
+                      "traits vertex maps require has_num_vertices.");
+        return traits_vertex_map_t<_Traits, _Graph, _ValueType>(
+            melon::num_vertices(g), init_value);
+    } else {
+        return create_vertex_map<_ValueType>(g, init_value);
+    }
+}
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_DETAIL_TRAITS_VERTEX_MAP_HPP
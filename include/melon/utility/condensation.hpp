@@ -0,0 +1,148 @@
+#ifndef MELON_UTILITY_CONDENSATION_HPP
+#define MELON_UTILITY_CONDENSATION_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "melon/algorithm/strongly_connected_components.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/graph.hpp"
+#include "melon/mapping.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Condensation of a graph : the DAG whose vertices are its strongly connected
+// components and that has one arc from c to d if some arc goes from a vertex
+// of c to a vertex of d. Components are numbered in topological order, i.e.
+// every arc goes from a component to a greater one, which follows from Tarjan
+// finding the components in reverse topological order. The parallel arcs of
+// the graph are merged by two counting sorts of the inter-component arcs, by
+// target then by source, which keeps the construction linear, and every arc
+// of the condensation keeps its original arcs, such that arc maps can be
+// aggregated over them. It assumes that the vertices of the graph are the
+// integers of [0,n).
+template <typename _Graph = static_digraph>
+class condensation {
+public:
+    using vertex = vertex_t<_Graph>;
+    using arc = arc_t<_Graph>;
+
+private:
+    _Graph _graph;
+    std::vector<vertex> _component;
+    std::vector<arc> _original_arcs;
+    std::vector<std::size_t> _original_arcs_begin;
+
+public:
+    template <outward_adjacency_graph _G>
+        requires has_arc_source<_G> && has_arc_target<_G> &&
+                 has_num_vertices<_G> && has_vertex_map<_G>
+    [[nodiscard]] explicit condensation(const _G & g)
+        : _component(num_vertices(g)) {
+        std::size_t num_components = 0;
+        for(auto && component : strongly_connected_components(g)) {
+            for(auto && u : component)
+                _component[static_cast<std::size_t>(u)] =
+                    static_cast<vertex>(num_components);
+            ++num_components;
+        }
+        for(auto && c : _component)
+            c = static_cast<vertex>(num_components - 1 - c);
+
+        const auto source = [&](const auto & a) {
+            return static_cast<std::size_t>(
+                _component[static_cast<std::size_t>(arc_source(g, a))]);
+        };
+        const auto target = [&](const auto & a) {
+            return static_cast<std::size_t>(
+                _component[static_cast<std::size_t>(arc_target(g, a))]);
+        };
+        std::vector<arc> inter_arcs;
+        for(auto && a : arcs(g)) {
+            if(source(a) == target(a)) continue;
+            inter_arcs.push_back(static_cast<arc>(a));
+        }
+
+        _original_arcs.resize(inter_arcs.size());
+        std::vector<std::size_t> offsets(num_components + 1);
+        const auto counting_sort = [&](const std::vector<arc> & from,
+                                       std::vector<arc> & to, auto && key) {
+            std::ranges::fill(offsets, std::size_t{0});
+            for(auto && a : from) ++offsets[key(a) + 1];
+            for(std::size_t c = 0; c < num_components; ++c)
+                offsets[c + 1] += offsets[c];
+            for(auto && a : from) to[offsets[key(a)]++] = a;
+        };
+        counting_sort(inter_arcs, _original_arcs, target);
+        counting_sort(_original_arcs, inter_arcs, source);
+        std::swap(inter_arcs, _original_arcs);
+
+        std::vector<vertex> sources;
+        std::vector<vertex> targets;
+        for(std::size_t i = 0; i < _original_arcs.size(); ++i) {
+            const vertex s = static_cast<vertex>(source(_original_arcs[i]));
+            const vertex t = static_cast<vertex>(target(_original_arcs[i]));
+            if(!sources.empty() && sources.back() == s && targets.back() == t)
+                continue;
+            sources.push_back(s);
+            targets.push_back(t);
+            _original_arcs_begin.push_back(i);
+        }
+        _original_arcs_begin.push_back(_original_arcs.size());
+        _graph = _Graph(num_components, sources, targets);
+    }
+
+    [[nodiscard]] const _Graph & graph() const noexcept { return _graph; }
+    [[nodiscard]] std::size_t num_components() const noexcept {
+        return num_vertices(_graph);
+    }
+
+    // original vertex -> component
+    [[nodiscard]] const std::vector<vertex> & components_map() const noexcept {
+        return _component;
+    }
+    [[nodiscard]] vertex component(const vertex & u) const noexcept {
+        return _component[static_cast<std::size_t>(u)];
+    }
+    // arc of the condensation -> original arcs
+    [[nodiscard]] std::span<const arc> original_arcs(
+        const arc & a) const noexcept {
+        const std::size_t i = static_cast<std::size_t>(a);
+        assert(i + 1 < _original_arcs_begin.size());
+        return std::span<const arc>(
+            _original_arcs.data() + _original_arcs_begin[i],
+            _original_arcs.data() + _original_arcs_begin[i + 1]);
+    }
+
+    // Arc map of the condensation giving to each arc the reduction of the
+    // values of its original arcs, e.g. with std::plus<> or std::ranges::min.
+    template <input_mapping<arc> _Map, typename _Reduce>
+    [[nodiscard]] auto aggregate_arc_map(const _Map & map,
+                                         _Reduce && reduce) const {
+        using value_t = mapped_value_t<_Map, arc>;
+        auto new_map = create_arc_map<value_t>(_graph);
+        for(auto && a : arcs(_graph)) {
+            const std::span<const arc> originals = original_arcs(a);
+            value_t value = map[originals.front()];
+            for(auto && b : originals.subspan(1))
+                value = static_cast<value_t>(reduce(value, map[b]));
+            new_map[a] = value;
+        }
+        return new_map;
+    }
+};
+
+template <typename _Graph = static_digraph, graph _G>
+[[nodiscard]] condensation<_Graph> condense(const _G & g) {
+    return condensation<_Graph>(g);
+}
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_UTILITY_CONDENSATION_HPP
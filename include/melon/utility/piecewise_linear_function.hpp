@@ -0,0 +1,292 @@
+#ifndef MELON_UTILITY_PIECEWISE_LINEAR_FUNCTION_HPP
+#define MELON_UTILITY_PIECEWISE_LINEAR_FUNCTION_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace fhamonic {
+namespace melon {
+
+namespace __piecewise_linear {
+// Below this number of breakpoints, the segment is found by counting the
+// breakpoints before t, a branchless loop that compilers vectorize.
+inline constexpr std::size_t linear_scan_threshold = 32;
+
+template <typename T>
+[[nodiscard]] constexpr T evaluate(const std::span<const T> times,
+                                   const std::span<const T> values,
+                                   const T & t) noexcept {
+    assert(!times.empty() && times.size() == values.size());
+    std::size_t i;
+    if(times.size() <= linear_scan_threshold) {
+        i = 0;
+        for(const T & b : times) i += static_cast<std::size_t>(b <= t);
+    } else {
+        i = static_cast<std::size_t>(std::ranges::upper_bound(times, t) -
+                                     times.begin());
+    }
+    if(i == 0) return values.front();
+    if(i == times.size()) return values.back();
+    return values[i - 1] + (values[i] - values[i - 1]) * (t - times[i - 1]) /
+                               (times[i] - times[i - 1]);
+}
+}  // namespace __piecewise_linear
+
+// Piecewise linear function given by its breakpoints (times[i], values[i]),
+// with strictly increasing times, and constant before the first and after the
+// last breakpoint. As travel time functions, they are assumed to satisfy the
+// FIFO property, i.e. every slope is at least -1.
+template <typename T>
+class piecewise_linear_function_view {
+public:
+    using time_type = T;
+
+private:
+    std::span<const T> _times;
+    std::span<const T> _values;
+
+public:
+    [[nodiscard]] constexpr piecewise_linear_function_view() = default;
+    [[nodiscard]] constexpr piecewise_linear_function_view(
+        const std::span<const T> times, const std::span<const T> values)
+        : _times(times), _values(values) {
+        assert(!_times.empty() && _times.size() == _values.size());
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept {
+        return _times.size();
+    }
+    [[nodiscard]] constexpr std::span<const T> times() const noexcept {
+        return _times;
+    }
+    [[nodiscard]] constexpr std::span<const T> values() const noexcept {
+        return _values;
+    }
+    [[nodiscard]] constexpr T operator()(const T & t) const noexcept {
+        return __piecewise_linear::evaluate(_times, _values, t);
+    }
+    [[nodiscard]] constexpr T min_value() const noexcept {
+        return std::ranges::min(_values);
+    }
+};
+
+template <typename T>
+class piecewise_linear_function {
+public:
+    using time_type = T;
+
+private:
+    std::vector<T> _times;
+    std::vector<T> _values;
+
+public:
+    [[nodiscard]] constexpr piecewise_linear_function() = default;
+    [[nodiscard]] constexpr explicit piecewise_linear_function(const T & c)
+        : _times{T{}}, _values{c} {}
+    [[nodiscard]] constexpr piecewise_linear_function(
+        std::initializer_list<std::pair<T, T>> breakpoints) {
+        for(auto && [t, v] : breakpoints) push_back(t, v);
+    }
+    [[nodiscard]] constexpr piecewise_linear_function(std::vector<T> && times,
+                                                      std::vector<T> && values)
+        : _times(std::move(times)), _values(std::move(values)) {
+        assert(_times.size() == _values.size());
+    }
+    [[nodiscard]] constexpr explicit piecewise_linear_function(
+        const piecewise_linear_function_view<T> & f)
+        : _times(f.times().begin(), f.times().end())
+        , _values(f.values().begin(), f.values().end()) {}
+
+    [[nodiscard]] constexpr piecewise_linear_function(
+        const piecewise_linear_function &) = default;
+    [[nodiscard]] constexpr piecewise_linear_function(
+        piecewise_linear_function &&) = default;
+
+    constexpr piecewise_linear_function & operator=(
+        const piecewise_linear_function &) = default;
+    constexpr piecewise_linear_function & operator=(
+        piecewise_linear_function &&) = default;
+
+    [[nodiscard]] constexpr bool operator==(
+        const piecewise_linear_function &) const = default;
+
+    constexpr void push_back(const T & t, const T & v) {
+        assert(_times.empty() || _times.back() < t);
+        _times.push_back(t);
+        _values.push_back(v);
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept {
+        return _times.size();
+    }
+    [[nodiscard]] constexpr std::span<const T> times() const noexcept {
+        return _times;
+    }
+    [[nodiscard]] constexpr std::span<const T> values() const noexcept {
+        return _values;
+    }
+    [[nodiscard]] constexpr T operator()(const T & t) const noexcept {
+        return __piecewise_linear::evaluate(times(), values(), t);
+    }
+    [[nodiscard]] constexpr T min_value() const noexcept {
+        return std::ranges::min(_values);
+    }
+    [[nodiscard]] constexpr operator piecewise_linear_function_view<T>()
+        const noexcept {
+        return piecewise_linear_function_view<T>(times(), values());
+    }
+};
+
+// clang-format off
+template <typename F>
+concept piecewise_linear = requires(const F & f) {
+    typename F::time_type;
+    { f.times() } -> std::same_as<std::span<const typename F::time_type>>;
+    { f.values() } -> std::same_as<std::span<const typename F::time_type>>;
+};
+// clang-format on
+
+namespace __piecewise_linear {
+template <typename T>
+[[nodiscard]] constexpr std::vector<T> merged_times(
+    const std::span<const T> times1, const std::span<const T> times2) {
+    std::vector<T> times;
+    times.reserve(times1.size() + times2.size());
+    std::ranges::merge(times1, times2, std::back_inserter(times));
+    times.erase(std::unique(times.begin(), times.end()), times.end());
+    return times;
+}
+
+// Removes the breakpoints aligned with their neighbors.
+template <typename T>
+[[nodiscard]] constexpr piecewise_linear_function<T> simplified(
+    std::vector<T> && times, std::vector<T> && values) {
+    std::size_t n = 0;
+    for(std::size_t i = 0; i < times.size(); ++i) {
+        if(n >= 1 && i + 1 == times.size() && values[n - 1] == values[i])
+            continue;
+        if(n == 1 && values[0] == values[i]) {
+            times[0] = times[i];
+            continue;
+        }
+        if(n >= 2 &&
+           (values[n - 1] - values[n - 2]) * (times[i] - times[n - 1]) ==
+               (values[i] - values[n - 1]) * (times[n - 1] - times[n - 2])) {
+            times[n - 1] = times[i];
+            values[n - 1] = values[i];
+            continue;
+        }
+        times[n] = times[i];
+        values[n] = values[i];
+        ++n;
+    }
+    times.resize(n);
+    values.resize(n);
+    return piecewise_linear_function<T>(std::move(times), std::move(values));
+}
+}  // namespace __piecewise_linear
+
+// Travel time function of the path made of an arc of travel time f followed
+// by an arc of travel time g, i.e. t -> f(t) + g(t + f(t)). Its breakpoints
+// are those of f and the departure times at which the arrival hits a
+// breakpoint of g.
+template <piecewise_linear F, piecewise_linear G>
+    requires std::same_as<typename F::time_type, typename G::time_type>
+[[nodiscard]] constexpr auto link_piecewise_linear(const F & f, const G & g) {
+    using T = typename F::time_type;
+    const std::span<const T> f_times = f.times();
+    const std::span<const T> f_values = f.values();
+    const std::size_t n = f_times.size();
+    std::vector<T> arrivals(n);
+    for(std::size_t i = 0; i < n; ++i) arrivals[i] = f_times[i] + f_values[i];
+
+    std::vector<T> preimages;
+    preimages.reserve(g.times().size());
+    for(const T & s : g.times()) {
+        if(s <= arrivals.front()) {
+            preimages.push_back(s - f_values.front());
+            continue;
+        }
+        if(s >= arrivals.back()) {
+            preimages.push_back(s - f_values.back());
+            continue;
+        }
+        const std::size_t k = static_cast<std::size_t>(
+            std::ranges::lower_bound(arrivals, s) - arrivals.begin());
+        preimages.push_back(f_times[k - 1] +
+                            (s - arrivals[k - 1]) *
+                                (f_times[k] - f_times[k - 1]) /
+                                (arrivals[k] - arrivals[k - 1]));
+    }
+    // rounding may break the order of the preimages for integral times
+    for(std::size_t i = 1; i < preimages.size(); ++i)
+        preimages[i] = std::max(preimages[i], preimages[i - 1]);
+
+    std::vector<T> times = __piecewise_linear::merged_times(
+        f_times, std::span<const T>(preimages));
+    std::vector<T> values(times.size());
+    for(std::size_t i = 0; i < times.size(); ++i) {
+        const T ft = __piecewise_linear::evaluate(f_times, f_values, times[i]);
+        values[i] = ft + __piecewise_linear::evaluate(g.times(), g.values(),
+                                                      times[i] + ft);
+    }
+    return __piecewise_linear::simplified(std::move(times), std::move(values));
+}
+
+// Pointwise minimum of f and g, whose breakpoints are those of f and g and
+// the times at which they cross.
+template <piecewise_linear F, piecewise_linear G>
+    requires std::same_as<typename F::time_type, typename G::time_type>
+[[nodiscard]] constexpr auto min_piecewise_linear(const F & f, const G & g) {
+    using T = typename F::time_type;
+    const std::vector<T> candidates =
+        __piecewise_linear::merged_times(f.times(), g.times());
+    std::vector<T> times;
+    std::vector<T> values;
+    T prev_diff{};
+    for(std::size_t i = 0; i < candidates.size(); ++i) {
+        const T & t = candidates[i];
+        const T ft = __piecewise_linear::evaluate(f.times(), f.values(), t);
+        const T gt = __piecewise_linear::evaluate(g.times(), g.values(), t);
+        const T diff = ft - gt;
+        if(i > 0 && ((prev_diff < T{} && diff > T{}) ||
+                     (prev_diff > T{} && diff < T{}))) {
+            const T & prev_t = candidates[i - 1];
+            const T x = prev_t + (t - prev_t) * prev_diff / (prev_diff - diff);
+            if(prev_t < x && x < t) {
+                times.push_back(x);
+                values.push_back(__piecewise_linear::evaluate(
+                    f.times(), f.values(), x));
+            }
+        }
+        times.push_back(t);
+        values.push_back(std::min(ft, gt));
+        prev_diff = diff;
+    }
+    return __piecewise_linear::simplified(std::move(times), std::move(values));
+}
+
+// Whether f(t) <= g(t) for every t, checked at the breakpoints of f and g.
+template <piecewise_linear F, piecewise_linear G>
+    requires std::same_as<typename F::time_type, typename G::time_type>
+[[nodiscard]] constexpr bool piecewise_linear_less_equal(const F & f,
+                                                         const G & g) {
+    auto check = [&f, &g](const auto & t) {
+        return __piecewise_linear::evaluate(f.times(), f.values(), t) <=
+               __piecewise_linear::evaluate(g.times(), g.values(), t);
+    };
+    return std::ranges::all_of(f.times(), check) &&
+           std::ranges::all_of(g.times(), check);
+}
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_UTILITY_PIECEWISE_LINEAR_FUNCTION_HPP
@@ -1,7 +1,11 @@
 #ifndef MELON_UTILITY_SEMIRING_HPP
 #define MELON_UTILITY_SEMIRING_HPP
 
+#include <array>
 #include <concepts>
+#include <cstddef>
+#include <functional>
+#include <tuple>
 
 namespace fhamonic {
 namespace melon {
@@ -67,6 +71,52 @@ struct minimum_spanning_tree_semiring {
     static constexpr less_t less{};
 };
 
+// clang-format off
+// Semiring of vectors of lengths, whose less is a total order extending the
+// dominance partial order, such that a label-setting algorithm that settles
+// the labels by increasing less only settles Pareto optimal labels.
+template <typename S>
+concept pareto_semiring = requires(typename S::value_type v) {
+    { S::zero } -> std::same_as<const typename S::value_type &>;
+    { S::plus } -> std::same_as<const typename S::plus_t &>;
+    { S::less } -> std::same_as<const typename S::less_t &>;
+    { S::dominates } -> std::same_as<const typename S::dominates_t &>;
+    { S::plus(v, v) } -> std::same_as<typename S::value_type>;
+    { S::less(v, v) } -> std::convertible_to<bool>;
+    { S::dominates(v, v) } -> std::convertible_to<bool>;
+};
+// clang-format on
+
+// Componentwise sums of std::array lengths, ordered lexicographically.
+template <typename V>
+struct pareto_shortest_path_semiring {
+    using value_type = V;
+    static constexpr std::size_t num_criteria = std::tuple_size_v<V>;
+
+    struct plus_t {
+        [[nodiscard]] constexpr V operator()(const V & a,
+                                             const V & b) const noexcept {
+            V c;
+            for(std::size_t i = 0; i < num_criteria; ++i) c[i] = a[i] + b[i];
+            return c;
+        }
+    };
+    using less_t = typename std::less<V>;
+    // a dominates b if a is no greater than b on every criterion
+    struct dominates_t {
+        [[nodiscard]] constexpr bool operator()(const V & a,
+                                                const V & b) const noexcept {
+            for(std::size_t i = 0; i < num_criteria; ++i)
+                if(b[i] < a[i]) return false;
+            return true;
+        }
+    };
+    static constexpr V zero = {};
+    static constexpr plus_t plus{};
+    static constexpr less_t less{};
+    static constexpr dominates_t dominates{};
+};
+
 }  // namespace melon
 }  // namespace fhamonic
 
@@ -2,13 +2,15 @@
 #define MELON_STATIC_DIGRAPH_BUILDER_HPP
 
 #include <algorithm>
+#include <bit>
+#include <concepts>
 #include <numeric>
 #include <ranges>
+#include <span>
+#include <type_traits>
 #include <vector>
 
-#include <range/v3/algorithm/sort.hpp>
-#include <range/v3/view/zip.hpp>
-
+#include "melon/detail/parallel.hpp"
 #include "melon/graph.hpp"
 
 namespace fhamonic {
@@ -50,19 +52,58 @@ public:
         return *this;
     }
 
-    auto build() {
-        auto arcs_zipped_view = std::apply(
-            [this](auto &&... property_map) {
-                return ranges::views::zip(_arc_sources, _arc_targets,
-                                         property_map...);
+private:
+    template <typename T>
+    static std::vector<T> permuted(const std::size_t num_threads,
+                                   const std::vector<T> & v,
+                                   const std::vector<std::size_t> & perm) {
+        std::vector<T> permuted_v;
+        // the packed words of std::vector<bool> cannot be written by several
+        // threads, and other types may not be default constructible
+        if constexpr(std::is_trivially_copyable_v<T> &&
+                     std::default_initializable<T> && !std::same_as<T, bool>) {
+            permuted_v.resize(v.size());
+            detail::parallel_for(num_threads, v.size(),
+                                 [&](const std::size_t i) {
+                                     permuted_v[i] = v[perm[i]];
+                                 });
+        } else {
+            permuted_v.reserve(v.size());
+            for(auto && i : perm) permuted_v.push_back(v[i]);
+        }
+        return permuted_v;
+    }
+
+    // Stable sort of the arcs by source then target, done by two radix sorts
+    // of the arc indices : by target and then by source.
+    void sort_arcs(const std::size_t num_threads) {
+        const std::size_t num_arcs = _arc_sources.size();
+        const auto key_bits =
+            static_cast<unsigned int>(std::bit_width(_num_vertices));
+        std::vector<vertex> keys(_arc_targets);
+        std::vector<std::size_t> perm(num_arcs);
+        std::iota(perm.begin(), perm.end(), std::size_t{0});
+        detail::parallel_radix_sort(num_threads, std::span(keys),
+                                    std::span(perm), key_bits);
+        detail::parallel_for(num_threads, num_arcs, [&](const std::size_t i) {
+            keys[i] = _arc_sources[perm[i]];
+        });
+        detail::parallel_radix_sort(num_threads, std::span(keys),
+                                    std::span(perm), key_bits);
+
+        _arc_sources = std::move(keys);
+        _arc_targets = permuted(num_threads, _arc_targets, perm);
+        std::apply(
+            [&](auto &... property_map) {
+                ((property_map = permuted(num_threads, property_map, perm)),
+                 ...);
             },
             _arc_property_maps);
-        ranges::sort(arcs_zipped_view, [](const auto & a, const auto & b) {
-            if(std::get<0>(a) == std::get<0>(b))
-                return std::get<1>(a) < std::get<1>(b);
-            return std::get<0>(a) < std::get<0>(b);
-        });
-        ;
+    }
+
+public:
+    auto build() {
+        sort_arcs(1);
         return std::apply(
             [this](auto &&... property_map) {
                 return std::make_tuple(
@@ -71,6 +112,26 @@ public:
             },
             _arc_property_maps);
     }
+
+    // Builds the same graph as build() but with parallel sorts and
+    // permutations of the arcs, and with the parallel constructor of G if any.
+    auto build(const parallel_policy & policy) {
+        sort_arcs(detail::num_threads(policy));
+        return std::apply(
+            [this, &policy](auto &&... property_map) {
+                if constexpr(std::constructible_from<
+                                 G, const parallel_policy &, std::size_t,
+                                 std::vector<vertex> &, std::vector<vertex> &>)
+                    return std::make_tuple(
+                        G(policy, _num_vertices, _arc_sources, _arc_targets),
+                        property_map...);
+                else
+                    return std::make_tuple(
+                        G(_num_vertices, _arc_sources, _arc_targets),
+                        property_map...);
+            },
+            _arc_property_maps);
+    }
 };
 
 }  // namespace melon
@@ -0,0 +1,282 @@
+#ifndef MELON_UTILITY_VERTEX_REORDERING_HPP
+#define MELON_UTILITY_VERTEX_REORDERING_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include "melon/container/d_ary_heap.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/graph.hpp"
+#include "melon/mapping.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+namespace fhamonic {
+namespace melon {
+
+// Vertex orders improving the memory locality of traversals : the i-th
+// element of an order is the vertex that gets the id i in the reordered graph.
+// They assume that the vertices of the graph are the integers of [0,n).
+
+namespace __reordering {
+template <typename _Graph, typename _F>
+constexpr void for_each_neighbor(const _Graph & g, const vertex_t<_Graph> & u,
+                                 _F && f) {
+    for(auto && v : out_neighbors(g, u)) f(v);
+    if constexpr(inward_adjacency_graph<_Graph>)
+        for(auto && v : in_neighbors(g, u)) f(v);
+}
+
+template <typename _Graph>
+[[nodiscard]] constexpr std::size_t degree(const _Graph & g,
+                                           const vertex_t<_Graph> & u) {
+    std::size_t d = 0;
+    for_each_neighbor(g, u, [&d](auto &&) { ++d; });
+    return d;
+}
+
+// Breadth first traversal, ignoring the arcs directions when the graph has
+// in_neighbors, that restarts from the first unreached vertex of starts.
+template <typename _Graph, typename _Starts, typename _Visit>
+[[nodiscard]] std::vector<vertex_t<_Graph>> breadth_first_order(
+    const _Graph & g, _Starts && starts, _Visit && visit_neighbors) {
+    using vertex = vertex_t<_Graph>;
+    std::vector<vertex> order;
+    order.reserve(num_vertices(g));
+    auto reached_map = create_vertex_map<bool>(g, false);
+    for(auto && s : starts) {
+        if(reached_map[s]) continue;
+        std::size_t queue_begin = order.size();
+        order.push_back(s);
+        reached_map[s] = true;
+        for(; queue_begin < order.size(); ++queue_begin) {
+            visit_neighbors(order[queue_begin], [&](const vertex & v) {
+                if(reached_map[v]) return;
+                reached_map[v] = true;
+                order.push_back(v);
+            });
+        }
+    }
+    return order;
+}
+}  // namespace __reordering
+
+template <outward_adjacency_graph _Graph>
+    requires has_vertex_map<_Graph> && has_num_vertices<_Graph>
+[[nodiscard]] std::vector<vertex_t<_Graph>> breadth_first_order(
+    const _Graph & g) {
+    return __reordering::breadth_first_order(
+        g, vertices(g), [&g](const vertex_t<_Graph> & u, auto && push) {
+            __reordering::for_each_neighbor(g, u, push);
+        });
+}
+
+// Reverse Cuthill-McKee : breadth first traversals started from minimum
+// degree vertices, visiting neighbors by increasing degree, in reverse.
+template <outward_adjacency_graph _Graph>
+    requires has_vertex_map<_Graph> && has_num_vertices<_Graph>
+[[nodiscard]] std::vector<vertex_t<_Graph>> reverse_cuthill_mckee_order(
+    const _Graph & g) {
+    using vertex = vertex_t<_Graph>;
+    auto degree_map = create_vertex_map<std::size_t>(g);
+    std::vector<vertex> starts;
+    starts.reserve(num_vertices(g));
+    for(auto && u : vertices(g)) {
+        degree_map[u] = __reordering::degree(g, u);
+        starts.push_back(u);
+    }
+    const auto by_degree = [&degree_map](const vertex & u, const vertex & v) {
+        return degree_map[u] < degree_map[v];
+    };
+    std::ranges::stable_sort(starts, by_degree);
+    std::vector<vertex> neighbors;
+    auto order = __reordering::breadth_first_order(
+        g, starts, [&](const vertex & u, auto && push) {
+            neighbors.resize(0);
+            __reordering::for_each_neighbor(
+                g, u, [&neighbors](const vertex & v) { neighbors.push_back(v); });
+            std::ranges::stable_sort(neighbors, by_degree);
+            for(auto && v : neighbors) push(v);
+        });
+    std::ranges::reverse(order);
+    return order;
+}
+
+// Vertices by decreasing degree, such that hubs are packed together.
+template <outward_adjacency_graph _Graph>
+    requires has_vertex_map<_Graph> && has_num_vertices<_Graph>
+[[nodiscard]] std::vector<vertex_t<_Graph>> degree_order(const _Graph & g) {
+    using vertex = vertex_t<_Graph>;
+    auto degree_map = create_vertex_map<std::size_t>(g);
+    std::vector<vertex> order;
+    order.reserve(num_vertices(g));
+    for(auto && u : vertices(g)) {
+        degree_map[u] = __reordering::degree(g, u);
+        order.push_back(u);
+    }
+    std::ranges::stable_sort(order, [&degree_map](const vertex & u,
+                                                  const vertex & v) {
+        return degree_map[u] > degree_map[v];
+    });
+    return order;
+}
+
+// Greedy Gorder-like heuristic : the next vertex is one maximizing the number
+// of neighbors and siblings (vertices sharing an in-neighbor) among the
+// window_size last placed vertices. In-neighbors with more than
+// max_sibling_degree out-neighbors are not used to find siblings since they
+// would cost a quadratic number of score updates.
+template <outward_adjacency_graph _Graph>
+    requires inward_adjacency_graph<_Graph> && has_vertex_map<_Graph> &&
+             has_num_vertices<_Graph>
+[[nodiscard]] std::vector<vertex_t<_Graph>> gorder_order(
+    const _Graph & g, const std::size_t window_size = 5,
+    const std::size_t max_sibling_degree = 256) {
+    using vertex = vertex_t<_Graph>;
+    using entry = std::pair<vertex, std::size_t>;
+    using heap = updatable_d_ary_heap<2, entry, std::greater<std::size_t>,
+                                      vertex_map_t<_Graph, std::size_t>,
+                                      views::get_map<1>, views::get_map<0>>;
+
+    std::vector<vertex> order;
+    order.reserve(num_vertices(g));
+    if(num_vertices(g) == 0) return order;
+
+    heap candidates(std::greater<std::size_t>(),
+                    create_vertex_map<std::size_t>(g));
+    vertex first = *std::ranges::begin(vertices(g));
+    std::size_t first_in_degree = 0;
+    for(auto && u : vertices(g)) {
+        candidates.push(entry(u, 0));
+        const auto d =
+            static_cast<std::size_t>(std::ranges::distance(in_neighbors(g, u)));
+        if(d > first_in_degree) {
+            first = u;
+            first_in_degree = d;
+        }
+    }
+    const auto update_scores = [&](const vertex & u, const bool entering) {
+        const auto update = [&](const vertex & v) {
+            if(!candidates.contains(v)) return;
+            const std::size_t score = candidates.priority(v);
+            if(entering)
+                candidates.promote(v, score + 1);
+            else
+                candidates.demote(v, score - 1);
+        };
+        __reordering::for_each_neighbor(g, u, update);
+        for(auto && p : in_neighbors(g, u)) {
+            auto && siblings = out_neighbors(g, p);
+            if(static_cast<std::size_t>(std::ranges::distance(siblings)) >
+               max_sibling_degree)
+                continue;
+            for(auto && v : siblings)
+                if(v != u) update(v);
+        }
+    };
+
+    candidates.promote(first, 1);
+    while(!candidates.empty()) {
+        const vertex u = candidates.top().first;
+        candidates.pop();
+        order.push_back(u);
+        update_scores(u, true);
+        if(order.size() > window_size)
+            update_scores(order[order.size() - window_size - 1], false);
+    }
+    return order;
+}
+
+// Graph rebuilt with the vertex u renamed new_vertex_map()[u], along with the
+// correspondences between the old and new vertices and arcs that allow to
+// carry any vertex or arc map to the reordered graph.
+template <typename _Graph = static_digraph>
+class vertex_reordering {
+public:
+    using vertex = vertex_t<_Graph>;
+    using arc = arc_t<_Graph>;
+
+private:
+    _Graph _graph;
+    vertex_map_t<_Graph, vertex> _new_vertex_map;
+    vertex_map_t<_Graph, vertex> _old_vertex_map;
+    arc_map_t<_Graph, arc> _old_arc_map;
+
+public:
+    template <graph _G, std::ranges::forward_range _Order>
+        requires has_arc_source<_G> && has_arc_target<_G> &&
+                 has_num_vertices<_G>
+    [[nodiscard]] vertex_reordering(const _G & g, const _Order & order) {
+        const std::size_t n = num_vertices(g);
+        assert(static_cast<std::size_t>(std::ranges::distance(order)) == n);
+        std::vector<vertex> new_vertex(n);
+        std::vector<vertex> old_vertex;
+        old_vertex.reserve(n);
+        for(auto && u : order) {
+            assert(static_cast<std::size_t>(u) < n);
+            new_vertex[static_cast<std::size_t>(u)] =
+                static_cast<vertex>(old_vertex.size());
+            old_vertex.push_back(static_cast<vertex>(u));
+        }
+        static_digraph_builder<_Graph, arc> builder(n);
+        for(auto && a : arcs(g))
+            builder.add_arc(
+                new_vertex[static_cast<std::size_t>(arc_source(g, a))],
+                new_vertex[static_cast<std::size_t>(arc_target(g, a))],
+                static_cast<arc>(a));
+        auto [graph, old_arc] = builder.build();
+        _graph = std::move(graph);
+        _new_vertex_map = create_vertex_map<vertex>(_graph);
+        _old_vertex_map = create_vertex_map<vertex>(_graph);
+        _old_arc_map = create_arc_map<arc>(_graph);
+        for(auto && u : vertices(_graph)) {
+            _new_vertex_map[u] = new_vertex[static_cast<std::size_t>(u)];
+            _old_vertex_map[u] = old_vertex[static_cast<std::size_t>(u)];
+        }
+        for(auto && a : arcs(_graph))
+            _old_arc_map[a] = old_arc[static_cast<std::size_t>(a)];
+    }
+
+    [[nodiscard]] const _Graph & graph() const noexcept { return _graph; }
+
+    // old vertex -> new vertex
+    [[nodiscard]] const auto & new_vertex_map() const noexcept {
+        return _new_vertex_map;
+    }
+    // new vertex -> old vertex
+    [[nodiscard]] const auto & old_vertex_map() const noexcept {
+        return _old_vertex_map;
+    }
+    // new arc -> old arc
+    [[nodiscard]] const auto & old_arc_map() const noexcept {
+        return _old_arc_map;
+    }
+
+    template <input_mapping<vertex> _Map>
+    [[nodiscard]] auto permute_vertex_map(const _Map & map) const {
+        auto new_map = create_vertex_map<mapped_value_t<_Map, vertex>>(_graph);
+        for(auto && u : vertices(_graph)) new_map[u] = map[_old_vertex_map[u]];
+        return new_map;
+    }
+    template <input_mapping<arc> _Map>
+    [[nodiscard]] auto permute_arc_map(const _Map & map) const {
+        auto new_map = create_arc_map<mapped_value_t<_Map, arc>>(_graph);
+        for(auto && a : arcs(_graph)) new_map[a] = map[_old_arc_map[a]];
+        return new_map;
+    }
+};
+
+template <typename _Graph = static_digraph, graph _G,
+          std::ranges::forward_range _Order>
+[[nodiscard]] vertex_reordering<_Graph> reorder_vertices(const _G & g,
+                                                         const _Order & order) {
+    return vertex_reordering<_Graph>(g, order);
+}
+
+}  // namespace melon
+}  // namespace fhamonic
+
+#endif  // MELON_UTILITY_VERTEX_REORDERING_HPP
@@ -0,0 +1,114 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "melon/algorithm/a_star.hpp"
+#include "melon/algorithm/alt_landmarks.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic::melon;
+
+struct store_paths_traits : public a_star_default_traits<static_digraph, int> {
+    static constexpr bool store_paths = true;
+};
+
+GTEST_TEST(a_star, test) {
+    static_digraph_builder<static_digraph, int> builder(6);
+
+    builder.add_arc(0, 1, 7)
+        .add_arc(0, 2, 9)
+        .add_arc(0, 5, 14)
+        .add_arc(1, 0, 7)
+        .add_arc(1, 2, 10)
+        .add_arc(1, 3, 15)
+        .add_arc(2, 0, 9)
+        .add_arc(2, 1, 10)
+        .add_arc(2, 3, 12)
+        .add_arc(2, 5, 2)
+        .add_arc(3, 1, 15)
+        .add_arc(3, 2, 12)
+        .add_arc(3, 4, 6)
+        .add_arc(4, 3, 6)
+        .add_arc(4, 5, 9)
+        .add_arc(5, 0, 14)
+        .add_arc(5, 2, 2)
+        .add_arc(5, 4, 9);
+
+    auto [graph, length_map] = builder.build();
+
+    // exact distances to 3 as potential : only the shortest path is settled
+    std::vector<int> to_3 = {21, 15, 12, 0, 6, 14};
+    a_star alg(store_paths_traits{}, graph, length_map, to_3, 0u);
+
+    static_assert(std::copyable<decltype(alg)>);
+
+    ASSERT_EQ(alg.current(), std::make_pair(0u, 0));
+    alg.advance();
+    ASSERT_EQ(alg.current(), std::make_pair(2u, 9));
+    alg.advance();
+    ASSERT_EQ(alg.current(), std::make_pair(3u, 21));
+    alg.run_until(3u);
+    ASSERT_TRUE(alg.visited(3u));
+    ASSERT_EQ(alg.dist(3u), 21);
+    ASSERT_FALSE(alg.visited(1u));
+    ASSERT_TRUE(EQ_RANGES(alg.path_to(3u), {8u, 1u}));
+
+    alg.reset();
+    std::vector<int> zeros(6, 0);
+    alg.set_potential(zeros);
+    alg.add_source(0u);
+    alg.run();
+    ASSERT_EQ(alg.dist(4u), 20);
+    ASSERT_TRUE(alg.visited(1u));
+}
+
+GTEST_TEST(a_star, fuzzy_alt_same_as_dijkstra) {
+    std::mt19937 engine{std::random_device{}()};
+    const std::size_t n = 300;
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+    std::uniform_int_distribution<unsigned int> length_distr(0, 100);
+
+    static_digraph_builder<static_digraph, unsigned int> builder(n);
+    for(std::size_t i = 0; i < 3 * n; ++i)
+        builder.add_arc(vertex_distr(engine), vertex_distr(engine),
+                        length_distr(engine));
+    auto [graph, length_map] = builder.build();
+
+    const auto landmarks = farthest_landmarks(graph, length_map, 8);
+    ASSERT_EQ(landmarks.size(), 8);
+    alt_landmarks<unsigned int> alt(parallel_policy{4}, graph, length_map,
+                                    landmarks);
+    ASSERT_EQ(alt.num_landmarks(), 8);
+
+    for(std::size_t i = 0; i < 20; ++i) {
+        const unsigned int s = vertex_distr(engine);
+        std::vector<unsigned int> dist(n,
+                                       std::numeric_limits<unsigned int>::max());
+        for(auto && [u, u_dist] : dijkstra(graph, length_map, s))
+            dist[u] = u_dist;
+        for(std::size_t j = 0; j < 10; ++j) {
+            const unsigned int t = vertex_distr(engine);
+            for(auto && u : vertices(graph)) {
+                if(dist[u] == std::numeric_limits<unsigned int>::max())
+                    continue;
+                ASSERT_LE(alt.lower_bound(s, u), dist[u]);
+            }
+            a_star alg(graph, length_map, alt.potential(s), s);
+            alg.reset().set_potential(alt.potential(t)).add_source(s);
+            alg.run_until(t);
+            if(dist[t] == std::numeric_limits<unsigned int>::max()) {
+                ASSERT_FALSE(alg.reached(t));
+                continue;
+            }
+            ASSERT_TRUE(alg.visited(t));
+            ASSERT_EQ(alg.dist(t), dist[t]);
+        }
+    }
+}
@@ -0,0 +1,184 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "melon/algorithm/bellman_ford.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic::melon;
+
+GTEST_TEST(bellman_ford, test) {
+    static_digraph_builder<static_digraph, int> builder(5);
+    builder.add_arc(0, 1, 4)
+        .add_arc(0, 2, 5)
+        .add_arc(1, 3, 2)
+        .add_arc(2, 1, -3)
+        .add_arc(3, 4, 1)
+        .add_arc(2, 4, 4);
+    auto [graph, length_map] = builder.build();
+
+    bellman_ford alg(graph, length_map, 0u);
+    static_assert(std::copyable<decltype(alg)>);
+    alg.run();
+    ASSERT_FALSE(alg.has_negative_cycle());
+    ASSERT_EQ(alg.dist(0u), 0);
+    ASSERT_EQ(alg.dist(1u), 2);
+    ASSERT_EQ(alg.dist(2u), 5);
+    ASSERT_EQ(alg.dist(3u), 4);
+    ASSERT_EQ(alg.dist(4u), 5);
+    ASSERT_TRUE(EQ_RANGES(alg.path_to(4u), {5u, 2u, 3u, 1u}));
+
+    alg.reset().add_source(0u);
+    alg.run(parallel_policy{2});
+    ASSERT_FALSE(alg.has_negative_cycle());
+    ASSERT_EQ(alg.dist(4u), 5);
+    ASSERT_TRUE(EQ_RANGES(alg.path_to(4u), {5u, 2u, 3u, 1u}));
+
+    alg.reset().add_source(3u).run();
+    ASSERT_FALSE(alg.reached(0u));
+    ASSERT_EQ(alg.dist(4u), 1);
+}
+
+GTEST_TEST(bellman_ford, negative_cycle) {
+    static_digraph_builder<static_digraph, int> builder(5);
+    builder.add_arc(0, 1, 1)
+        .add_arc(1, 2, 1)
+        .add_arc(2, 3, -4)
+        .add_arc(3, 1, 2)
+        .add_arc(3, 4, 1);
+    auto [graph, length_map] = builder.build();
+
+    bellman_ford alg(graph, length_map, 0u);
+    alg.run();
+    ASSERT_TRUE(alg.has_negative_cycle());
+    ASSERT_TRUE(EQ_MULTISETS(alg.negative_cycle(), {1u, 2u, 3u}));
+
+    alg.reset().add_source(0u);
+    alg.run(parallel_policy{2});
+    ASSERT_TRUE(alg.has_negative_cycle());
+    ASSERT_TRUE(EQ_MULTISETS(alg.negative_cycle(), {1u, 2u, 3u}));
+
+    alg.reset().add_source(4u).run();
+    ASSERT_FALSE(alg.has_negative_cycle());
+
+    ASSERT_FALSE(johnson_potentials(graph, length_map).has_value());
+}
+
+GTEST_TEST(bellman_ford, fuzzy_johnson_potentials) {
+    std::mt19937 engine{std::random_device{}()};
+    const std::size_t n = 300;
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+    std::uniform_int_distribution<int> length_distr(0, 100);
+    std::uniform_int_distribution<int> potential_distr(-50, 50);
+
+    std::vector<int> pi(n);
+    for(auto & p : pi) p = potential_distr(engine);
+    static_digraph_builder<static_digraph, int, int> builder(n);
+    for(std::size_t i = 0; i < 4 * n; ++i) {
+        const unsigned int u = vertex_distr(engine);
+        const unsigned int v = vertex_distr(engine);
+        const int w = length_distr(engine);
+        // lengths w + pi(v) - pi(u) have no negative cycle
+        builder.add_arc(u, v, w, w + pi[v] - pi[u]);
+    }
+    auto [graph, nonnegative_length_map, length_map] = builder.build();
+
+    const auto potentials = johnson_potentials(graph, length_map);
+    ASSERT_TRUE(potentials.has_value());
+    for(auto && a : arcs(graph))
+        ASSERT_GE(length_map[a] + potentials.value()[arc_source(graph, a)] -
+                      potentials.value()[arc_target(graph, a)],
+                  0);
+    const auto parallel_potentials =
+        johnson_potentials(graph, length_map, parallel_policy{4});
+    ASSERT_TRUE(parallel_potentials.has_value());
+    for(auto && u : vertices(graph))
+        ASSERT_EQ(parallel_potentials.value()[u], potentials.value()[u]);
+
+    bellman_ford alg(graph, length_map);
+    for(std::size_t i = 0; i < 10; ++i) {
+        const unsigned int s = vertex_distr(engine);
+        std::vector<int> dist(n, std::numeric_limits<int>::max());
+        for(auto && [u, u_dist] : dijkstra(graph, nonnegative_length_map, s))
+            dist[u] = u_dist - pi[s] + pi[u];
+
+        alg.reset().add_source(s).run();
+        ASSERT_FALSE(alg.has_negative_cycle());
+        for(auto && u : vertices(graph)) {
+            if(dist[u] == std::numeric_limits<int>::max()) {
+                ASSERT_FALSE(alg.reached(u));
+                continue;
+            }
+            ASSERT_EQ(alg.dist(u), dist[u]);
+            int path_length = 0;
+            for(auto && a : alg.path_to(u)) path_length += length_map[a];
+            ASSERT_EQ(path_length, dist[u]);
+        }
+
+        alg.reset().add_source(s);
+        alg.run(parallel_policy{4});
+        ASSERT_FALSE(alg.has_negative_cycle());
+        for(auto && u : vertices(graph)) {
+            if(dist[u] == std::numeric_limits<int>::max()) continue;
+            ASSERT_EQ(alg.dist(u), dist[u]);
+        }
+
+        auto reduced_length_map =
+            johnson_reduced_length_map(graph, length_map, potentials.value());
+        for(auto && [u, u_dist] : dijkstra(graph, reduced_length_map, s))
+            ASSERT_EQ(u_dist - potentials.value()[s] + potentials.value()[u],
+                      dist[u]);
+    }
+}
+
+GTEST_TEST(bellman_ford, fuzzy_negative_cycles) {
+    std::mt19937 engine{std::random_device{}()};
+    const std::size_t n = 200;
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+    std::uniform_int_distribution<int> length_distr(-20, 100);
+
+    for(std::size_t i = 0; i < 20; ++i) {
+        static_digraph_builder<static_digraph, int> builder(n);
+        for(std::size_t j = 0; j < 2 * n; ++j)
+            builder.add_arc(vertex_distr(engine), vertex_distr(engine),
+                            length_distr(engine));
+        auto [graph, length_map] = builder.build();
+        const unsigned int s = vertex_distr(engine);
+
+        bellman_ford alg(graph, length_map, s);
+        alg.run();
+        bellman_ford parallel_alg(graph, length_map, s);
+        parallel_alg.run(parallel_policy{4});
+        ASSERT_EQ(alg.has_negative_cycle(), parallel_alg.has_negative_cycle());
+        for(auto * a : {&alg, &parallel_alg}) {
+            if(!a->has_negative_cycle()) continue;
+            const auto cycle = a->negative_cycle();
+            int cycle_length = 0;
+            for(std::size_t j = 0; j < cycle.size(); ++j) {
+                ASSERT_EQ(arc_target(graph, cycle[j]),
+                          arc_source(graph, cycle[(j + 1) % cycle.size()]));
+                cycle_length += length_map[cycle[j]];
+            }
+            ASSERT_LT(cycle_length, 0);
+        }
+        if(alg.has_negative_cycle()) continue;
+        for(auto && a : arcs(graph)) {
+            const unsigned int u = arc_source(graph, a);
+            if(!alg.reached(u)) continue;
+            ASSERT_LE(alg.dist(arc_target(graph, a)),
+                      alg.dist(u) + length_map[a]);
+        }
+        for(auto && u : vertices(graph)) {
+            ASSERT_EQ(alg.reached(u), parallel_alg.reached(u));
+            if(!alg.reached(u)) continue;
+            ASSERT_EQ(alg.dist(u), parallel_alg.dist(u));
+        }
+    }
+}
@@ -1,7 +1,12 @@
 #undef NDEBUG
 #include <gtest/gtest.h>
 
+#include <limits>
+#include <random>
+#include <vector>
+
 #include "melon/algorithm/bidirectional_dijkstra.hpp"
+#include "melon/algorithm/dijkstra.hpp"
 #include "melon/utility/static_digraph_builder.hpp"
 #include "melon/container/static_digraph.hpp"
 
@@ -39,3 +44,39 @@ GTEST_TEST(bidirectional_dijkstra, test) {
     ASSERT_TRUE(EQ_MULTISETS(alg.path(), {1, 8}));
     alg.reset();
 }
+
+GTEST_TEST(bidirectional_dijkstra, fuzzy_monotone_queues) {
+    std::mt19937 engine{std::random_device{}()};
+    const std::size_t n = 300;
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+    std::uniform_int_distribution<unsigned int> length_distr(0, 300);
+
+    static_digraph_builder<static_digraph, unsigned int> builder(n);
+    for(std::size_t i = 0; i < 4 * n; ++i)
+        builder.add_arc(vertex_distr(engine), vertex_distr(engine),
+                        length_distr(engine));
+    auto [graph, length_map] = builder.build();
+
+    using radix_traits =
+        bidirectional_dijkstra_radix_heap_traits<static_digraph, unsigned int>;
+    using bucket_traits =
+        bidirectional_dijkstra_bucket_queue_traits<static_digraph,
+                                                   unsigned int>;
+    for(std::size_t i = 0; i < 10; ++i) {
+        const unsigned int s = vertex_distr(engine);
+        std::vector<unsigned int> dist(n,
+                                       std::numeric_limits<unsigned int>::max());
+        for(auto && [u, u_dist] : dijkstra(graph, length_map, s))
+            dist[u] = u_dist;
+        for(std::size_t j = 0; j < 10; ++j) {
+            const unsigned int t = vertex_distr(engine);
+            if(t == s) continue;
+            bidirectional_dijkstra radix_alg(radix_traits{}, graph, length_map,
+                                             s, t);
+            ASSERT_EQ(radix_alg.run(), dist[t]);
+            bidirectional_dijkstra bucket_alg(bucket_traits{}, graph,
+                                              length_map, s, t);
+            ASSERT_EQ(bucket_alg.run(), dist[t]);
+        }
+    }
+}
@@ -111,3 +111,20 @@ GTEST_TEST(breadth_first_search, algorithm_iterator) {
         ++cpt;
     }
 }
+
+GTEST_TEST(breadth_first_search, timestamped_traits_reset) {
+    static_digraph_builder<static_digraph> builder(5);
+    builder.add_arc(0, 1).add_arc(1, 2).add_arc(3, 4).add_arc(4, 0);
+    auto [graph] = builder.build();
+
+    breadth_first_search alg(
+        breadth_first_search_timestamped_traits<static_digraph>{}, graph);
+    alg.add_source(0u).run();
+    ASSERT_TRUE(alg.reached(2u));
+    ASSERT_FALSE(alg.reached(3u));
+    alg.reset().add_source(3u).run();
+    for(unsigned int u = 0; u < 5; ++u) ASSERT_TRUE(alg.reached(u));
+    alg.reset().add_source(2u).run();
+    ASSERT_TRUE(alg.reached(2u));
+    for(unsigned int u : {0u, 1u, 3u, 4u}) ASSERT_FALSE(alg.reached(u));
+}
@@ -0,0 +1,34 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <array>
+#include <utility>
+
+#include "melon/container/bucket_queue.hpp"
+
+using namespace fhamonic::melon;
+
+GTEST_TEST(bucket_queue, wrap_around_window) {
+    // A window of 64 consecutive priorities slides over 1000 times the 64
+    // initial buckets, such that the entries wrap around the circular array.
+    constexpr unsigned int window = 64;
+    bucket_queue<std::pair<unsigned int, unsigned int>, std::less<unsigned int>,
+                 std::array<std::size_t, window>, views::get_map<1>,
+                 views::get_map<0>>
+        heap;
+    for(unsigned int p = 0; p < window; ++p)
+        heap.push(std::make_pair(p, p));
+    for(unsigned int t = 0; t < 1000 * window; ++t) {
+        ASSERT_EQ(heap.size(), window);
+        ASSERT_EQ(heap.top(), std::make_pair(t % window, t));
+        heap.pop();
+        ASSERT_FALSE(heap.contains(t % window));
+        heap.push(std::make_pair(t % window, t + window));
+        ASSERT_TRUE(heap.contains(t % window));
+        ASSERT_EQ(heap.priority(t % window), t + window);
+    }
+    for(unsigned int t = 1000 * window; !heap.empty(); ++t) {
+        ASSERT_EQ(heap.top(), std::make_pair(t % window, t));
+        heap.pop();
+    }
+}
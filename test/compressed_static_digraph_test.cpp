@@ -0,0 +1,158 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/algorithm/strongly_connected_components.hpp"
+#include "melon/container/compressed_static_digraph.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/graph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic;
+using namespace fhamonic::melon;
+
+static_assert(melon::graph<compressed_static_digraph>);
+static_assert(melon::outward_incidence_graph<compressed_static_digraph>);
+static_assert(melon::outward_adjacency_graph<compressed_static_digraph>);
+static_assert(melon::inward_incidence_graph<compressed_static_digraph>);
+static_assert(melon::inward_adjacency_graph<compressed_static_digraph>);
+static_assert(melon::has_vertex_map<compressed_static_digraph>);
+static_assert(melon::has_arc_map<compressed_static_digraph>);
+
+GTEST_TEST(compressed_static_digraph, empty_constructor) {
+    compressed_static_digraph graph;
+    ASSERT_EQ(num_vertices(graph), 0);
+    ASSERT_EQ(num_arcs(graph), 0);
+    ASSERT_TRUE(EMPTY(vertices(graph)));
+    ASSERT_TRUE(EMPTY(arcs(graph)));
+    ASSERT_FALSE(is_valid_vertex(graph, 0));
+
+    EXPECT_DEATH((void)out_arcs(graph, 0), "");
+    EXPECT_DEATH((void)in_arcs(graph, 0), "");
+}
+
+GTEST_TEST(compressed_static_digraph, empty_vectors_constructor) {
+    std::vector<vertex_t<compressed_static_digraph>> sources;
+    std::vector<vertex_t<compressed_static_digraph>> targets;
+
+    compressed_static_digraph graph(1, sources, targets);
+    ASSERT_EQ(num_vertices(graph), 1);
+    ASSERT_EQ(num_arcs(graph), 0);
+    ASSERT_TRUE(EQ_MULTISETS(vertices(graph), {0}));
+    ASSERT_TRUE(EMPTY(arcs(graph)));
+    ASSERT_TRUE(EMPTY(out_neighbors(graph, 0)));
+    ASSERT_TRUE(EMPTY(in_neighbors(graph, 0)));
+
+    EXPECT_DEATH((void)out_arcs(graph, 1), "");
+}
+
+GTEST_TEST(compressed_static_digraph, vectors_constructor) {
+    std::vector<vertex_t<compressed_static_digraph>> sources(
+        {1, 1, 1, 2, 2, 3, 5, 5, 6});
+    std::vector<vertex_t<compressed_static_digraph>> targets(
+        {2, 6, 7, 3, 4, 4, 2, 3, 5});
+
+    compressed_static_digraph graph(8, sources, targets);
+    ASSERT_EQ(num_vertices(graph), 8);
+    ASSERT_EQ(num_arcs(graph), 9);
+
+    ASSERT_TRUE(EMPTY(out_neighbors(graph, 0)));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 1), {2, 6, 7}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 2), {3, 4}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 5), {2, 3}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 6), {5}));
+    ASSERT_TRUE(EMPTY(out_neighbors(graph, 7)));
+
+    ASSERT_TRUE(EQ_RANGES(in_neighbors(graph, 2), {1, 5}));
+    ASSERT_TRUE(EQ_RANGES(in_neighbors(graph, 3), {2, 5}));
+    ASSERT_TRUE(EQ_RANGES(in_neighbors(graph, 4), {2, 3}));
+    ASSERT_TRUE(EMPTY(in_neighbors(graph, 1)));
+
+    ASSERT_EQ(out_degree(graph, 1), 3);
+    ASSERT_EQ(graph.in_degree(4), 2);
+
+    std::size_t i = 0;
+    for(auto && a : arcs(graph)) {
+        ASSERT_EQ(static_cast<std::size_t>(a), i);
+        ASSERT_EQ(arc_source(graph, a), sources[i]);
+        ASSERT_EQ(arc_target(graph, a), targets[i]);
+        ++i;
+    }
+    ASSERT_EQ(i, num_arcs(graph));
+    for(auto && v : vertices(graph))
+        for(auto && a : in_arcs(graph, v)) {
+            ASSERT_EQ(arc_target(graph, a), v);
+            ASSERT_EQ(arc_source(graph, a), sources[a]);
+        }
+}
+
+GTEST_TEST(compressed_static_digraph, large_gaps) {
+    const unsigned int n = 1u << 20;
+    std::vector<unsigned int> sources({0, 0, n - 1, n - 1});
+    std::vector<unsigned int> targets({n - 1, 1, 0, n / 2});
+
+    compressed_static_digraph graph(n, sources, targets);
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 0), {n - 1, 1u}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, n - 1), {0u, n / 2}));
+    ASSERT_TRUE(EQ_RANGES(in_neighbors(graph, 0), {n - 1}));
+    ASSERT_TRUE(EQ_RANGES(in_neighbors(graph, n - 1), {0}));
+    ASSERT_TRUE(EQ_RANGES(in_neighbors(graph, n / 2), {n - 1}));
+}
+
+GTEST_TEST(compressed_static_digraph, same_as_static_digraph) {
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<unsigned int> distr(0, 199);
+    static_digraph_builder<static_digraph, int> builder(200);
+    std::vector<unsigned int> sources, targets;
+    for(std::size_t i = 0; i < 2000; ++i)
+        builder.add_arc(distr(engine), distr(engine),
+                        static_cast<int>(distr(engine)));
+    auto [graph, length_map] = builder.build();
+    for(auto && a : arcs(graph)) {
+        sources.push_back(arc_source(graph, a));
+        targets.push_back(arc_target(graph, a));
+    }
+    compressed_static_digraph cgraph(200, sources, targets);
+
+    ASSERT_EQ(num_arcs(cgraph), num_arcs(graph));
+    ASSERT_LT(cgraph.num_bytes(),
+              num_arcs(graph) * 4 * sizeof(unsigned int) +
+                  num_vertices(graph) * 2 * sizeof(unsigned int));
+    for(auto && u : vertices(graph)) {
+        ASSERT_TRUE(EQ_RANGES(out_neighbors(cgraph, u), out_neighbors(graph, u)));
+        ASSERT_TRUE(
+            EQ_MULTISETS(in_neighbors(cgraph, u), in_neighbors(graph, u)));
+        ASSERT_EQ(out_degree(cgraph, u), out_degree(graph, u));
+    }
+
+    breadth_first_search bfs(graph, 0u);
+    breadth_first_search cbfs(cgraph, 0u);
+    ASSERT_TRUE(EQ_RANGES(bfs, cbfs));
+
+    dijkstra alg(graph, length_map, 0u);
+    dijkstra calg(cgraph, length_map, 0u);
+    for(; !alg.finished(); alg.advance(), calg.advance()) {
+        ASSERT_FALSE(calg.finished());
+        ASSERT_EQ(alg.current().second, calg.current().second);
+    }
+    ASSERT_TRUE(calg.finished());
+
+    const auto sorted_components = [](auto && g) {
+        std::vector<std::vector<unsigned int>> components;
+        for(auto && component : strongly_connected_components(g)) {
+            components.emplace_back();
+            for(auto && u : component) components.back().push_back(u);
+            std::ranges::sort(components.back());
+        }
+        std::ranges::sort(components);
+        return components;
+    };
+    ASSERT_EQ(sorted_components(graph), sorted_components(cgraph));
+}
@@ -0,0 +1,126 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/condensation.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+using namespace fhamonic::melon;
+
+GTEST_TEST(condensation, test) {
+    static_digraph_builder<static_digraph, int> builder(7);
+    builder.add_arc(0, 1, 1)
+        .add_arc(1, 0, 2)
+        .add_arc(1, 2, 3)
+        .add_arc(0, 2, 4)
+        .add_arc(2, 3, 5)
+        .add_arc(3, 4, 6)
+        .add_arc(4, 3, 7)
+        .add_arc(3, 3, 8)
+        .add_arc(6, 2, 9)
+        .add_arc(6, 4, 10)
+        .add_arc(6, 3, 11);
+    auto [graph, weights] = builder.build();
+
+    const auto condensed = condense(graph);
+    const static_digraph & dag = condensed.graph();
+    ASSERT_EQ(condensed.num_components(), 5);
+    ASSERT_EQ(condensed.component(0u), condensed.component(1u));
+    ASSERT_EQ(condensed.component(3u), condensed.component(4u));
+
+    const unsigned int c01 = condensed.component(0u);
+    const unsigned int c2 = condensed.component(2u);
+    const unsigned int c34 = condensed.component(3u);
+    const unsigned int c6 = condensed.component(6u);
+    ASSERT_LT(c01, c2);
+    ASSERT_LT(c6, c2);
+    ASSERT_LT(c2, c34);
+
+    ASSERT_EQ(num_arcs(dag), 4);
+    const auto weight_sums =
+        condensed.aggregate_arc_map(weights, std::plus<>{});
+    const auto weight_mins =
+        condensed.aggregate_arc_map(weights, std::ranges::min);
+    for(auto && a : arcs(dag)) {
+        const unsigned int s = arc_source(dag, a);
+        const unsigned int t = arc_target(dag, a);
+        if(s == c01 && t == c2) {
+            ASSERT_EQ(condensed.original_arcs(a).size(), 2);
+            ASSERT_EQ(weight_sums[a], 7);
+            ASSERT_EQ(weight_mins[a], 3);
+        } else if(s == c6 && t == c34) {
+            ASSERT_EQ(weight_sums[a], 21);
+            ASSERT_EQ(weight_mins[a], 10);
+        } else if(s == c6 && t == c2) {
+            ASSERT_EQ(weight_sums[a], 9);
+        } else {
+            ASSERT_EQ(s, c2);
+            ASSERT_EQ(t, c34);
+            ASSERT_EQ(weight_mins[a], 5);
+        }
+    }
+}
+
+GTEST_TEST(condensation, fuzzy) {
+    std::mt19937 engine{std::random_device{}()};
+    const std::size_t n = 500;
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+    std::uniform_int_distribution<int> weight_distr(-50, 50);
+
+    for(const std::size_t m : {n / 2, n, 2 * n, 4 * n}) {
+        static_digraph_builder<static_digraph, int> builder(n);
+        for(std::size_t i = 0; i < m; ++i)
+            builder.add_arc(vertex_distr(engine), vertex_distr(engine),
+                            weight_distr(engine));
+        auto [graph, weights] = builder.build();
+
+        const auto condensed = condense(graph);
+        const static_digraph & dag = condensed.graph();
+        std::set<std::pair<unsigned int, unsigned int>> expected_arcs;
+        for(auto && a : arcs(graph)) {
+            const unsigned int s = condensed.component(arc_source(graph, a));
+            const unsigned int t = condensed.component(arc_target(graph, a));
+            if(s != t) expected_arcs.emplace(s, t);
+        }
+        ASSERT_EQ(num_arcs(dag), expected_arcs.size());
+
+        std::vector<bool> seen_arcs(num_arcs(graph), false);
+        const auto weight_sums =
+            condensed.aggregate_arc_map(weights, std::plus<>{});
+        for(auto && a : arcs(dag)) {
+            const unsigned int s = arc_source(dag, a);
+            const unsigned int t = arc_target(dag, a);
+            ASSERT_LT(s, t);
+            ASSERT_TRUE(expected_arcs.contains({s, t}));
+            int sum = 0;
+            for(auto && b : condensed.original_arcs(a)) {
+                ASSERT_FALSE(seen_arcs[b]);
+                seen_arcs[b] = true;
+                ASSERT_EQ(condensed.component(arc_source(graph, b)), s);
+                ASSERT_EQ(condensed.component(arc_target(graph, b)), t);
+                sum += weights[b];
+            }
+            ASSERT_EQ(weight_sums[a], sum);
+        }
+
+        // vertices are in the same component iff they reach each other
+        std::vector<std::vector<bool>> reaches(n, std::vector<bool>(n, false));
+        for(auto && u : vertices(graph)) {
+            for(auto && v : breadth_first_search(graph, u))
+                reaches[u][v] = true;
+        }
+        for(auto && u : vertices(graph)) {
+            for(auto && v : vertices(graph))
+                ASSERT_EQ(condensed.component(u) == condensed.component(v),
+                          reaches[u][v] && reaches[v][u]);
+        }
+    }
+}
@@ -0,0 +1,150 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "melon/algorithm/contraction_hierarchy.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic::melon;
+
+GTEST_TEST(contraction_hierarchy, test) {
+    static_digraph_builder<static_digraph, int> builder(6);
+
+    builder.add_arc(0, 1, 7)
+        .add_arc(0, 2, 9)
+        .add_arc(0, 5, 14)
+        .add_arc(1, 0, 7)
+        .add_arc(1, 2, 10)
+        .add_arc(1, 3, 15)
+        .add_arc(2, 0, 9)
+        .add_arc(2, 1, 10)
+        .add_arc(2, 3, 12)
+        .add_arc(2, 5, 2)
+        .add_arc(3, 1, 15)
+        .add_arc(3, 2, 12)
+        .add_arc(3, 4, 6)
+        .add_arc(4, 3, 6)
+        .add_arc(4, 5, 9)
+        .add_arc(5, 0, 14)
+        .add_arc(5, 2, 2)
+        .add_arc(5, 4, 9);
+
+    auto [graph, length_map] = builder.build();
+
+    contraction_hierarchy<int> ch(graph, length_map);
+    ASSERT_EQ(ch.num_vertices(), 6);
+
+    contraction_hierarchy_query query(ch, 0u, 3u);
+    ASSERT_EQ(query.run(), 21);
+    ASSERT_TRUE(query.path_found());
+    ASSERT_TRUE(EQ_RANGES(query.path(), {1u, 8u}));
+
+    query.reset().add_source(0u).add_target(4u);
+    ASSERT_EQ(query.run(), 20);
+    ASSERT_TRUE(EQ_RANGES(query.path(), {1u, 9u, 17u}));
+
+    query.reset().add_source(2u).add_target(2u);
+    ASSERT_EQ(query.run(), 0);
+    ASSERT_TRUE(query.path_found());
+    ASSERT_TRUE(EMPTY(query.path()));
+}
+
+GTEST_TEST(contraction_hierarchy, ranks) {
+    static_digraph_builder<static_digraph, int> builder(5);
+    builder.add_arc(0, 1, 1)
+        .add_arc(1, 2, 1)
+        .add_arc(2, 3, 1)
+        .add_arc(3, 4, 1)
+        .add_arc(4, 0, 1);
+    auto [graph, length_map] = builder.build();
+    contraction_hierarchy<int> ch(graph, length_map);
+
+    std::vector<bool> ranked(5, false);
+    for(auto && u : vertices(graph)) {
+        ASSERT_LT(ch.rank(u), 5);
+        ASSERT_FALSE(ranked[ch.rank(u)]);
+        ranked[ch.rank(u)] = true;
+    }
+    for(auto && a : arcs(ch.upward_graph()))
+        ASSERT_LT(ch.rank(arc_source(ch.upward_graph(), a)),
+                  ch.rank(arc_target(ch.upward_graph(), a)));
+    for(auto && a : arcs(ch.downward_graph()))
+        ASSERT_LT(ch.rank(arc_source(ch.downward_graph(), a)),
+                  ch.rank(arc_target(ch.downward_graph(), a)));
+    ASSERT_EQ(num_arcs(ch.upward_graph()) + num_arcs(ch.downward_graph()),
+              5 + ch.num_shortcuts());
+
+    contraction_hierarchy_query query(ch);
+    for(auto && s : vertices(graph)) {
+        for(auto && t : vertices(graph)) {
+            query.reset().add_source(s).add_target(t);
+            ASSERT_EQ(query.run(), (t + 5 - s) % 5);
+        }
+    }
+}
+
+GTEST_TEST(contraction_hierarchy, unreachable) {
+    static_digraph_builder<static_digraph, int> builder(4);
+    builder.add_arc(0, 1, 3).add_arc(1, 2, 4).add_arc(3, 2, 1);
+    auto [graph, length_map] = builder.build();
+    contraction_hierarchy<int> ch(graph, length_map);
+
+    contraction_hierarchy_query query(ch, 2u, 0u);
+    ASSERT_EQ(query.run(), std::numeric_limits<int>::max());
+    ASSERT_FALSE(query.path_found());
+
+    query.reset().add_source(0u).add_target(3u);
+    ASSERT_EQ(query.run(), std::numeric_limits<int>::max());
+    ASSERT_FALSE(query.path_found());
+
+    query.reset().add_source(0u).add_target(2u);
+    ASSERT_EQ(query.run(), 7);
+    ASSERT_TRUE(EQ_RANGES(query.path(), {0u, 1u}));
+}
+
+GTEST_TEST(contraction_hierarchy, fuzzy_same_as_dijkstra) {
+    std::mt19937 engine{std::random_device{}()};
+    const std::size_t n = 300;
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+    std::uniform_int_distribution<unsigned int> length_distr(0, 100);
+
+    static_digraph_builder<static_digraph, unsigned int> builder(n);
+    for(std::size_t i = 0; i < 4 * n; ++i)
+        builder.add_arc(vertex_distr(engine), vertex_distr(engine),
+                        length_distr(engine));
+    auto [graph, length_map] = builder.build();
+
+    for(const std::size_t max_witness_settled : {0ul, 4ul, 256ul}) {
+        contraction_hierarchy<unsigned int> ch(graph, length_map,
+                                               max_witness_settled);
+        contraction_hierarchy_query query(ch);
+        for(std::size_t i = 0; i < 20; ++i) {
+            const unsigned int s = vertex_distr(engine);
+            std::vector<unsigned int> dist(
+                n, std::numeric_limits<unsigned int>::max());
+            for(auto && [u, u_dist] : dijkstra(graph, length_map, s))
+                dist[u] = u_dist;
+            for(auto && t : vertices(graph)) {
+                query.reset().add_source(s).add_target(t);
+                ASSERT_EQ(query.run(), dist[t]);
+                if(!query.path_found()) continue;
+                unsigned int u = s;
+                unsigned int path_length = 0;
+                for(auto && a : query.path()) {
+                    ASSERT_EQ(arc_source(graph, a), u);
+                    u = arc_target(graph, a);
+                    path_length += length_map[a];
+                }
+                ASSERT_EQ(u, t);
+                ASSERT_EQ(path_length, dist[t]);
+            }
+        }
+    }
+}
@@ -0,0 +1,122 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "melon/algorithm/customizable_route_planning.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+using namespace fhamonic::melon;
+
+GTEST_TEST(customizable_route_planning, test) {
+    static_digraph_builder<static_digraph, int> builder(6);
+
+    builder.add_arc(0, 1, 7)
+        .add_arc(0, 2, 9)
+        .add_arc(0, 5, 14)
+        .add_arc(1, 0, 7)
+        .add_arc(1, 2, 10)
+        .add_arc(1, 3, 15)
+        .add_arc(2, 0, 9)
+        .add_arc(2, 1, 10)
+        .add_arc(2, 3, 12)
+        .add_arc(2, 5, 2)
+        .add_arc(3, 1, 15)
+        .add_arc(3, 2, 12)
+        .add_arc(3, 4, 6)
+        .add_arc(4, 3, 6)
+        .add_arc(4, 5, 9)
+        .add_arc(5, 0, 14)
+        .add_arc(5, 2, 2)
+        .add_arc(5, 4, 9);
+
+    auto [graph, length_map] = builder.build();
+
+    customizable_route_planning<int> crp(graph, {{0, 0, 1, 1, 2, 2},
+                                                  {0, 0, 0, 0, 1, 1}});
+    ASSERT_EQ(crp.num_levels(), 2);
+    ASSERT_EQ(crp.num_cells(0), 3);
+    ASSERT_EQ(crp.num_cells(1), 2);
+    ASSERT_FALSE(crp.customized());
+    crp.customize(length_map);
+    ASSERT_TRUE(crp.customized());
+
+    customizable_route_planning_query query(crp, 0u, 3u);
+    ASSERT_EQ(query.run(), 21);
+    ASSERT_TRUE(query.path_found());
+
+    query.reset().add_source(0u).add_target(4u);
+    ASSERT_EQ(query.run(), 20);
+
+    query.reset().add_source(2u).add_target(2u);
+    ASSERT_EQ(query.run(), 0);
+    ASSERT_TRUE(query.path_found());
+
+    for(auto && a : arcs(graph)) length_map[a] *= 2;
+    crp.customize(length_map);
+    query.reset().add_source(0u).add_target(4u);
+    ASSERT_EQ(query.run(), 40);
+}
+
+GTEST_TEST(customizable_route_planning, unreachable) {
+    static_digraph_builder<static_digraph, int> builder(4);
+    builder.add_arc(0, 1, 3).add_arc(1, 2, 4).add_arc(3, 2, 1);
+    auto [graph, length_map] = builder.build();
+    customizable_route_planning<int> crp(graph, std::vector<std::size_t>{2});
+    crp.customize(length_map);
+
+    customizable_route_planning_query query(crp, 2u, 0u);
+    ASSERT_EQ(query.run(), std::numeric_limits<int>::max());
+    ASSERT_FALSE(query.path_found());
+
+    query.reset().add_source(0u).add_target(3u);
+    ASSERT_EQ(query.run(), std::numeric_limits<int>::max());
+    ASSERT_FALSE(query.path_found());
+
+    query.reset().add_source(0u).add_target(2u);
+    ASSERT_EQ(query.run(), 7);
+}
+
+GTEST_TEST(customizable_route_planning, fuzzy_same_as_dijkstra) {
+    std::mt19937 engine{std::random_device{}()};
+    const std::size_t n = 300;
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+    std::uniform_int_distribution<unsigned int> length_distr(0, 100);
+
+    static_digraph_builder<static_digraph, unsigned int> builder(n);
+    for(std::size_t i = 0; i < 4 * n; ++i)
+        builder.add_arc(vertex_distr(engine), vertex_distr(engine),
+                        length_distr(engine));
+    auto [graph, length_map] = builder.build();
+
+    customizable_route_planning<unsigned int> crp(
+        graph, std::vector<std::size_t>{8, 32, 128});
+    ASSERT_EQ(crp.num_levels(), 3);
+    for(auto && u : vertices(graph))
+        for(auto && w : vertices(graph))
+            for(std::size_t l = 1; l < crp.num_levels(); ++l)
+                if(crp.cell_of(l - 1, u) == crp.cell_of(l - 1, w)) {
+                    ASSERT_EQ(crp.cell_of(l, u), crp.cell_of(l, w));
+                }
+
+    for(const std::size_t num_threads : {1ul, 4ul}) {
+        for(auto && a : arcs(graph)) length_map[a] = length_distr(engine);
+        crp.customize(parallel_policy{num_threads}, length_map);
+        customizable_route_planning_query query(crp);
+        for(std::size_t i = 0; i < 20; ++i) {
+            const unsigned int s = vertex_distr(engine);
+            std::vector<unsigned int> dist(
+                n, std::numeric_limits<unsigned int>::max());
+            for(auto && [u, u_dist] : dijkstra(graph, length_map, s))
+                dist[u] = u_dist;
+            for(auto && t : vertices(graph)) {
+                query.reset().add_source(s).add_target(t);
+                ASSERT_EQ(query.run(), dist[t]);
+            }
+        }
+    }
+}
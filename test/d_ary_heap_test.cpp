@@ -205,6 +205,37 @@ GTEST_TEST(updatable_d_ary_heap, 2_heap_promote_test) {
     // }
 }
 
+GTEST_TEST(updatable_d_ary_heap, 2_heap_demote_test) {
+    std::vector<int> datas = {0, 7, 3, 5, 6, 11};
+    constexpr std::size_t nb_elements = 6;
+    updatable_d_ary_heap<2, std::pair<unsigned int, int>, std::greater<int>,
+                         std::array<std::size_t, nb_elements>,
+                         views::get_map<1>, views::get_map<0>>
+        heap;
+
+    for(unsigned int i = 0; i < nb_elements; ++i) {
+        heap.push(std::make_pair(i, datas[i]));
+    }
+    heap.demote(5u, 4);
+    heap.demote(1u, 1);
+    ASSERT_EQ(heap.priority(5u), 4);
+
+    std::vector<std::pair<unsigned int, int>> popped;
+    while(!heap.empty()) {
+        ASSERT_TRUE(heap.contains(heap.top().first));
+        popped.push_back(heap.top());
+        heap.pop();
+        ASSERT_FALSE(heap.contains(popped.back().first));
+    }
+    ASSERT_TRUE(EQ_RANGES(popped, std::vector<std::pair<unsigned int, int>>(
+                                      {{4u, 6},
+                                       {3u, 5},
+                                       {5u, 4},
+                                       {2u, 3},
+                                       {1u, 1},
+                                       {0u, 0}})));
+}
+
 // GTEST_TEST(updatable_d_ary_heap, 2_heap_promote_external_priority_test) {
 //     external_priority_map::array = {0, 7, 3, 5, 6, 11};
 //     constexpr std::size_t nb_elements = 6;
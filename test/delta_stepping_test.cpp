@@ -0,0 +1,110 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "melon/algorithm/delta_stepping.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+using namespace fhamonic::melon;
+
+GTEST_TEST(delta_stepping, test) {
+    static_digraph_builder<static_digraph, int> builder(6);
+
+    builder.add_arc(0, 1, 7)
+        .add_arc(0, 2, 9)
+        .add_arc(0, 5, 14)
+        .add_arc(1, 0, 7)
+        .add_arc(1, 2, 10)
+        .add_arc(1, 3, 15)
+        .add_arc(2, 0, 9)
+        .add_arc(2, 1, 10)
+        .add_arc(2, 3, 12)
+        .add_arc(2, 5, 2)
+        .add_arc(3, 1, 15)
+        .add_arc(3, 2, 12)
+        .add_arc(3, 4, 6)
+        .add_arc(4, 3, 6)
+        .add_arc(4, 5, 9)
+        .add_arc(5, 0, 14)
+        .add_arc(5, 2, 2)
+        .add_arc(5, 4, 9);
+
+    auto [graph, length_map] = builder.build();
+
+    delta_stepping alg(graph, length_map, 5);
+    alg.add_source(0);
+    alg.run();
+
+    const std::vector<int> expected = {0, 7, 9, 21, 20, 11};
+    for(unsigned int u = 0; u < 6; ++u) {
+        ASSERT_TRUE(alg.reached(u));
+        ASSERT_EQ(alg.dist(u), expected[u]);
+    }
+}
+
+GTEST_TEST(delta_stepping, unreachable) {
+    static_digraph_builder<static_digraph, int> builder(3);
+    builder.add_arc(0, 1, 3).add_arc(2, 0, 1);
+    auto [graph, length_map] = builder.build();
+
+    delta_stepping alg(graph, length_map, 2);
+    alg.add_source(0).run();
+    ASSERT_EQ(alg.dist(0), 0);
+    ASSERT_EQ(alg.dist(1), 3);
+    ASSERT_FALSE(alg.reached(2));
+}
+
+GTEST_TEST(delta_stepping, fuzzy_same_as_dijkstra) {
+    std::mt19937 engine{std::random_device{}()};
+    const std::size_t n = 2000;
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+    std::uniform_int_distribution<unsigned int> length_distr(0, 1000);
+    std::uniform_real_distribution<double> real_length_distr(0.0, 1.0);
+
+    static_digraph_builder<static_digraph, unsigned int, double> builder(n);
+    for(std::size_t i = 0; i < 8 * n; ++i)
+        builder.add_arc(vertex_distr(engine), vertex_distr(engine),
+                        length_distr(engine), real_length_distr(engine));
+    auto [graph, length_map, real_length_map] = builder.build();
+
+    for(std::size_t i = 0; i < 10; ++i) {
+        const unsigned int s = vertex_distr(engine);
+        std::vector<unsigned int> dist(n,
+                                       std::numeric_limits<unsigned int>::max());
+        for(auto && [u, u_dist] : dijkstra(graph, length_map, s))
+            dist[u] = u_dist;
+        std::vector<double> real_dist(n, std::numeric_limits<double>::max());
+        for(auto && [u, u_dist] : dijkstra(graph, real_length_map, s))
+            real_dist[u] = u_dist;
+
+        for(const std::size_t num_threads : {1ul, 4ul}) {
+            for(const unsigned int delta : {1u, 50u, 2000u}) {
+                delta_stepping alg(parallel_policy{num_threads}, graph,
+                                   length_map, delta);
+                alg.add_source(s).run();
+                for(unsigned int u = 0; u < n; ++u) {
+                    if(dist[u] == std::numeric_limits<unsigned int>::max()) {
+                        ASSERT_FALSE(alg.reached(u));
+                    } else {
+                        ASSERT_EQ(alg.dist(u), dist[u]);
+                    }
+                }
+            }
+            delta_stepping real_alg(parallel_policy{num_threads}, graph,
+                                    real_length_map, 0.1);
+            real_alg.add_source(s).run();
+            for(unsigned int u = 0; u < n; ++u) {
+                if(real_dist[u] == std::numeric_limits<double>::max()) {
+                    ASSERT_FALSE(real_alg.reached(u));
+                } else {
+                    ASSERT_EQ(real_alg.dist(u), real_dist[u]);
+                }
+            }
+        }
+    }
+}
@@ -1,6 +1,10 @@
 #undef NDEBUG
 #include <gtest/gtest.h>
 
+#include <limits>
+#include <random>
+#include <vector>
+
 #include "melon/algorithm/dijkstra.hpp"
 #include "melon/container/static_digraph.hpp"
 #include "melon/utility/static_digraph_builder.hpp"
@@ -149,3 +153,72 @@ GTEST_TEST(dijkstra, path_to) {
         std::views::transform(path, [&id](const auto & a) { return id[a]; }),
         {2, 8}));
 }
+
+GTEST_TEST(dijkstra, fuzzy_monotone_queues) {
+    std::mt19937 engine{std::random_device{}()};
+    const std::size_t n = 500;
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+    std::uniform_int_distribution<unsigned int> length_distr(0, 300);
+
+    static_digraph_builder<static_digraph, unsigned int> builder(n);
+    for(std::size_t i = 0; i < 4 * n; ++i)
+        builder.add_arc(vertex_distr(engine), vertex_distr(engine),
+                        length_distr(engine));
+    auto [graph, length_map] = builder.build();
+
+    using radix_traits = dijkstra_radix_heap_traits<static_digraph, unsigned int>;
+    using bucket_traits =
+        dijkstra_bucket_queue_traits<static_digraph, unsigned int>;
+    for(std::size_t i = 0; i < 10; ++i) {
+        const unsigned int s = vertex_distr(engine);
+        std::vector<unsigned int> dist(n,
+                                       std::numeric_limits<unsigned int>::max());
+        for(auto && [u, u_dist] : dijkstra(graph, length_map, s))
+            dist[u] = u_dist;
+        std::size_t num_visited = 0;
+        for(auto && [u, u_dist] :
+            dijkstra(radix_traits{}, graph, length_map, s)) {
+            ASSERT_EQ(u_dist, dist[u]);
+            ++num_visited;
+        }
+        for(auto && [u, u_dist] :
+            dijkstra(bucket_traits{}, graph, length_map, s)) {
+            ASSERT_EQ(u_dist, dist[u]);
+            --num_visited;
+        }
+        ASSERT_EQ(num_visited, 0);
+    }
+}
+
+GTEST_TEST(dijkstra, fuzzy_timestamped_traits_reset) {
+    std::mt19937 engine{std::random_device{}()};
+    const std::size_t n = 500;
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+    std::uniform_int_distribution<int> length_distr(0, 300);
+
+    static_digraph_builder<static_digraph, int> builder(n);
+    for(std::size_t i = 0; i < 2 * n; ++i)
+        builder.add_arc(vertex_distr(engine), vertex_distr(engine),
+                        length_distr(engine));
+    auto [graph, length_map] = builder.build();
+
+    using timestamped_traits = dijkstra_timestamped_traits<static_digraph, int>;
+    dijkstra alg(timestamped_traits{}, graph, length_map);
+    for(std::size_t i = 0; i < 20; ++i) {
+        const unsigned int s = vertex_distr(engine);
+        std::vector<int> dist(n, std::numeric_limits<int>::max());
+        for(auto && [u, u_dist] : dijkstra(graph, length_map, s))
+            dist[u] = u_dist;
+        alg.reset().add_source(s);
+        std::size_t num_visited = 0;
+        for(auto && [u, u_dist] : alg) {
+            ASSERT_EQ(u_dist, dist[u]);
+            ++num_visited;
+        }
+        ASSERT_EQ(num_visited,
+                  static_cast<std::size_t>(std::ranges::count_if(
+                      dist, [](int d) {
+                          return d != std::numeric_limits<int>::max();
+                      })));
+    }
+}
@@ -72,6 +72,26 @@ GTEST_TEST(dinitz, test) {
     alg.reset();
 }
 
+GTEST_TEST(dinitz, timestamped_traits) {
+    static_digraph_builder<static_digraph, int> builder(6);
+    builder.add_arc(0, 1, 16)
+        .add_arc(0, 2, 13)
+        .add_arc(1, 2, 10)
+        .add_arc(1, 3, 12)
+        .add_arc(2, 1, 4)
+        .add_arc(2, 4, 14)
+        .add_arc(3, 2, 9)
+        .add_arc(3, 5, 20)
+        .add_arc(4, 3, 7)
+        .add_arc(4, 5, 4);
+    auto [graph, capacity] = builder.build();
+
+    dinitz alg(dinitz_timestamped_traits<static_digraph>{}, graph, capacity,
+               0u, 5u);
+    ASSERT_EQ(alg.run().flow_value(), 23);
+    ASSERT_TRUE(EQ_MULTISETS(alg.minimum_cut(), {3u, 8u, 9u}));
+}
+
 #include "melon/mapping.hpp"
 #include "melon/views/complete_digraph.hpp"
 
@@ -0,0 +1,150 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/direction_optimizing_breadth_first_search.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+using namespace fhamonic::melon;
+
+struct bfs_distances_traits : public breadth_first_search_default_traits {
+    static constexpr bool store_distances = true;
+};
+
+struct do_bfs_traits
+    : public direction_optimizing_breadth_first_search_default_traits {
+    static constexpr bool store_pred_vertices = true;
+    static constexpr bool store_distances = true;
+};
+
+// switches to bottom-up as soon as the frontier has out arcs and stays there
+struct do_bfs_bottom_up_traits : public do_bfs_traits {
+    static constexpr std::size_t bottom_up_arcs_ratio =
+        std::numeric_limits<std::size_t>::max();
+    static constexpr std::size_t top_down_vertices_ratio =
+        std::numeric_limits<std::size_t>::max();
+};
+
+GTEST_TEST(direction_optimizing_breadth_first_search, test) {
+    static_digraph_builder<static_digraph> builder(8);
+    builder.add_arc(0, 1)
+        .add_arc(0, 2)
+        .add_arc(0, 5)
+        .add_arc(1, 3)
+        .add_arc(2, 3)
+        .add_arc(3, 4)
+        .add_arc(4, 5)
+        .add_arc(5, 4)
+        .add_arc(7, 5);
+    auto [graph] = builder.build();
+
+    direction_optimizing_breadth_first_search alg(do_bfs_traits{}, graph, 0u);
+    static_assert(std::copyable<decltype(alg)>);
+
+    alg.advance();
+    ASSERT_FALSE(alg.finished());
+    ASSERT_TRUE(alg.reached(1u));
+    ASSERT_FALSE(alg.reached(3u));
+    alg.run();
+
+    const std::vector<int> dist = {0, 1, 1, 2, 2, 1};
+    for(unsigned int u = 0; u < 6; ++u) {
+        ASSERT_TRUE(alg.reached(u));
+        ASSERT_EQ(alg.dist(u), dist[u]);
+    }
+    ASSERT_FALSE(alg.reached(6u));
+    ASSERT_FALSE(alg.reached(7u));
+    ASSERT_EQ(alg.pred_vertex(4u), 5u);
+
+    direction_optimizing_breadth_first_search bottom_up_alg(
+        do_bfs_bottom_up_traits{}, graph, 0u);
+    bottom_up_alg.advance();
+    ASSERT_TRUE(bottom_up_alg.bottom_up());
+    bottom_up_alg.run();
+    for(unsigned int u = 0; u < 6; ++u)
+        ASSERT_EQ(bottom_up_alg.dist(u), dist[u]);
+    ASSERT_FALSE(bottom_up_alg.reached(6u));
+    ASSERT_FALSE(bottom_up_alg.reached(7u));
+    ASSERT_EQ(bottom_up_alg.pred_vertex(4u), 5u);
+}
+
+template <typename _Traits>
+void check_against_breadth_first_search(const static_digraph & graph,
+                                        const unsigned int s) {
+    breadth_first_search bfs(bfs_distances_traits{}, graph, s);
+    bfs.run();
+    direction_optimizing_breadth_first_search alg(_Traits{}, graph, s);
+    alg.run();
+    for(auto && u : vertices(graph)) {
+        ASSERT_EQ(alg.reached(u), bfs.reached(u));
+        if(!bfs.reached(u)) continue;
+        ASSERT_EQ(alg.dist(u), bfs.dist(u));
+        if(u == s) continue;
+        const unsigned int p = alg.pred_vertex(u);
+        ASSERT_TRUE(alg.reached(p));
+        ASSERT_EQ(alg.dist(p) + 1, alg.dist(u));
+        ASSERT_TRUE(std::ranges::find(out_neighbors(graph, p), u) !=
+                    std::ranges::end(out_neighbors(graph, p)));
+    }
+}
+
+GTEST_TEST(direction_optimizing_breadth_first_search, fuzzy_power_law) {
+    std::mt19937 engine{std::random_device{}()};
+    const std::size_t n = 2000;
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+    std::bernoulli_distribution coin(0.5);
+
+    for(std::size_t i = 0; i < 5; ++i) {
+        // half of the arc endpoints are drawn among the previous endpoints,
+        // which gives a heavy tailed degree distribution
+        std::vector<unsigned int> endpoints;
+        static_digraph_builder<static_digraph> builder(n);
+        for(std::size_t j = 0; j < 8 * n; ++j) {
+            unsigned int uv[2];
+            for(auto & x : uv) {
+                x = endpoints.empty() || coin(engine)
+                        ? vertex_distr(engine)
+                        : endpoints[std::uniform_int_distribution<std::size_t>(
+                              0, endpoints.size() - 1)(engine)];
+                endpoints.push_back(x);
+            }
+            builder.add_arc(uv[0], uv[1]);
+        }
+        auto [graph] = builder.build();
+
+        const unsigned int s = vertex_distr(engine);
+        check_against_breadth_first_search<do_bfs_traits>(graph, s);
+        check_against_breadth_first_search<do_bfs_bottom_up_traits>(graph, s);
+    }
+}
+
+GTEST_TEST(direction_optimizing_breadth_first_search, switches_direction) {
+    // a path to a star : the frontier only becomes large at the star
+    const unsigned int n = 1000;
+    static_digraph_builder<static_digraph> builder(n);
+    for(unsigned int u = 0; u < 9; ++u) builder.add_arc(u, u + 1);
+    for(unsigned int u = 10; u < n; ++u) builder.add_arc(9, u);
+    for(unsigned int u = 10; u + 1 < n; ++u) builder.add_arc(u, u + 1);
+    auto [graph] = builder.build();
+
+    direction_optimizing_breadth_first_search alg(do_bfs_traits{}, graph, 0u);
+    bool was_bottom_up = false;
+    while(!alg.finished()) {
+        alg.advance();
+        was_bottom_up |= alg.bottom_up();
+    }
+    ASSERT_TRUE(was_bottom_up);
+    for(unsigned int u = 10; u < n; ++u) {
+        ASSERT_EQ(alg.dist(u), 10);
+        ASSERT_EQ(alg.pred_vertex(u), 9u);
+    }
+    alg.reset().add_source(10u).run();
+    ASSERT_FALSE(alg.reached(9u));
+    ASSERT_EQ(alg.dist(n - 1), static_cast<int>(n - 11));
+}
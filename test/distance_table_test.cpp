@@ -0,0 +1,83 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "melon/algorithm/contraction_hierarchy.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/algorithm/distance_table.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+#include "melon/views/reverse.hpp"
+
+using namespace fhamonic::melon;
+
+GTEST_TEST(distance_table, test) {
+    static_digraph_builder<static_digraph, int> builder(5);
+    builder.add_arc(0, 1, 2)
+        .add_arc(1, 2, 3)
+        .add_arc(0, 2, 7)
+        .add_arc(2, 3, 1)
+        .add_arc(3, 0, 4);
+    auto [graph, length_map] = builder.build();
+
+    const std::vector<unsigned int> sources = {0, 2, 4};
+    const std::vector<unsigned int> targets = {3, 0, 3, 4};
+    auto table = many_to_many_distances(graph, length_map, sources, targets);
+
+    ASSERT_EQ(table.num_sources(), 3);
+    ASSERT_EQ(table.num_targets(), 4);
+    ASSERT_EQ(table.dist(0, 0), 6);
+    ASSERT_EQ(table.dist(0, 1), 0);
+    ASSERT_EQ(table.dist(0, 2), 6);
+    ASSERT_FALSE(table.reachable(0, 3));
+    ASSERT_EQ(table.dist(1, 0), 1);
+    ASSERT_EQ(table.dist(1, 1), 5);
+    ASSERT_EQ(table.dist(1, 2), 1);
+    ASSERT_FALSE(table.reachable(1, 3));
+    for(std::size_t j = 0; j < 3; ++j) ASSERT_FALSE(table.reachable(2, j));
+    ASSERT_EQ(table.dist(2, 3), 0);
+}
+
+GTEST_TEST(distance_table, fuzzy_same_as_dijkstra) {
+    std::mt19937 engine{std::random_device{}()};
+    const std::size_t n = 500;
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+    std::uniform_int_distribution<int> length_distr(0, 100);
+
+    static_digraph_builder<static_digraph, int> builder(n);
+    for(std::size_t i = 0; i < 3 * n; ++i)
+        builder.add_arc(vertex_distr(engine), vertex_distr(engine),
+                        length_distr(engine));
+    auto [graph, length_map] = builder.build();
+    contraction_hierarchy<int> ch(graph, length_map);
+
+    std::vector<unsigned int> sources(37);
+    std::vector<unsigned int> targets(23);
+    for(auto & s : sources) s = vertex_distr(engine);
+    for(auto & t : targets) t = vertex_distr(engine);
+
+    const auto tables = {
+        many_to_many_distances(graph, length_map, sources, targets),
+        many_to_many_distances(parallel_policy{4}, graph, length_map, sources,
+                               targets),
+        bucket_many_to_many_distances(parallel_policy{4}, graph, length_map,
+                                      views::reverse(graph), length_map,
+                                      sources, targets),
+        bucket_many_to_many_distances(
+            parallel_policy{4}, ch.upward_graph(), ch.upward_lengths_map(),
+            ch.downward_graph(), ch.downward_lengths_map(), sources,
+            targets)};
+
+    for(std::size_t i = 0; i < sources.size(); ++i) {
+        std::vector<int> dist(n, std::numeric_limits<int>::max());
+        for(auto && [u, u_dist] : dijkstra(graph, length_map, sources[i]))
+            dist[u] = u_dist;
+        for(auto && table : tables) {
+            for(std::size_t j = 0; j < targets.size(); ++j)
+                ASSERT_EQ(table.dist(i, j), dist[targets[j]]);
+        }
+    }
+}
@@ -0,0 +1,88 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/dynamic_digraph.hpp"
+#include "melon/container/mutable_digraph.hpp"
+#include "melon/graph.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic;
+using namespace fhamonic::melon;
+
+using Graph = dynamic_digraph;
+
+GTEST_TEST(dynamic_digraph, contiguous_adjacency) {
+    Graph graph;
+    auto a = create_vertex(graph);
+    auto b = create_vertex(graph);
+    auto c = create_vertex(graph);
+    auto ab = create_arc(graph, a, b);
+    auto ac = create_arc(graph, a, c);
+    auto aa = create_arc(graph, a, a);
+    static_assert(std::ranges::contiguous_range<decltype(out_arcs(graph, a))>);
+    static_assert(
+        std::ranges::contiguous_range<decltype(out_neighbors(graph, a))>);
+    ASSERT_TRUE(EQ_RANGES(out_arcs(graph, a), {ab, ac, aa}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, a), {b, c, a}));
+    ASSERT_EQ(out_degree(graph, a), 3);
+
+    remove_arc(graph, ab);
+    ASSERT_TRUE(EQ_RANGES(out_arcs(graph, a), {aa, ac}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, a), {a, c}));
+    change_arc_target(graph, ac, b);
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, a), {a, b}));
+    ASSERT_TRUE(EQ_RANGES(in_neighbors(graph, b), {a}));
+    ASSERT_TRUE(EMPTY(in_arcs(graph, c)));
+
+    remove_vertex(graph, a);
+    ASSERT_EQ(num_arcs(graph), 0);
+    ASSERT_TRUE(EMPTY(in_arcs(graph, b)));
+    ASSERT_EQ(create_vertex(graph), a);
+    ASSERT_TRUE(EMPTY(out_arcs(graph, a)));
+}
+
+GTEST_TEST(dynamic_digraph, same_dijkstra_as_mutable_digraph) {
+    Graph graph;
+    mutable_digraph linked_graph;
+    for(int i = 0; i < 6; ++i) {
+        auto u = create_vertex(graph);
+        ASSERT_EQ(create_vertex(linked_graph), u);
+    }
+    std::vector<std::pair<unsigned int, unsigned int>> pairs(
+        {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 4}, {2, 5}, {3, 4}, {3, 5}, {4, 5},
+         {5, 0}});
+    std::vector<int> lengths({4, 1, 7, 2, 5, 9, 1, 3, 1, 2});
+    for(auto && [s, t] : pairs) {
+        auto a = create_arc(graph, s, t);
+        ASSERT_EQ(create_arc(linked_graph, s, t), a);
+    }
+    auto length_map = create_arc_map<int>(graph);
+    for(auto && a : arcs(graph)) length_map[a] = lengths[a];
+
+    std::vector<std::pair<unsigned int, int>> expected;
+    for(auto && p : dijkstra(linked_graph, length_map, 0u))
+        expected.push_back(p);
+    std::vector<std::pair<unsigned int, int>> traversal;
+    for(auto && p : dijkstra(graph, length_map, 0u)) traversal.push_back(p);
+    ASSERT_TRUE(EQ_MULTISETS(traversal, expected));
+}
+
+GTEST_TEST(dynamic_digraph, index_widths) {
+    using small_digraph = basic_dynamic_digraph<std::uint16_t, std::uint16_t>;
+    static_assert(std::same_as<vertex_t<small_digraph>, std::uint16_t>);
+    static_assert(std::same_as<arc_t<small_digraph>, std::uint16_t>);
+    static_assert(melon::has_arc_removal<small_digraph>);
+
+    small_digraph graph;
+    auto a = graph.create_vertex();
+    auto b = graph.create_vertex();
+    auto ab = graph.create_arc(a, b);
+    static_assert(std::same_as<decltype(ab), std::uint16_t>);
+    ASSERT_EQ(arc_target(graph, ab), b);
+    ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, a), {b}));
+    graph.remove_arc(ab);
+    ASSERT_EQ(num_arcs(graph), 0);
+    ASSERT_EQ(create_arc_map<int>(graph).size(), 1);
+}
@@ -0,0 +1,125 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/mapped_static_digraph.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/graph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic;
+using namespace fhamonic::melon;
+
+static_assert(melon::graph<mapped_static_digraph>);
+static_assert(melon::outward_incidence_graph<mapped_static_digraph>);
+static_assert(melon::outward_adjacency_graph<mapped_static_digraph>);
+static_assert(melon::inward_incidence_graph<mapped_static_digraph>);
+static_assert(melon::inward_adjacency_graph<mapped_static_digraph>);
+static_assert(melon::has_vertex_map<mapped_static_digraph>);
+static_assert(melon::has_arc_map<mapped_static_digraph>);
+
+namespace {
+struct temporary_file {
+    std::filesystem::path path;
+    explicit temporary_file(const char * name)
+        : path(std::filesystem::temp_directory_path() / name) {}
+    ~temporary_file() { std::filesystem::remove(path); }
+};
+}  // namespace
+
+GTEST_TEST(mapped_static_digraph, empty_graph) {
+    temporary_file file("melon_mapped_static_digraph_empty.bin");
+    static_digraph graph;
+    mapped_static_digraph_writer(graph).write(file.path);
+
+    mapped_static_digraph mapped(file.path);
+    ASSERT_EQ(num_vertices(mapped), 0);
+    ASSERT_EQ(num_arcs(mapped), 0);
+    ASSERT_TRUE(EMPTY(vertices(mapped)));
+    ASSERT_TRUE(EMPTY(arcs(mapped)));
+    EXPECT_DEATH((void)out_arcs(mapped, 0), "");
+}
+
+GTEST_TEST(mapped_static_digraph, same_as_static_digraph) {
+    temporary_file file("melon_mapped_static_digraph_test.bin");
+    static_digraph_builder<static_digraph, int> builder(6);
+    builder.add_arc(0, 1, 7)
+        .add_arc(0, 2, 9)
+        .add_arc(0, 5, 14)
+        .add_arc(1, 0, 7)
+        .add_arc(1, 2, 10)
+        .add_arc(1, 3, 15)
+        .add_arc(2, 0, 9)
+        .add_arc(2, 1, 10)
+        .add_arc(2, 3, 12)
+        .add_arc(2, 5, 2)
+        .add_arc(3, 1, 15)
+        .add_arc(3, 2, 12)
+        .add_arc(3, 4, 6)
+        .add_arc(5, 0, 14)
+        .add_arc(5, 2, 2)
+        .add_arc(5, 4, 9);
+    auto [graph, length_map] = builder.build();
+    auto level_map = graph.create_vertex_map<double>();
+    for(auto && u : vertices(graph)) level_map[u] = 0.5 * u;
+
+    mapped_static_digraph_writer(graph)
+        .add_arc_map("length", length_map)
+        .add_vertex_map("level", level_map)
+        .write(file.path);
+
+    mapped_static_digraph mapped(file.path);
+    ASSERT_EQ(num_vertices(mapped), num_vertices(graph));
+    ASSERT_EQ(num_arcs(mapped), num_arcs(graph));
+    ASSERT_TRUE(EMPTY(out_arcs(mapped, 4)));
+    for(auto && u : vertices(graph)) {
+        ASSERT_TRUE(EQ_RANGES(out_arcs(mapped, u), out_arcs(graph, u)));
+        ASSERT_TRUE(EQ_RANGES(in_arcs(mapped, u), in_arcs(graph, u)));
+        ASSERT_TRUE(
+            EQ_RANGES(out_neighbors(mapped, u), out_neighbors(graph, u)));
+        ASSERT_TRUE(EQ_RANGES(in_neighbors(mapped, u), in_neighbors(graph, u)));
+    }
+    for(auto && a : arcs(graph)) {
+        ASSERT_EQ(arc_source(mapped, a), arc_source(graph, a));
+        ASSERT_EQ(arc_target(mapped, a), arc_target(graph, a));
+    }
+
+    auto mapped_length = mapped.arc_map<int>("length");
+    ASSERT_TRUE(EQ_RANGES(mapped_length, length_map));
+    auto mapped_level = mapped.vertex_map<double>("level");
+    for(auto && u : vertices(graph)) ASSERT_EQ(mapped_level[u], level_map[u]);
+
+    EXPECT_THROW((void)mapped.arc_map<int>("level"), std::out_of_range);
+    EXPECT_THROW((void)mapped.arc_map<double>("length"), std::invalid_argument);
+
+    dijkstra alg(graph, length_map, 0u);
+    dijkstra mapped_alg(mapped, mapped_length, 0u);
+    ASSERT_TRUE(EQ_RANGES(alg, mapped_alg));
+
+    mapped_static_digraph moved(std::move(mapped));
+    ASSERT_EQ(num_arcs(moved), num_arcs(graph));
+}
+
+GTEST_TEST(mapped_static_digraph, invalid_files) {
+    temporary_file file("melon_mapped_static_digraph_invalid.bin");
+    EXPECT_THROW(mapped_static_digraph{file.path}, std::runtime_error);
+    {
+        std::ofstream out(file.path, std::ios::binary);
+        out << "not a graph file, not a graph file, not a graph file, not a "
+               "graph file, not a graph file";
+    }
+    EXPECT_THROW(mapped_static_digraph{file.path}, std::runtime_error);
+
+    static_digraph_builder<static_digraph> builder(3);
+    builder.add_arc(0, 1).add_arc(1, 2);
+    auto [graph] = builder.build();
+    mapped_static_digraph_writer(graph).write(file.path);
+    std::filesystem::resize_file(file.path, 100);
+    EXPECT_THROW(mapped_static_digraph{file.path}, std::runtime_error);
+}
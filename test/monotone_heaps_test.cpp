@@ -0,0 +1,123 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include "melon/container/bucket_queue.hpp"
+#include "melon/container/d_ary_heap.hpp"
+#include "melon/container/radix_heap.hpp"
+#include "melon/utility/priority_queue.hpp"
+
+using namespace fhamonic::melon;
+
+// Tests shared by the monotone integer priority queues, instantiated with
+// entries (id, priority) and an array of indices.
+template <typename Traits>
+class monotone_heaps : public testing::Test {};
+
+struct radix_heap_traits {
+    template <typename E, std::size_t N>
+    using heap = radix_heap<E, std::less<typename E::second_type>,
+                            std::array<std::size_t, N>, views::get_map<1>,
+                            views::get_map<0>>;
+};
+struct bucket_queue_traits {
+    template <typename E, std::size_t N>
+    using heap = bucket_queue<E, std::less<typename E::second_type>,
+                              std::array<std::size_t, N>, views::get_map<1>,
+                              views::get_map<0>>;
+};
+using monotone_heap_types =
+    testing::Types<radix_heap_traits, bucket_queue_traits>;
+TYPED_TEST_SUITE(monotone_heaps, monotone_heap_types);
+
+TYPED_TEST(monotone_heaps, push_promote_pop_test) {
+    std::vector<int> datas = {10, 7, 3, 5, 300, 11};
+    constexpr std::size_t nb_elements = 6;
+    typename TypeParam::template heap<std::pair<unsigned int, int>,
+                                      nb_elements>
+        heap;
+
+    static_assert(updatable_priority_queue<decltype(heap)>);
+
+    for(unsigned int i = 0; i < nb_elements; ++i) {
+        heap.push(std::make_pair(i, datas[i]));
+    }
+    ASSERT_EQ(heap.size(), nb_elements);
+    ASSERT_TRUE(heap.contains(4u));
+    heap.promote(4u, 4);
+    ASSERT_EQ(heap.priority(4u), 4);
+
+    ASSERT_EQ(heap.top(), std::make_pair(2u, 3));
+    heap.pop();
+    ASSERT_FALSE(heap.contains(2u));
+    ASSERT_EQ(heap.top(), std::make_pair(4u, 4));
+    heap.pop();
+    heap.demote(3u, 8);
+    ASSERT_EQ(heap.top(), std::make_pair(1u, 7));
+    heap.pop();
+    heap.promote(0u, 7);
+    ASSERT_EQ(heap.top(), std::make_pair(0u, 7));
+    heap.pop();
+    ASSERT_EQ(heap.top(), std::make_pair(3u, 8));
+    heap.pop();
+    ASSERT_EQ(heap.top(), std::make_pair(5u, 11));
+    heap.pop();
+    ASSERT_TRUE(heap.empty());
+}
+
+TYPED_TEST(monotone_heaps, fuzzy_same_as_d_ary_heap) {
+    std::mt19937 engine{std::random_device{}()};
+    constexpr std::size_t nb_elements = 500;
+    using entry = std::pair<unsigned int, unsigned int>;
+    typename TypeParam::template heap<entry, nb_elements> heap;
+    updatable_d_ary_heap<2, entry, std::less<unsigned int>,
+                         std::array<std::size_t, nb_elements>,
+                         views::get_map<1>, views::get_map<0>>
+        reference_heap;
+    std::vector<bool> pushed(nb_elements, false);
+    std::uniform_int_distribution<unsigned int> id_distr(0, nb_elements - 1);
+    std::uniform_int_distribution<unsigned int> delta_distr(0, 1000);
+
+    unsigned int last_min = 0;
+    for(std::size_t i = 0; i < 20 * nb_elements; ++i) {
+        const unsigned int id = id_distr(engine);
+        const unsigned int p = last_min + delta_distr(engine);
+        if(!pushed[id]) {
+            heap.push(std::make_pair(id, p));
+            reference_heap.push(std::make_pair(id, p));
+            pushed[id] = true;
+        } else if(reference_heap.contains(id)) {
+            ASSERT_TRUE(heap.contains(id));
+            ASSERT_EQ(heap.priority(id), reference_heap.priority(id));
+            if(p < reference_heap.priority(id)) {
+                heap.promote(id, p);
+                reference_heap.promote(id, p);
+            } else if(reference_heap.priority(id) < p) {
+                heap.demote(id, p);
+                reference_heap.demote(id, p);
+            }
+        } else {
+            ASSERT_FALSE(heap.contains(id));
+        }
+        ASSERT_EQ(heap.size(), reference_heap.size());
+        if(i % 3 == 0 && !reference_heap.empty()) {
+            ASSERT_EQ(heap.top().second, reference_heap.top().second);
+            last_min = reference_heap.top().second;
+            const unsigned int top_id = heap.top().first;
+            heap.pop();
+            reference_heap.promote(top_id, 0);
+            reference_heap.pop();
+        }
+    }
+    while(!reference_heap.empty()) {
+        ASSERT_EQ(heap.top().second, reference_heap.top().second);
+        const unsigned int top_id = heap.top().first;
+        heap.pop();
+        reference_heap.promote(top_id, 0);
+        reference_heap.pop();
+    }
+    ASSERT_TRUE(heap.empty());
+}
@@ -0,0 +1,103 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/multi_source_breadth_first_search.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+using namespace fhamonic::melon;
+
+struct bfs_distances_traits : public breadth_first_search_default_traits {
+    static constexpr bool store_distances = true;
+};
+
+struct ms_bfs_traits
+    : public multi_source_breadth_first_search_default_traits {
+    static constexpr bool store_distances = true;
+};
+
+struct ms_bfs_wide_traits
+    : public multi_source_breadth_first_search_wide_traits {
+    static constexpr bool store_distances = true;
+};
+
+GTEST_TEST(multi_source_breadth_first_search, test) {
+    static_digraph_builder<static_digraph> builder(6);
+    builder.add_arc(0, 1)
+        .add_arc(1, 2)
+        .add_arc(2, 3)
+        .add_arc(3, 0)
+        .add_arc(4, 3);
+    auto [graph] = builder.build();
+
+    multi_source_breadth_first_search alg(ms_bfs_traits{}, graph,
+                                          std::vector<unsigned int>{0, 4, 0});
+    static_assert(std::copyable<decltype(alg)>);
+    ASSERT_EQ(alg.num_sources(), 3);
+
+    std::vector<std::vector<int>> dist(3, std::vector<int>(6, -1));
+    alg.run([&dist](const std::size_t i, const unsigned int u, const int d) {
+        ASSERT_EQ(dist[i][u], -1);
+        dist[i][u] = d;
+    });
+    const std::vector<std::vector<int>> expected_dist = {
+        {0, 1, 2, 3, -1, -1}, {2, 3, 4, 1, 0, -1}, {0, 1, 2, 3, -1, -1}};
+    ASSERT_EQ(dist, expected_dist);
+    for(std::size_t i = 0; i < 3; ++i) {
+        for(unsigned int u = 0; u < 6; ++u) {
+            ASSERT_EQ(alg.reached(i, u), expected_dist[i][u] >= 0);
+            if(!alg.reached(i, u)) continue;
+            ASSERT_EQ(alg.dist(i, u), dist[i][u]);
+        }
+    }
+
+    alg.reset().add_source(5u).run();
+    ASSERT_EQ(alg.num_sources(), 1);
+    ASSERT_TRUE(alg.reached(0, 5u));
+    for(unsigned int u = 0; u < 5; ++u) ASSERT_FALSE(alg.reached(0, u));
+}
+
+template <typename _Traits>
+void check_against_breadth_first_search(const static_digraph & graph) {
+    using ms_bfs = multi_source_breadth_first_search<const static_digraph &,
+                                                     _Traits>;
+    std::mt19937 engine{std::random_device{}()};
+    std::uniform_int_distribution<unsigned int> vertex_distr(
+        0, static_cast<unsigned int>(graph.num_vertices() - 1));
+    std::vector<unsigned int> sources(ms_bfs::batch_size);
+    for(auto & s : sources) s = vertex_distr(engine);
+
+    multi_source_breadth_first_search alg(_Traits{}, graph, sources);
+    std::size_t num_visits = 0;
+    alg.run([&num_visits](std::size_t, unsigned int, int) { ++num_visits; });
+
+    std::size_t num_reached = 0;
+    for(std::size_t i = 0; i < sources.size(); ++i) {
+        breadth_first_search bfs(bfs_distances_traits{}, graph, sources[i]);
+        bfs.run();
+        for(auto && u : vertices(graph)) {
+            ASSERT_EQ(alg.reached(i, u), bfs.reached(u));
+            if(!bfs.reached(u)) continue;
+            ASSERT_EQ(alg.dist(i, u), bfs.dist(u));
+            ++num_reached;
+        }
+    }
+    ASSERT_EQ(num_visits, num_reached);
+}
+
+GTEST_TEST(multi_source_breadth_first_search, fuzzy) {
+    const std::size_t n = 2000;
+    std::mt19937 engine{std::random_device{}()};
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+    static_digraph_builder<static_digraph> builder(n);
+    for(std::size_t i = 0; i < 2 * n; ++i)
+        builder.add_arc(vertex_distr(engine), vertex_distr(engine));
+    auto [graph] = builder.build();
+
+    check_against_breadth_first_search<ms_bfs_traits>(graph);
+    check_against_breadth_first_search<ms_bfs_wide_traits>(graph);
+}
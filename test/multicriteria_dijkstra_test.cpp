@@ -0,0 +1,126 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include "melon/algorithm/multicriteria_dijkstra.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic::melon;
+
+using time_toll = std::array<int, 2>;
+
+template <typename R>
+static std::vector<time_toll> sorted_front(R && r) {
+    std::vector<time_toll> front;
+    for(auto && l : r) front.push_back(l);
+    std::ranges::sort(front);
+    return front;
+}
+
+GTEST_TEST(multicriteria_dijkstra, test) {
+    static_digraph_builder<static_digraph, time_toll> builder(5);
+    builder.add_arc(0, 1, {1, 10})
+        .add_arc(0, 2, {4, 1})
+        .add_arc(1, 3, {1, 10})
+        .add_arc(2, 3, {4, 1})
+        .add_arc(1, 2, {1, 1})
+        .add_arc(3, 4, {1, 1})
+        .add_arc(2, 4, {10, 10});
+    auto [graph, length_map] = builder.build();
+
+    multicriteria_dijkstra alg(graph, length_map, 0u);
+    static_assert(std::copyable<decltype(alg)>);
+
+    ASSERT_EQ(alg.current(), std::make_pair(0u, time_toll{0, 0}));
+    alg.run();
+    ASSERT_TRUE(alg.reached(4u));
+    ASSERT_EQ(sorted_front(alg.pareto_front(3u)),
+              (std::vector<time_toll>{{2, 20}, {6, 12}, {8, 2}}));
+    ASSERT_EQ(sorted_front(alg.pareto_front(4u)),
+              (std::vector<time_toll>{{3, 21}, {7, 13}, {9, 3}}));
+
+    std::size_t i = 0;
+    for(auto && l : alg.pareto_front(4u)) {
+        time_toll path_length{0, 0};
+        for(auto && a : alg.path_to(4u, i))
+            path_length = pareto_shortest_path_semiring<time_toll>::plus(
+                path_length, length_map[a]);
+        ASSERT_EQ(path_length, l);
+        ++i;
+    }
+    ASSERT_EQ(i, alg.pareto_front_size(4u));
+
+    alg.reset().set_target(3u).add_source(0u).run();
+    ASSERT_EQ(sorted_front(alg.pareto_front(3u)),
+              (std::vector<time_toll>{{2, 20}, {6, 12}, {8, 2}}));
+    ASSERT_EQ(alg.pareto_front_size(4u), 0);
+}
+
+GTEST_TEST(multicriteria_dijkstra, fuzzy_pareto_fronts) {
+    using semiring = pareto_shortest_path_semiring<time_toll>;
+    std::mt19937 engine{std::random_device{}()};
+    const std::size_t n = 60;
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+    std::uniform_int_distribution<int> length_distr(0, 20);
+
+    static_digraph_builder<static_digraph, time_toll> builder(n);
+    for(std::size_t i = 0; i < 3 * n; ++i)
+        builder.add_arc(vertex_distr(engine), vertex_distr(engine),
+                        {length_distr(engine), length_distr(engine)});
+    auto [graph, length_map] = builder.build();
+
+    multicriteria_dijkstra alg(graph, length_map);
+    for(std::size_t i = 0; i < 5; ++i) {
+        const unsigned int s = vertex_distr(engine);
+        // label-correcting fixpoint on the Pareto fronts
+        std::vector<std::vector<time_toll>> fronts(n);
+        fronts[s].push_back(semiring::zero);
+        for(bool changed = true; changed;) {
+            changed = false;
+            for(auto && a : arcs(graph)) {
+                const unsigned int u = arc_source(graph, a);
+                const unsigned int w = arc_target(graph, a);
+                for(std::size_t j = 0; j < fronts[u].size(); ++j) {
+                    const time_toll l =
+                        semiring::plus(fronts[u][j], length_map[a]);
+                    if(std::ranges::any_of(fronts[w], [&l](auto && e) {
+                           return semiring::dominates(e, l);
+                       }))
+                        continue;
+                    std::erase_if(fronts[w], [&l](auto && e) {
+                        return semiring::dominates(l, e);
+                    });
+                    fronts[w].push_back(l);
+                    changed = true;
+                }
+            }
+        }
+
+        alg.reset().unset_target().add_source(s);
+        std::size_t num_labels = 0;
+        time_toll prev_length = semiring::zero;
+        for(auto && [u, u_length] : alg) {
+            ASSERT_FALSE(semiring::less(u_length, prev_length));
+            prev_length = u_length;
+            ++num_labels;
+        }
+        std::size_t num_expected_labels = 0;
+        for(auto && u : vertices(graph)) {
+            std::ranges::sort(fronts[u]);
+            ASSERT_EQ(sorted_front(alg.pareto_front(u)), fronts[u]);
+            num_expected_labels += fronts[u].size();
+        }
+        ASSERT_EQ(num_labels, num_expected_labels);
+
+        const unsigned int t = vertex_distr(engine);
+        alg.reset().set_target(t).add_source(s).run();
+        ASSERT_EQ(sorted_front(alg.pareto_front(t)), fronts[t]);
+    }
+}
@@ -1,6 +1,9 @@
 #undef NDEBUG
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "melon/container/mutable_digraph.hpp"
 #include "melon/graph.hpp"
 
@@ -11,212 +14,186 @@
 using namespace fhamonic;
 using namespace fhamonic::melon;
 
-static_assert(melon::graph<mutable_digraph>);
-static_assert(melon::outward_incidence_graph<mutable_digraph>);
-static_assert(melon::outward_adjacency_graph<mutable_digraph>);
-static_assert(melon::has_vertex_map<mutable_digraph>);
-static_assert(melon::has_vertex_creation<mutable_digraph>);
-static_assert(melon::has_vertex_removal<mutable_digraph>);
-static_assert(melon::has_arc_creation<mutable_digraph>);
-static_assert(melon::has_arc_removal<mutable_digraph>);
-static_assert(melon::has_change_arc_source<mutable_digraph>);
-static_assert(melon::has_change_arc_target<mutable_digraph>);
-
 using Graph = mutable_digraph;
-using arc_entries_list = std::initializer_list<
-    std::pair<arc_t<Graph>, std::pair<vertex_t<Graph>, vertex_t<Graph>>>>;
-
-GTEST_TEST(mutable_digraph, empty_constructor) {
-    Graph graph;
-    ASSERT_TRUE(EMPTY(vertices(graph)));
-    ASSERT_TRUE(EMPTY(arcs(graph)));
-    ASSERT_TRUE(EMPTY(arcs_entries(graph)));
-
-    ASSERT_FALSE(is_valid_vertex(graph, 0));
-    EXPECT_DEATH((void)out_arcs(graph, 0), "");
-    EXPECT_DEATH((void)in_arcs(graph, 0), "");
-    EXPECT_DEATH((void)out_neighbors(graph, 0), "");
-    EXPECT_DEATH((void)in_neighbors(graph, 0), "");
-}
 
-GTEST_TEST(mutable_digraph, create_vertices) {
+GTEST_TEST(mutable_digraph, batch_create_and_remove_arcs) {
     Graph graph;
-
     auto a = create_vertex(graph);
     auto b = create_vertex(graph);
     auto c = create_vertex(graph);
+    std::vector<std::pair<unsigned int, unsigned int>> pairs(
+        {{a, b}, {a, c}, {c, b}, {c, a}, {b, a}});
+    auto new_arcs = graph.create_arcs(pairs);
+    ASSERT_EQ(new_arcs.size(), 5);
+    ASSERT_EQ(num_arcs(graph), 5);
+    for(std::size_t i = 0; i < pairs.size(); ++i) {
+        ASSERT_EQ(arc_source(graph, new_arcs[i]), pairs[i].first);
+        ASSERT_EQ(arc_target(graph, new_arcs[i]), pairs[i].second);
+    }
 
-    ASSERT_TRUE(EQ_MULTISETS(vertices(graph), {a, b, c}));
-    ASSERT_TRUE(EMPTY(arcs(graph)));
-    ASSERT_TRUE(EMPTY(out_arcs(graph, 0)));
-    ASSERT_TRUE(EMPTY(out_arcs(graph, 1)));
-    ASSERT_TRUE(EMPTY(out_arcs(graph, 2)));
-    ASSERT_TRUE(is_valid_vertex(graph, 2));
-    ASSERT_FALSE(is_valid_vertex(graph, 3));
-    EXPECT_DEATH((void)out_arcs(graph, 3), "");
+    graph.remove_arcs(std::vector<unsigned int>({new_arcs[1], new_arcs[3]}));
+    ASSERT_EQ(num_arcs(graph), 3);
+    ASSERT_FALSE(is_valid_arc(graph, new_arcs[1]));
+    ASSERT_FALSE(is_valid_arc(graph, new_arcs[3]));
+    ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, a), {b}));
+    ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, c), {b}));
+    ASSERT_TRUE(EQ_MULTISETS(in_neighbors(graph, a), {b}));
+    ASSERT_TRUE(EMPTY(in_neighbors(graph, c)));
+
+    // the freed ids are reused
+    auto reused_arcs = graph.create_arcs(
+        std::vector<std::pair<unsigned int, unsigned int>>({{b, c}, {b, b}}));
+    ASSERT_TRUE(EQ_MULTISETS(reused_arcs, {new_arcs[1], new_arcs[3]}));
+    ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, b), {a, b, c}));
 }
 
-GTEST_TEST(mutable_digraph, create_arcs) {
+GTEST_TEST(mutable_digraph, remove_few_arcs_of_high_degree_vertex) {
     Graph graph;
-
-    auto a = create_vertex(graph);
-    auto b = create_vertex(graph);
-    auto c = create_vertex(graph);
-
-    auto ab = create_arc(graph, a, b);
-    auto ac = create_arc(graph, a, c);
-    auto cb = create_arc(graph, c, b);
-    auto ca = create_arc(graph, c, a);
-
-    ASSERT_TRUE(EQ_MULTISETS(vertices(graph), {a, b, c}));
-    ASSERT_TRUE(EQ_MULTISETS(arcs(graph), {ab, ac, cb, ca}));
-
-    ASSERT_EQ(arc_source(graph, ab), a);
-    ASSERT_EQ(arc_source(graph, ac), a);
-    ASSERT_EQ(arc_source(graph, cb), c);
-    ASSERT_EQ(arc_target(graph, ab), b);
-    ASSERT_EQ(arc_target(graph, ac), c);
-    ASSERT_EQ(arc_target(graph, cb), b);
-
-    ASSERT_TRUE(EQ_MULTISETS(
-        arcs_entries(graph),
-        arc_entries_list{
-            {ab, {a, b}}, {ac, {a, c}}, {cb, {c, b}}, {ca, {c, a}}}));
-
-    ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, a), {b, c}));
-    ASSERT_TRUE(EMPTY(out_neighbors(graph, b)));
-    ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, c), {a, b}));
+    const unsigned int hub = create_vertex(graph);
+    std::vector<std::pair<unsigned int, unsigned int>> pairs;
+    for(unsigned int i = 0; i < 1000; ++i) {
+        const unsigned int u = create_vertex(graph);
+        pairs.emplace_back(hub, u);
+        pairs.emplace_back(u, hub);
+    }
+    auto new_arcs = graph.create_arcs(pairs);
+    std::vector<unsigned int> out_before;
+    for(auto && a : out_arcs(graph, hub)) out_before.push_back(a);
+
+    // the removed out arcs of the hub are adjacent in its out arcs list
+    const std::vector<unsigned int> removed = {
+        new_arcs[0], new_arcs[2], new_arcs[1], new_arcs[1998], new_arcs[999]};
+    graph.remove_arcs(removed);
+    ASSERT_EQ(num_arcs(graph), 1995);
+    for(auto && a : removed) ASSERT_FALSE(is_valid_arc(graph, a));
+
+    std::vector<unsigned int> out_after;
+    for(auto && a : out_before)
+        if(std::ranges::find(removed, a) == removed.end())
+            out_after.push_back(a);
+    ASSERT_TRUE(EQ_RANGES(out_arcs(graph, hub), out_after));
+    ASSERT_EQ(std::ranges::distance(in_arcs(graph, hub)), 998);
+    for(auto && a : in_arcs(graph, hub)) ASSERT_EQ(arc_target(graph, a), hub);
+    ASSERT_TRUE(EMPTY(in_arcs(graph, pairs[0].second)));
+    ASSERT_TRUE(EMPTY(out_arcs(graph, pairs[1].first)));
+    ASSERT_TRUE(EQ_RANGES(out_arcs(graph, pairs[3].first), {new_arcs[3]}));
 }
 
-GTEST_TEST(mutable_digraph, remove_arcs) {
+GTEST_TEST(mutable_digraph, compact) {
     Graph graph;
-    auto a = create_vertex(graph);
-    auto b = create_vertex(graph);
-    auto c = create_vertex(graph);
-    auto ab = create_arc(graph, a, b);
-    auto ac = create_arc(graph, a, c);
-    auto cb = create_arc(graph, c, b);
-
-    remove_arc(graph, ac);
+    std::vector<unsigned int> vs;
+    for(int i = 0; i < 6; ++i) vs.push_back(create_vertex(graph));
+    auto arcs_ids = graph.create_arcs(
+        std::vector<std::pair<unsigned int, unsigned int>>(
+            {{vs[0], vs[1]}, {vs[2], vs[3]}, {vs[0], vs[2]}, {vs[3], vs[4]},
+             {vs[5], vs[0]}, {vs[0], vs[5]}, {vs[4], vs[4]}, {vs[2], vs[1]}}));
+    graph.remove_arcs(std::vector<unsigned int>({arcs_ids[1], arcs_ids[6]}));
+    remove_vertex(graph, vs[3]);
+
+    auto length_map = create_arc_map<int>(graph);
+    for(auto && a : arcs(graph))
+        length_map[a] = static_cast<int>(10 * arc_source(graph, a) +
+                                         arc_target(graph, a));
+    std::vector<std::vector<unsigned int>> out_lists(6), in_lists(6);
+    for(auto && u : vertices(graph)) {
+        for(auto && w : out_neighbors(graph, u)) out_lists[u].push_back(w);
+        for(auto && w : in_neighbors(graph, u)) in_lists[u].push_back(w);
+    }
 
-    ASSERT_FALSE(is_valid_arc(graph, ac));
-    ASSERT_EQ(arc_source(graph, ab), a);
-    EXPECT_DEATH((void)arc_source(graph, ac), "");
-    ASSERT_EQ(arc_source(graph, cb), c);
-    ASSERT_EQ(arc_target(graph, ab), b);
-    EXPECT_DEATH((void)arc_target(graph, ac), "");
-    ASSERT_EQ(arc_target(graph, cb), b);
+    auto new_length_map = create_arc_map<int>(graph);
+    std::size_t num_moved = 0;
+    graph.compact([&](const unsigned int old_a, const unsigned int new_a) {
+        new_length_map[new_a] = length_map[old_a];
+        ++num_moved;
+    });
+    ASSERT_EQ(num_moved, num_arcs(graph));
+    ASSERT_EQ(create_arc_map<int>(graph).size(), num_arcs(graph));
+    ASSERT_TRUE(EQ_MULTISETS(arcs(graph), std::views::iota(
+                                              0u, static_cast<unsigned int>(
+                                                      num_arcs(graph)))));
+
+    unsigned int expected_arc = 0;
+    for(unsigned int u = 0; u < 6; ++u) {
+        if(!is_valid_vertex(graph, u)) continue;
+        ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, u), out_lists[u]));
+        ASSERT_TRUE(EQ_RANGES(in_neighbors(graph, u), in_lists[u]));
+        for(auto && a : out_arcs(graph, u)) {
+            ASSERT_EQ(a, expected_arc++);
+            ASSERT_EQ(new_length_map[a],
+                      static_cast<int>(10 * arc_source(graph, a) +
+                                       arc_target(graph, a)));
+        }
+    }
 
-    ASSERT_TRUE(EQ_MULTISETS(arcs_entries(graph),
-                             arc_entries_list{{cb, {c, b}}, {ab, {a, b}}}));
+    auto a = graph.create_arc(vs[1], vs[2]);
+    ASSERT_EQ(a, num_arcs(graph) - 1);
+    graph.compact();
+    ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, vs[1]), {vs[2]}));
+}
 
+GTEST_TEST(mutable_digraph, index_widths) {
+    using small_digraph = basic_mutable_digraph<std::uint16_t, std::uint16_t>;
+    static_assert(std::same_as<vertex_t<small_digraph>, std::uint16_t>);
+    static_assert(std::same_as<arc_t<small_digraph>, std::uint16_t>);
+    static_assert(melon::has_arc_removal<small_digraph>);
+
+    small_digraph graph;
+    auto a = graph.create_vertex();
+    auto b = graph.create_vertex();
+    auto ab = graph.create_arc(a, b);
+    static_assert(std::same_as<decltype(ab), std::uint16_t>);
+    ASSERT_EQ(arc_target(graph, ab), b);
     ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, a), {b}));
-    ASSERT_TRUE(EMPTY(out_neighbors(graph, b)));
-    ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, c), {b}));
+    graph.remove_arc(ab);
+    ASSERT_EQ(num_arcs(graph), 0);
+    ASSERT_EQ(create_arc_map<int>(graph).size(), 1);
 }
 
-GTEST_TEST(mutable_digraph, fuzzy_test) {
-    enum Operation {
-        CREATE_VERTEX,
-        REMOVE_VERTEX,
-        CREATE_ARC,
-        REMOVE_ARC,
-        CHANGE_SOURCE,
-        CHANGE_TARGET
-    };
-    std::vector<Operation> operations = {
-        CREATE_VERTEX, CREATE_VERTEX, REMOVE_VERTEX, CREATE_ARC,   CREATE_ARC,
-        CREATE_ARC,    REMOVE_ARC,    CHANGE_SOURCE, CHANGE_TARGET};
-
+GTEST_TEST(mutable_digraph, batch_fuzzy_test) {
     for(std::size_t j = 0; j < 10; ++j) {
         mutable_digraph graph;
         dumb_digraph dummy_graph;
-        
-        for(std::size_t i = 0; i < 200; ++i) {
-            Operation op;
-            for(;;) {
-                op = random_element(operations);
-                auto num_vertices =
-                    std::ranges::distance(dummy_graph.vertices());
-                auto num_arcs = std::ranges::distance(dummy_graph.arcs());
-                if(op == REMOVE_VERTEX && num_vertices == 0) continue;
-                if(op == CREATE_ARC && num_vertices < 2) continue;
-                if(op == REMOVE_ARC && num_arcs == 0) continue;
-                if((op == CHANGE_SOURCE || op == CHANGE_TARGET) &&
-                   (num_arcs == 0 || num_vertices < 2))
-                    continue;
-                break;
-            }
-
-            if(op == CREATE_VERTEX) {
-                auto u = create_vertex(graph);
-                // std::cout << "create_vertex() -> " << u << std::endl;
-                dummy_graph.create_vertex(u);
-            }
-            if(op == REMOVE_VERTEX) {
-                auto u = random_element(dummy_graph.vertices());
-                // std::cout << "remove_vertex(" << u << ")" << std::endl;
-                remove_vertex(graph, u);
-                dummy_graph.remove_vertex(u);
-            }
-            if(op == CREATE_ARC) {
-                auto s = random_element(dummy_graph.vertices());
-                auto t = random_element(dummy_graph.vertices());
-                auto a = create_arc(graph, s, t);
-                dummy_graph.create_arc(a, s, t);
-                // std::cout << "create_arc(" << s << ", " << t << ") -> " << a
-                //           << std::endl;
-            }
-            if(op == REMOVE_ARC) {
-                auto a = random_element(dummy_graph.arcs());
-                // std::cout << "remove_arc(" << a << ")" << std::endl;
-                remove_arc(graph, a);
-                dummy_graph.remove_arc(a);
-            }
-            if(op == CHANGE_SOURCE) {
-                auto a = random_element(dummy_graph.arcs());
-                auto s = random_element(dummy_graph.vertices());
-                // std::cout << "change_arc_source(" << a << ", " << s << ")" <<
-                // std::endl;
-                change_arc_source(graph, a, s);
-                dummy_graph.change_arc_source(a, s);
-            }
-            if(op == CHANGE_TARGET) {
-                auto a = random_element(dummy_graph.arcs());
-                auto t = random_element(dummy_graph.vertices());
-                // std::cout << "change_arc_target(" << a << ", " << t << ")" <<
-                // std::endl;
-                change_arc_target(graph, a, t);
-                dummy_graph.change_arc_target(a, t);
+        for(std::size_t i = 0; i < 8; ++i) {
+            auto u = create_vertex(graph);
+            dummy_graph.create_vertex(u);
+        }
+        for(std::size_t i = 0; i < 30; ++i) {
+            std::vector<std::pair<unsigned int, unsigned int>> pairs;
+            for(std::size_t k = 0; k < 6; ++k)
+                pairs.emplace_back(random_element(dummy_graph.vertices()),
+                                   random_element(dummy_graph.vertices()));
+            auto new_arcs = graph.create_arcs(pairs);
+            for(std::size_t k = 0; k < pairs.size(); ++k)
+                dummy_graph.create_arc(new_arcs[k], pairs[k].first,
+                                       pairs[k].second);
+
+            std::vector<unsigned int> removed;
+            for(auto && a : dummy_graph.arcs())
+                if(random_element(std::vector<bool>({true, false})))
+                    removed.push_back(a);
+            graph.remove_arcs(removed);
+            for(auto && a : removed) dummy_graph.remove_arc(a);
+
+            if(i % 5 == 4) {
+                dumb_digraph compacted;
+                for(auto && u : dummy_graph.vertices())
+                    compacted.create_vertex(u);
+                graph.compact([&](const unsigned int old_a,
+                                  const unsigned int new_a) {
+                    compacted.create_arc(new_a, dummy_graph.arc_source(old_a),
+                                         dummy_graph.arc_target(old_a));
+                });
+                dummy_graph = compacted;
             }
 
-            ASSERT_TRUE(EQ_MULTISETS(vertices(graph), dummy_graph.vertices()));
-            ASSERT_TRUE(EQ_MULTISETS(arcs(graph), dummy_graph.arcs()));
-            ASSERT_EQ(num_vertices(graph), dummy_graph.num_vertices());
             ASSERT_EQ(num_arcs(graph), dummy_graph.num_arcs());
             ASSERT_TRUE(
                 EQ_MULTISETS(arcs_entries(graph), dummy_graph.arcs_entries()));
-
-            // std::cout << "v=";
             for(auto && v : vertices(graph)) {
-                // std::cout << v << ",";
-                ASSERT_TRUE(is_valid_vertex(graph, v));
-                ASSERT_TRUE(dummy_graph.is_valid_vertex(v));
                 ASSERT_TRUE(
                     EQ_MULTISETS(in_arcs(graph, v), dummy_graph.in_arcs(v)));
                 ASSERT_TRUE(
                     EQ_MULTISETS(out_arcs(graph, v), dummy_graph.out_arcs(v)));
-                ASSERT_TRUE(EQ_MULTISETS(in_neighbors(graph, v),
-                                         dummy_graph.in_neighbors(v)));
-                ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, v),
-                                         dummy_graph.out_neighbors(v)));
-            }
-            // std::cout << std::endl;
-            for(auto && a : arcs(graph)) {
-                ASSERT_TRUE(is_valid_arc(graph, a));
-                ASSERT_TRUE(dummy_graph.is_valid_arc(a));
-                ASSERT_EQ(arc_target(graph, a), dummy_graph.arc_target(a));
-                ASSERT_EQ(arc_source(graph, a), dummy_graph.arc_source(a));
             }
         }
     }
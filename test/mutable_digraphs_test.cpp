@@ -0,0 +1,224 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include "melon/container/dynamic_digraph.hpp"
+#include "melon/container/mutable_digraph.hpp"
+#include "melon/graph.hpp"
+
+#include "dumb_digraph.hpp"
+#include "random_ranges_helper.hpp"
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic;
+using namespace fhamonic::melon;
+
+// Tests shared by the digraphs supporting vertex and arc creation and removal.
+template <typename Graph>
+class mutable_digraphs : public testing::Test {
+    static_assert(melon::graph<Graph>);
+    static_assert(melon::outward_incidence_graph<Graph>);
+    static_assert(melon::outward_adjacency_graph<Graph>);
+    static_assert(melon::has_vertex_map<Graph>);
+    static_assert(melon::has_vertex_creation<Graph>);
+    static_assert(melon::has_vertex_removal<Graph>);
+    static_assert(melon::has_arc_creation<Graph>);
+    static_assert(melon::has_arc_removal<Graph>);
+    static_assert(melon::has_change_arc_source<Graph>);
+    static_assert(melon::has_change_arc_target<Graph>);
+};
+using mutable_digraph_types = testing::Types<mutable_digraph, dynamic_digraph>;
+TYPED_TEST_SUITE(mutable_digraphs, mutable_digraph_types);
+
+template <typename Graph>
+using arc_entries_list = std::initializer_list<
+    std::pair<arc_t<Graph>, std::pair<vertex_t<Graph>, vertex_t<Graph>>>>;
+
+TYPED_TEST(mutable_digraphs, empty_constructor) {
+    using Graph = TypeParam;
+    Graph graph;
+    ASSERT_TRUE(EMPTY(vertices(graph)));
+    ASSERT_TRUE(EMPTY(arcs(graph)));
+    ASSERT_TRUE(EMPTY(arcs_entries(graph)));
+
+    ASSERT_FALSE(is_valid_vertex(graph, 0));
+    EXPECT_DEATH((void)out_arcs(graph, 0), "");
+    EXPECT_DEATH((void)in_arcs(graph, 0), "");
+    EXPECT_DEATH((void)out_neighbors(graph, 0), "");
+    EXPECT_DEATH((void)in_neighbors(graph, 0), "");
+}
+
+TYPED_TEST(mutable_digraphs, create_vertices) {
+    using Graph = TypeParam;
+    Graph graph;
+
+    auto a = create_vertex(graph);
+    auto b = create_vertex(graph);
+    auto c = create_vertex(graph);
+
+    ASSERT_TRUE(EQ_MULTISETS(vertices(graph), {a, b, c}));
+    ASSERT_TRUE(EMPTY(arcs(graph)));
+    ASSERT_TRUE(EMPTY(out_arcs(graph, 0)));
+    ASSERT_TRUE(EMPTY(out_arcs(graph, 1)));
+    ASSERT_TRUE(EMPTY(out_arcs(graph, 2)));
+    ASSERT_TRUE(is_valid_vertex(graph, 2));
+    ASSERT_FALSE(is_valid_vertex(graph, 3));
+    EXPECT_DEATH((void)out_arcs(graph, 3), "");
+}
+
+TYPED_TEST(mutable_digraphs, create_arcs) {
+    using Graph = TypeParam;
+    Graph graph;
+
+    auto a = create_vertex(graph);
+    auto b = create_vertex(graph);
+    auto c = create_vertex(graph);
+
+    auto ab = create_arc(graph, a, b);
+    auto ac = create_arc(graph, a, c);
+    auto cb = create_arc(graph, c, b);
+    auto ca = create_arc(graph, c, a);
+
+    ASSERT_TRUE(EQ_MULTISETS(vertices(graph), {a, b, c}));
+    ASSERT_TRUE(EQ_MULTISETS(arcs(graph), {ab, ac, cb, ca}));
+
+    ASSERT_EQ(arc_source(graph, ab), a);
+    ASSERT_EQ(arc_source(graph, ac), a);
+    ASSERT_EQ(arc_source(graph, cb), c);
+    ASSERT_EQ(arc_target(graph, ab), b);
+    ASSERT_EQ(arc_target(graph, ac), c);
+    ASSERT_EQ(arc_target(graph, cb), b);
+
+    ASSERT_TRUE(EQ_MULTISETS(
+        arcs_entries(graph),
+        arc_entries_list<Graph>{
+            {ab, {a, b}}, {ac, {a, c}}, {cb, {c, b}}, {ca, {c, a}}}));
+
+    ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, a), {b, c}));
+    ASSERT_TRUE(EMPTY(out_neighbors(graph, b)));
+    ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, c), {a, b}));
+}
+
+TYPED_TEST(mutable_digraphs, remove_arcs) {
+    using Graph = TypeParam;
+    Graph graph;
+    auto a = create_vertex(graph);
+    auto b = create_vertex(graph);
+    auto c = create_vertex(graph);
+    auto ab = create_arc(graph, a, b);
+    auto ac = create_arc(graph, a, c);
+    auto cb = create_arc(graph, c, b);
+
+    remove_arc(graph, ac);
+
+    ASSERT_FALSE(is_valid_arc(graph, ac));
+    ASSERT_EQ(arc_source(graph, ab), a);
+    EXPECT_DEATH((void)arc_source(graph, ac), "");
+    ASSERT_EQ(arc_source(graph, cb), c);
+    ASSERT_EQ(arc_target(graph, ab), b);
+    EXPECT_DEATH((void)arc_target(graph, ac), "");
+    ASSERT_EQ(arc_target(graph, cb), b);
+
+    ASSERT_TRUE(EQ_MULTISETS(
+        arcs_entries(graph),
+        arc_entries_list<Graph>{{cb, {c, b}}, {ab, {a, b}}}));
+
+    ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, a), {b}));
+    ASSERT_TRUE(EMPTY(out_neighbors(graph, b)));
+    ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, c), {b}));
+}
+
+TYPED_TEST(mutable_digraphs, fuzzy_test) {
+    using Graph = TypeParam;
+    enum Operation {
+        CREATE_VERTEX,
+        REMOVE_VERTEX,
+        CREATE_ARC,
+        REMOVE_ARC,
+        CHANGE_SOURCE,
+        CHANGE_TARGET
+    };
+    std::vector<Operation> operations = {
+        CREATE_VERTEX, CREATE_VERTEX, REMOVE_VERTEX, CREATE_ARC,   CREATE_ARC,
+        CREATE_ARC,    REMOVE_ARC,    CHANGE_SOURCE, CHANGE_TARGET};
+
+    for(std::size_t j = 0; j < 10; ++j) {
+        Graph graph;
+        dumb_digraph dummy_graph;
+
+        for(std::size_t i = 0; i < 200; ++i) {
+            Operation op;
+            for(;;) {
+                op = random_element(operations);
+                auto num_vertices =
+                    std::ranges::distance(dummy_graph.vertices());
+                auto num_arcs = std::ranges::distance(dummy_graph.arcs());
+                if(op == REMOVE_VERTEX && num_vertices == 0) continue;
+                if(op == CREATE_ARC && num_vertices < 2) continue;
+                if(op == REMOVE_ARC && num_arcs == 0) continue;
+                if((op == CHANGE_SOURCE || op == CHANGE_TARGET) &&
+                   (num_arcs == 0 || num_vertices < 2))
+                    continue;
+                break;
+            }
+
+            if(op == CREATE_VERTEX) {
+                auto u = create_vertex(graph);
+                dummy_graph.create_vertex(u);
+            }
+            if(op == REMOVE_VERTEX) {
+                auto u = random_element(dummy_graph.vertices());
+                remove_vertex(graph, u);
+                dummy_graph.remove_vertex(u);
+            }
+            if(op == CREATE_ARC) {
+                auto s = random_element(dummy_graph.vertices());
+                auto t = random_element(dummy_graph.vertices());
+                auto a = create_arc(graph, s, t);
+                dummy_graph.create_arc(a, s, t);
+            }
+            if(op == REMOVE_ARC) {
+                auto a = random_element(dummy_graph.arcs());
+                remove_arc(graph, a);
+                dummy_graph.remove_arc(a);
+            }
+            if(op == CHANGE_SOURCE) {
+                auto a = random_element(dummy_graph.arcs());
+                auto s = random_element(dummy_graph.vertices());
+                change_arc_source(graph, a, s);
+                dummy_graph.change_arc_source(a, s);
+            }
+            if(op == CHANGE_TARGET) {
+                auto a = random_element(dummy_graph.arcs());
+                auto t = random_element(dummy_graph.vertices());
+                change_arc_target(graph, a, t);
+                dummy_graph.change_arc_target(a, t);
+            }
+
+            ASSERT_TRUE(EQ_MULTISETS(vertices(graph), dummy_graph.vertices()));
+            ASSERT_TRUE(EQ_MULTISETS(arcs(graph), dummy_graph.arcs()));
+            ASSERT_EQ(num_vertices(graph), dummy_graph.num_vertices());
+            ASSERT_EQ(num_arcs(graph), dummy_graph.num_arcs());
+            ASSERT_TRUE(
+                EQ_MULTISETS(arcs_entries(graph), dummy_graph.arcs_entries()));
+
+            for(auto && v : vertices(graph)) {
+                ASSERT_TRUE(is_valid_vertex(graph, v));
+                ASSERT_TRUE(dummy_graph.is_valid_vertex(v));
+                ASSERT_TRUE(
+                    EQ_MULTISETS(in_arcs(graph, v), dummy_graph.in_arcs(v)));
+                ASSERT_TRUE(
+                    EQ_MULTISETS(out_arcs(graph, v), dummy_graph.out_arcs(v)));
+                ASSERT_TRUE(EQ_MULTISETS(in_neighbors(graph, v),
+                                         dummy_graph.in_neighbors(v)));
+                ASSERT_TRUE(EQ_MULTISETS(out_neighbors(graph, v),
+                                         dummy_graph.out_neighbors(v)));
+            }
+            for(auto && a : arcs(graph)) {
+                ASSERT_TRUE(is_valid_arc(graph, a));
+                ASSERT_TRUE(dummy_graph.is_valid_arc(a));
+                ASSERT_EQ(arc_target(graph, a), dummy_graph.arc_target(a));
+                ASSERT_EQ(arc_source(graph, a), dummy_graph.arc_source(a));
+            }
+        }
+    }
+}
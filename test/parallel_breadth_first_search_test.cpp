@@ -0,0 +1,97 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/parallel_breadth_first_search.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+using namespace fhamonic::melon;
+
+struct bfs_distances_traits : public breadth_first_search_default_traits {
+    static constexpr bool store_distances = true;
+};
+
+struct parallel_bfs_traits
+    : public parallel_breadth_first_search_default_traits {
+    static constexpr bool store_pred_vertices = true;
+    static constexpr bool store_distances = true;
+};
+
+static static_digraph random_graph(const std::size_t n, const std::size_t m) {
+    std::mt19937 engine{std::random_device{}()};
+    std::uniform_int_distribution<unsigned int> vertex_distr(
+        0, static_cast<unsigned int>(n - 1));
+    static_digraph_builder<static_digraph> builder(n);
+    for(std::size_t i = 0; i < m; ++i)
+        builder.add_arc(vertex_distr(engine), vertex_distr(engine));
+    auto [graph] = builder.build();
+    return graph;
+}
+
+GTEST_TEST(parallel_breadth_first_search, test) {
+    static_digraph_builder<static_digraph> builder(8);
+    builder.add_arc(0, 1)
+        .add_arc(0, 2)
+        .add_arc(0, 5)
+        .add_arc(1, 3)
+        .add_arc(2, 3)
+        .add_arc(3, 4)
+        .add_arc(4, 5)
+        .add_arc(5, 4)
+        .add_arc(7, 5);
+    auto [graph] = builder.build();
+
+    parallel_breadth_first_search alg(parallel_bfs_traits{},
+                                      parallel_policy{2}, graph, 0u);
+    static_assert(std::copyable<decltype(alg)>);
+
+    alg.advance();
+    ASSERT_FALSE(alg.finished());
+    ASSERT_TRUE(alg.reached(5u));
+    ASSERT_FALSE(alg.reached(4u));
+    alg.run();
+
+    const std::vector<int> dist = {0, 1, 1, 2, 2, 1};
+    for(unsigned int u = 0; u < 6; ++u) {
+        ASSERT_TRUE(alg.reached(u));
+        ASSERT_EQ(alg.dist(u), dist[u]);
+    }
+    ASSERT_FALSE(alg.reached(6u));
+    ASSERT_FALSE(alg.reached(7u));
+    ASSERT_EQ(alg.pred_vertex(4u), 5u);
+
+    alg.reset().add_source(7u).run();
+    ASSERT_EQ(alg.dist(4u), 2);
+    ASSERT_FALSE(alg.reached(0u));
+}
+
+GTEST_TEST(parallel_breadth_first_search, fuzzy) {
+    const std::size_t n = 20000;
+    const static_digraph graph = random_graph(n, 8 * n);
+    std::mt19937 engine{std::random_device{}()};
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+
+    for(const std::size_t num_threads : {1ul, 2ul, 4ul, 8ul}) {
+        const unsigned int s = vertex_distr(engine);
+        breadth_first_search bfs(bfs_distances_traits{}, graph, s);
+        bfs.run();
+        parallel_breadth_first_search alg(
+            parallel_bfs_traits{}, parallel_policy{num_threads}, graph, s);
+        alg.run();
+        for(auto && u : vertices(graph)) {
+            ASSERT_EQ(alg.reached(u), bfs.reached(u));
+            if(!bfs.reached(u)) continue;
+            ASSERT_EQ(alg.dist(u), bfs.dist(u));
+            if(u == s) continue;
+            const unsigned int p = alg.pred_vertex(u);
+            ASSERT_EQ(alg.dist(p) + 1, alg.dist(u));
+            ASSERT_TRUE(std::ranges::find(out_neighbors(graph, p), u) !=
+                        std::ranges::end(out_neighbors(graph, p)));
+        }
+    }
+}
@@ -0,0 +1,122 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "melon/algorithm/parallel_strongly_connected_components.hpp"
+#include "melon/algorithm/strongly_connected_components.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+using namespace fhamonic::melon;
+
+// Checks that alg has the components found by Tarjan's algorithm.
+template <typename _Alg>
+void check_against_tarjan(const static_digraph & graph, const _Alg & alg) {
+    std::vector<bool> seen_components(alg.num_components(), false);
+    std::size_t num_components = 0;
+    for(auto && component : strongly_connected_components(graph)) {
+        std::vector<unsigned int> vertices;
+        for(auto && u : component) vertices.push_back(u);
+        const auto c = alg.component(vertices.front());
+        ASSERT_LT(c, alg.num_components());
+        ASSERT_FALSE(seen_components[c]);
+        seen_components[c] = true;
+        ASSERT_EQ(alg.component_sizes()[c], vertices.size());
+        for(auto && u : vertices) ASSERT_EQ(alg.component(u), c);
+        ++num_components;
+    }
+    ASSERT_EQ(alg.num_components(), num_components);
+}
+
+GTEST_TEST(parallel_strongly_connected_components, test) {
+    static_digraph_builder<static_digraph> builder(8);
+    builder.add_arc(0, 1)
+        .add_arc(0, 2)
+        .add_arc(0, 5)
+        .add_arc(1, 0)
+        .add_arc(1, 2)
+        .add_arc(1, 3)
+        .add_arc(2, 0)
+        .add_arc(2, 1)
+        .add_arc(2, 3)
+        .add_arc(2, 5)
+        .add_arc(3, 1)
+        .add_arc(3, 2)
+        .add_arc(3, 4)
+        .add_arc(4, 3)
+        .add_arc(4, 5)
+        .add_arc(5, 0)
+        .add_arc(5, 2)
+        .add_arc(5, 4)
+        .add_arc(6, 6)
+        .add_arc(7, 5);
+    auto [graph] = builder.build();
+
+    parallel_strongly_connected_components alg(graph);
+    static_assert(std::copyable<decltype(alg)>);
+    alg.run();
+    ASSERT_EQ(alg.num_components(), 3);
+    for(unsigned int u = 1; u < 6; ++u) ASSERT_TRUE(alg.same_component(0u, u));
+    ASSERT_FALSE(alg.same_component(0u, 6u));
+    ASSERT_FALSE(alg.same_component(0u, 7u));
+    ASSERT_FALSE(alg.same_component(6u, 7u));
+    ASSERT_EQ(alg.component_sizes()[alg.component(0u)], 6);
+    ASSERT_EQ(alg.components_map()[6u], alg.component(6u));
+    check_against_tarjan(graph, alg);
+}
+
+GTEST_TEST(parallel_strongly_connected_components, cycles_chain) {
+    // cycles of 10 vertices linked by paths in both directions, which become
+    // trimmable once their endpoint cycles are removed
+    const unsigned int num_cycles = 100;
+    const unsigned int n = num_cycles * 20;
+    static_digraph_builder<static_digraph> builder(n);
+    for(unsigned int c = 0; c < num_cycles; ++c) {
+        const unsigned int first = c * 20;
+        for(unsigned int i = 0; i < 10; ++i)
+            builder.add_arc(first + i, first + (i + 1) % 10);
+        if(c + 1 == num_cycles) break;
+        const unsigned int next = first + 20;
+        const bool forward = c % 2 == 0;
+        unsigned int prev = forward ? first : next;
+        for(unsigned int i = 10; i < 20; ++i) {
+            builder.add_arc(prev, first + i);
+            prev = first + i;
+        }
+        builder.add_arc(prev, forward ? next : first);
+    }
+    for(unsigned int u = (num_cycles - 1) * 20 + 10; u < n; ++u)
+        builder.add_arc(u, u - 1);
+    auto [graph] = builder.build();
+
+    for(const std::size_t num_threads : {1ul, 4ul}) {
+        parallel_strongly_connected_components alg(
+            parallel_policy{num_threads}, graph);
+        alg.run();
+        ASSERT_EQ(alg.num_components(),
+                  num_cycles + (num_cycles - 1) * 10 + 10);
+        check_against_tarjan(graph, alg);
+    }
+}
+
+GTEST_TEST(parallel_strongly_connected_components, fuzzy) {
+    std::mt19937 engine{std::random_device{}()};
+    const std::size_t n = 5000;
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+
+    for(const std::size_t m : {n / 2, n, 3 * n / 2, 2 * n, 4 * n}) {
+        static_digraph_builder<static_digraph> builder(n);
+        for(std::size_t i = 0; i < m; ++i)
+            builder.add_arc(vertex_distr(engine), vertex_distr(engine));
+        auto [graph] = builder.build();
+
+        for(const std::size_t num_threads : {1ul, 4ul}) {
+            parallel_strongly_connected_components alg(
+                parallel_policy{num_threads}, graph);
+            alg.run();
+            check_against_tarjan(graph, alg);
+        }
+    }
+}
@@ -0,0 +1,90 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "melon/container/piecewise_linear_functions.hpp"
+#include "melon/mapping.hpp"
+#include "melon/utility/piecewise_linear_function.hpp"
+
+using namespace fhamonic::melon;
+
+static_assert(std::copyable<piecewise_linear_functions<std::size_t, double>>);
+static_assert(input_mapping<piecewise_linear_functions<std::size_t, double>,
+                            std::size_t>);
+static_assert(piecewise_linear<piecewise_linear_function<double>>);
+static_assert(piecewise_linear<piecewise_linear_function_view<double>>);
+
+GTEST_TEST(piecewise_linear_functions, evaluation) {
+    piecewise_linear_functions<unsigned int, int> functions;
+    functions.push_back({{0, 10}, {10, 20}, {20, 10}}).push_back({{5, 3}});
+    std::vector<std::pair<int, int>> long_function;
+    for(int i = 0; i < 100; ++i) long_function.emplace_back(2 * i, i % 2);
+    functions.push_back(long_function);
+    ASSERT_EQ(functions.size(), 3);
+    ASSERT_EQ(functions.num_breakpoints(), 104);
+
+    auto f = functions[0u];
+    ASSERT_EQ(f.size(), 3);
+    ASSERT_EQ(f(-5), 10);
+    ASSERT_EQ(f(0), 10);
+    ASSERT_EQ(f(5), 15);
+    ASSERT_EQ(f(10), 20);
+    ASSERT_EQ(f(12), 18);
+    ASSERT_EQ(f(30), 10);
+    ASSERT_EQ(f.min_value(), 10);
+    ASSERT_EQ(functions[1u](-100), 3);
+    ASSERT_EQ(functions[1u](100), 3);
+    ASSERT_EQ(functions[2u](-1), 0);
+    ASSERT_EQ(functions[2u](100), 0);
+    ASSERT_EQ(functions[2u](102), 1);
+    ASSERT_EQ(functions[2u](1000), 1);
+
+    piecewise_linear_functions<unsigned int, int> constants(4, 7);
+    ASSERT_EQ(constants.size(), 4);
+    for(unsigned int i = 0; i < 4; ++i) ASSERT_EQ(constants[i](42), 7);
+}
+
+GTEST_TEST(piecewise_linear_function, link_and_min) {
+    const piecewise_linear_function<double> f = {{0, 10}, {10, 20}, {20, 10}};
+    const piecewise_linear_function<double> g = {{15, 5}, {30, 20}};
+    ASSERT_EQ(link_piecewise_linear(f, g),
+              (piecewise_linear_function<double>{
+                  {0, 15}, {2.5, 17.5}, {10, 40}, {20, 30}}));
+    const auto h = min_piecewise_linear(f, g);
+    ASSERT_EQ(h, (piecewise_linear_function<double>{{15, 5}, {20, 10}}));
+    ASSERT_TRUE(piecewise_linear_less_equal(h, f));
+    ASSERT_TRUE(piecewise_linear_less_equal(h, g));
+    ASSERT_FALSE(piecewise_linear_less_equal(f, g));
+    ASSERT_EQ(min_piecewise_linear(f, f), f);
+    const auto zero =
+        min_piecewise_linear(f, piecewise_linear_function<double>(0.0));
+    ASSERT_EQ(zero.size(), 1);
+    ASSERT_EQ(zero(0.0), 0.0);
+}
+
+GTEST_TEST(piecewise_linear_function, fuzzy_link_and_min) {
+    std::mt19937 engine{std::random_device{}()};
+    std::uniform_int_distribution<int> num_breakpoints_distr(1, 8);
+    std::uniform_real_distribution<double> value_distr(1.0, 11.0);
+    std::uniform_real_distribution<double> time_distr(-20.0, 120.0);
+    // FIFO functions : slopes are at least -1
+    auto random_function = [&]() {
+        piecewise_linear_function<double> f;
+        const int n = num_breakpoints_distr(engine);
+        for(int i = 0; i < n; ++i) f.push_back(10.0 * i, value_distr(engine));
+        return f;
+    };
+    for(int i = 0; i < 100; ++i) {
+        const auto f = random_function();
+        const auto g = random_function();
+        const auto l = link_piecewise_linear(f, g);
+        const auto m = min_piecewise_linear(f, g);
+        for(int j = 0; j < 100; ++j) {
+            const double t = time_distr(engine);
+            ASSERT_NEAR(l(t), f(t) + g(t + f(t)), 1e-9);
+            ASSERT_NEAR(m(t), std::min(f(t), g(t)), 1e-9);
+        }
+    }
+}
@@ -0,0 +1,51 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "melon/container/radix_heap.hpp"
+
+using namespace fhamonic::melon;
+
+// Counts the priority reads, which bounds the number of times the entries are
+// bucketed.
+struct counting_priority_map : public mapping_view_base {
+    static inline std::size_t num_reads = 0;
+    template <class T>
+    [[nodiscard]] constexpr decltype(auto) operator[](T && e) const noexcept {
+        ++num_reads;
+        return std::get<1>(e);
+    }
+};
+
+GTEST_TEST(radix_heap, small_lengths_chain_next_to_far_entries) {
+    // Dijkstra on a unit length chain while a batch of far entries waits :
+    // the pushes between two pops must not redistribute the far entries.
+    constexpr unsigned int chain_length = 20000;
+    constexpr unsigned int batch_size = 20000;
+    constexpr unsigned int far = 1000000;
+    radix_heap<std::pair<unsigned int, unsigned int>, std::less<unsigned int>,
+               std::vector<std::size_t>, counting_priority_map,
+               views::get_map<0>>
+        heap(std::less<unsigned int>{},
+             std::vector<std::size_t>(chain_length + batch_size));
+    counting_priority_map::num_reads = 0;
+    for(unsigned int i = 0; i < batch_size; ++i)
+        heap.push(std::make_pair(chain_length + i, far + i % 7));
+    heap.push(std::make_pair(0u, 0u));
+    for(unsigned int i = 0; i < chain_length; ++i) {
+        ASSERT_EQ(heap.top(), std::make_pair(i, i));
+        heap.pop();
+        if(i + 1 < chain_length) heap.push(std::make_pair(i + 1, i + 1));
+    }
+    unsigned int last = far;
+    while(!heap.empty()) {
+        ASSERT_LE(last, heap.top().second);
+        last = heap.top().second;
+        heap.pop();
+    }
+    ASSERT_EQ(last, far + 6);
+    ASSERT_LT(counting_priority_map::num_reads,
+              100 * (chain_length + batch_size));
+}
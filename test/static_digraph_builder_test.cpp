@@ -1,6 +1,8 @@
 #undef NDEBUG
 #include <gtest/gtest.h>
 
+#include <random>
+
 #include "melon/container/static_digraph.hpp"
 #include "melon/utility/static_digraph_builder.hpp"
 
@@ -76,3 +78,75 @@ GTEST_TEST(static_digraph_builder, build_with_map) {
         ASSERT_EQ(map[a], weight(u, v));
     }
 }
+
+GTEST_TEST(static_digraph_builder, parallel_build_same_as_build) {
+    constexpr std::size_t n = 3000;
+    std::mt19937 engine(7);
+    std::uniform_int_distribution<vertex_t<static_digraph>> vertex_distr(
+        0, n - 1);
+    static_digraph_builder<static_digraph, int> builder(n);
+    static_digraph_builder<static_digraph, int> parallel_builder(n);
+    for(int i = 0; i < 50000; ++i) {
+        // few distinct pairs to check that duplicated arcs keep their order
+        const auto u = vertex_distr(engine) % 100;
+        const auto v = vertex_distr(engine) % 100;
+        builder.add_arc(u, v, i);
+        parallel_builder.add_arc(u, v, i);
+    }
+    for(int i = 50000; i < 100000; ++i) {
+        const auto u = vertex_distr(engine);
+        const auto v = vertex_distr(engine);
+        builder.add_arc(u, v, i);
+        parallel_builder.add_arc(u, v, i);
+    }
+
+    auto [graph, map] = builder.build();
+    auto [parallel_graph, parallel_map] =
+        parallel_builder.build(parallel_policy{4});
+
+    ASSERT_EQ(num_arcs(graph), num_arcs(parallel_graph));
+    ASSERT_TRUE(EQ_RANGES(map, parallel_map));
+    for(auto && a : arcs(graph)) {
+        ASSERT_EQ(arc_source(graph, a), arc_source(parallel_graph, a));
+        ASSERT_EQ(arc_target(graph, a), arc_target(parallel_graph, a));
+    }
+    for(auto && u : vertices(graph)) {
+        ASSERT_TRUE(EQ_RANGES(out_arcs(graph, u), out_arcs(parallel_graph, u)));
+        ASSERT_TRUE(EQ_RANGES(in_arcs(graph, u), in_arcs(parallel_graph, u)));
+    }
+    ASSERT_TRUE(std::ranges::is_sorted(arcs(graph), [&](auto a, auto b) {
+        if(arc_source(graph, a) != arc_source(graph, b))
+            return arc_source(graph, a) < arc_source(graph, b);
+        if(arc_target(graph, a) != arc_target(graph, b))
+            return arc_target(graph, a) < arc_target(graph, b);
+        return map[a] < map[b];
+    }));
+}
+
+GTEST_TEST(static_digraph_builder, index_widths) {
+    using small_digraph = basic_static_digraph<std::uint16_t, std::uint16_t>;
+    static_digraph_builder<small_digraph, double> builder(4);
+    builder.add_arc(2, 3, 0.5).add_arc(0, 1, 1.5).add_arc(2, 0, 2.5);
+    auto [graph, map] = builder.build();
+    static_assert(std::same_as<vertex_t<decltype(graph)>, std::uint16_t>);
+    ASSERT_EQ(num_arcs(graph), 3);
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 2), {0, 3}));
+    ASSERT_TRUE(EQ_RANGES(map, {1.5, 2.5, 0.5}));
+}
+
+GTEST_TEST(static_digraph_builder, parallel_build_properties) {
+    struct label {
+        int value;
+        explicit label(int v) : value(v) {}
+    };
+    static_digraph_builder<static_digraph, bool, label> builder(4);
+    builder.add_arc(2, 3, true, label(0))
+        .add_arc(0, 1, false, label(1))
+        .add_arc(2, 0, true, label(2))
+        .add_arc(1, 3, false, label(3));
+    auto [graph, flags, labels] = builder.build(parallel_policy{4});
+    ASSERT_TRUE(EQ_RANGES(flags, {false, false, true, true}));
+    ASSERT_TRUE(EQ_RANGES(
+        std::views::transform(labels, [](const label & l) { return l.value; }),
+        {1, 3, 2, 0}));
+}
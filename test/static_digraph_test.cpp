@@ -138,3 +138,64 @@ GTEST_TEST(static_digraph, vectors_constructor_2) {
         ASSERT_EQ(arc_target(graph,a), arc_pairs[a].second.second);
     }
 }
+
+GTEST_TEST(static_digraph, parallel_constructor) {
+    std::vector<vertex_t<static_digraph>> sources;
+    std::vector<vertex_t<static_digraph>> targets;
+    for(vertex_t<static_digraph> u = 0; u < 1000; ++u)
+        for(vertex_t<static_digraph> i = 0; i < u % 13; ++i) {
+            sources.push_back(u);
+            targets.push_back((u * 7919 + i * 104729) % 1200);
+        }
+
+    static_digraph graph(1200, sources, targets);
+    static_digraph parallel_graph(parallel_policy{3}, 1200, sources, targets);
+
+    ASSERT_EQ(num_vertices(graph), num_vertices(parallel_graph));
+    ASSERT_EQ(num_arcs(graph), num_arcs(parallel_graph));
+    for(auto && u : vertices(graph)) {
+        ASSERT_TRUE(EQ_RANGES(out_arcs(graph, u), out_arcs(parallel_graph, u)));
+        ASSERT_TRUE(EQ_RANGES(in_arcs(graph, u), in_arcs(parallel_graph, u)));
+    }
+    for(auto && a : arcs(graph)) {
+        ASSERT_EQ(arc_source(graph, a), arc_source(parallel_graph, a));
+        ASSERT_EQ(arc_target(graph, a), arc_target(parallel_graph, a));
+    }
+
+    static_digraph empty_graph(parallel_policy{}, 5, std::vector<unsigned>{},
+                               std::vector<unsigned>{});
+    ASSERT_EQ(num_arcs(empty_graph), 0);
+    for(auto && u : vertices(empty_graph))
+        ASSERT_TRUE(EMPTY(out_arcs(empty_graph, u)));
+}
+
+GTEST_TEST(static_digraph, index_widths) {
+    using small_digraph = basic_static_digraph<std::uint16_t, std::uint16_t>;
+    using large_digraph = basic_static_digraph<unsigned int, std::uint64_t>;
+    static_assert(std::same_as<vertex_t<small_digraph>, std::uint16_t>);
+    static_assert(std::same_as<arc_t<small_digraph>, std::uint16_t>);
+    static_assert(std::same_as<arc_t<large_digraph>, std::uint64_t>);
+    static_assert(melon::inward_adjacency_graph<small_digraph>);
+    static_assert(melon::inward_adjacency_graph<large_digraph>);
+
+    std::vector<unsigned int> sources({1, 1, 1, 2, 2, 3, 5, 5, 6});
+    std::vector<unsigned int> targets({2, 6, 7, 3, 4, 4, 2, 3, 5});
+    static_digraph graph(8, sources, targets);
+    small_digraph small_graph(8, sources, targets);
+    large_digraph large_graph(parallel_policy{2}, 8, sources, targets);
+
+    auto small_map = create_arc_map<int>(small_graph);
+    static_assert(std::same_as<decltype(small_map),
+                               static_map<std::uint16_t, int>>);
+    ASSERT_EQ(small_map.size(), 9);
+
+    for(auto && u : vertices(graph)) {
+        const auto small_u = static_cast<std::uint16_t>(u);
+        ASSERT_TRUE(EQ_RANGES(out_neighbors(small_graph, small_u),
+                              out_neighbors(graph, u)));
+        ASSERT_TRUE(EQ_RANGES(in_arcs(small_graph, small_u), in_arcs(graph, u)));
+        ASSERT_TRUE(
+            std::ranges::equal(out_arcs(large_graph, u), out_arcs(graph, u)));
+        ASSERT_TRUE(EQ_RANGES(in_arcs(large_graph, u), in_arcs(graph, u)));
+    }
+}
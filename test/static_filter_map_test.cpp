@@ -1,7 +1,9 @@
 #undef NDEBUG
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <random>
+#include <thread>
 
 #include "melon/container/static_digraph.hpp"
 #include "melon/container/static_map.hpp"
@@ -224,4 +226,23 @@ GTEST_TEST(static_map_bool, filter_bench) {
             std::cout << duration.count() << std::endl;
         }
     }
-}
\ No newline at end of file
+}
+
+GTEST_TEST(static_map_bool, atomic_test_and_set) {
+    const std::size_t nb_bools = 1000;
+    static_filter_map<std::size_t> map(nb_bools, false);
+    std::vector<std::size_t> claims(nb_bools, 0);
+    {
+        std::vector<std::jthread> threads;
+        for(std::size_t t = 0; t < 4; ++t)
+            threads.emplace_back([&map, &claims, nb_bools] {
+                for(std::size_t i = 0; i < nb_bools; ++i)
+                    if(!map.atomic_test_and_set(i))
+                        std::atomic_ref<std::size_t>(claims[i]).fetch_add(1);
+            });
+    }
+    for(std::size_t i = 0; i < nb_bools; ++i) {
+        ASSERT_TRUE(map[i]);
+        ASSERT_EQ(claims[i], 1);
+    }
+}
@@ -124,4 +124,19 @@ GTEST_TEST(static_forward_digraph, vectors_constructor_2) {
                   std::ranges::empty_view<vertex_t<static_forward_digraph>>()));
 
     ASSERT_TRUE(EQ_RANGES(arcs_entries(graph), arc_pairs));
-}
\ No newline at end of file
+}
+GTEST_TEST(static_forward_digraph, index_widths) {
+    using small_digraph =
+        basic_static_forward_digraph<std::uint16_t, std::uint16_t>;
+    static_assert(std::same_as<vertex_t<small_digraph>, std::uint16_t>);
+    static_assert(std::same_as<arc_t<small_digraph>, std::uint16_t>);
+    static_assert(melon::outward_adjacency_graph<small_digraph>);
+
+    std::vector<std::uint16_t> sources({0, 0, 1, 2, 2});
+    std::vector<std::uint16_t> targets({1, 2, 2, 0, 1});
+    small_digraph graph(3, sources, targets);
+    ASSERT_EQ(num_arcs(graph), 5);
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 0), {1, 2}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 2), {0, 1}));
+    ASSERT_EQ(create_vertex_map<int>(graph).size(), 3);
+}
@@ -0,0 +1,100 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/static_forward_digraph.hpp"
+#include "melon/container/static_forward_weighted_digraph.hpp"
+#include "melon/graph.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic;
+using namespace fhamonic::melon;
+
+using weighted_digraph = static_forward_weighted_digraph<int>;
+
+static_assert(melon::graph<weighted_digraph>);
+static_assert(melon::outward_incidence_graph<weighted_digraph>);
+static_assert(melon::outward_adjacency_graph<weighted_digraph>);
+static_assert(melon::has_vertex_map<weighted_digraph>);
+static_assert(melon::has_arc_map<weighted_digraph>);
+static_assert(melon::input_mapping<
+              decltype(std::declval<weighted_digraph>().arc_weights_map()),
+              arc_t<weighted_digraph>>);
+static_assert(melon::mapping_view<
+              decltype(std::declval<weighted_digraph>().arc_targets_map()),
+              arc_t<weighted_digraph>>);
+
+GTEST_TEST(static_forward_weighted_digraph, empty_constructor) {
+    weighted_digraph graph;
+    ASSERT_EQ(num_vertices(graph), 0);
+    ASSERT_EQ(num_arcs(graph), 0);
+    ASSERT_TRUE(EMPTY(vertices(graph)));
+    ASSERT_TRUE(EMPTY(arcs(graph)));
+
+    EXPECT_DEATH((void)out_arcs(graph, 0), "");
+    EXPECT_DEATH((void)arc_target(graph, 0), "");
+}
+
+GTEST_TEST(static_forward_weighted_digraph, vectors_constructor) {
+    std::vector<unsigned int> sources({0, 0, 1, 2, 2});
+    std::vector<unsigned int> targets({1, 2, 2, 0, 1});
+    std::vector<int> weights({10, 20, 30, 40, 50});
+    weighted_digraph graph(3, sources, targets, weights);
+
+    ASSERT_EQ(num_vertices(graph), 3);
+    ASSERT_EQ(num_arcs(graph), 5);
+    ASSERT_TRUE(EQ_RANGES(out_arcs(graph, 0), {0, 1}));
+    ASSERT_TRUE(EQ_RANGES(out_arcs(graph, 1), {2}));
+    ASSERT_TRUE(EQ_RANGES(out_arcs(graph, 2), {3, 4}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 0), {1, 2}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, 2), {0, 1}));
+
+    auto targets_map = arc_targets_map(graph);
+    auto weights_map = graph.arc_weights_map();
+    for(auto && a : arcs(graph)) {
+        ASSERT_EQ(arc_target(graph, a), targets[a]);
+        ASSERT_EQ(targets_map[a], targets[a]);
+        ASSERT_EQ(graph.arc_weight(a), weights[a]);
+        ASSERT_EQ(weights_map[a], weights[a]);
+    }
+    // interleaved storage
+    ASSERT_EQ(static_cast<const void *>(&targets_map[1]),
+              static_cast<const void *>(targets_map.address_of(1)));
+    ASSERT_LT(reinterpret_cast<const char *>(&weights_map[0]),
+              reinterpret_cast<const char *>(&targets_map[1]));
+}
+
+GTEST_TEST(static_forward_weighted_digraph, index_widths) {
+    using small_digraph =
+        basic_static_forward_weighted_digraph<double, std::uint16_t,
+                                              std::uint16_t>;
+    static_assert(std::same_as<vertex_t<small_digraph>, std::uint16_t>);
+    static_assert(std::same_as<arc_t<small_digraph>, std::uint16_t>);
+
+    std::vector<std::uint16_t> sources({0, 1});
+    std::vector<std::uint16_t> targets({1, 0});
+    std::vector<double> weights({0.5, 1.5});
+    small_digraph graph(2, sources, targets, weights);
+    ASSERT_EQ(graph.arc_weights_map()[1], 1.5);
+}
+
+GTEST_TEST(static_forward_weighted_digraph, same_traversals) {
+    std::vector<unsigned int> sources({0, 0, 0, 1, 1, 2, 3, 3, 4, 5});
+    std::vector<unsigned int> targets({1, 2, 3, 2, 4, 5, 4, 5, 5, 0});
+    std::vector<int> weights({4, 1, 7, 2, 5, 9, 1, 3, 1, 2});
+    static_forward_digraph graph(6, sources, targets);
+    weighted_digraph weighted_graph(6, sources, targets, weights);
+
+    std::vector<std::pair<unsigned int, int>> expected;
+    for(auto && p : dijkstra(graph, weights, 0u)) expected.push_back(p);
+    std::vector<std::pair<unsigned int, int>> traversal;
+    for(auto && p :
+        dijkstra(weighted_graph, weighted_graph.arc_weights_map(), 0u))
+        traversal.push_back(p);
+    ASSERT_EQ(traversal, expected);
+
+    ASSERT_TRUE(EQ_RANGES(breadth_first_search(weighted_graph, 0u),
+                          breadth_first_search(graph, 0u)));
+}
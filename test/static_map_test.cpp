@@ -3,6 +3,7 @@
 
 #include "melon/container/static_digraph.hpp"
 #include "melon/container/static_map.hpp"
+#include "melon/graph.hpp"
 #include "melon/mapping.hpp"
 
 #include "ranges_test_helper.hpp"
@@ -139,3 +140,72 @@ GTEST_TEST(static_map, resize) {
     map.resize(10);
     ASSERT_EQ(map.size(), 10);
 }
+
+GTEST_TEST(static_map, allocation_policies) {
+    const std::vector<allocation_policy> policies = {
+        {},
+        {huge_pages_mode::transparent, numa_mode::none, 1},
+        {huge_pages_mode::explicit_pages, numa_mode::none, 1},
+        {huge_pages_mode::none, numa_mode::interleave, 1},
+        {huge_pages_mode::transparent, numa_mode::first_touch, 4},
+        {huge_pages_mode::none, numa_mode::none, 0}};
+    const std::size_t n = 1000000;
+    for(auto && policy : policies) {
+        static_map<std::size_t, int> map(n, 7, policy);
+        ASSERT_EQ(map.policy(), policy);
+        ASSERT_EQ(map.size(), n);
+        ASSERT_TRUE(std::ranges::all_of(map, [](int v) { return v == 7; }));
+        if(policy.huge_pages != huge_pages_mode::none) {
+            ASSERT_EQ(reinterpret_cast<std::uintptr_t>(map.data()) %
+                          (std::uintptr_t{1} << 21),
+                      0);
+        }
+
+        for(std::size_t i = 0; i < n; ++i) map[i] = static_cast<int>(i);
+        static_map<std::size_t, int> copy(map);
+        ASSERT_EQ(copy.policy(), policy);
+        ASSERT_TRUE(std::ranges::equal(copy, map));
+        copy.fill(3);
+        ASSERT_TRUE(std::ranges::all_of(copy, [](int v) { return v == 3; }));
+        copy.resize(10);
+        ASSERT_EQ(copy.policy(), policy);
+        copy = map;
+        ASSERT_TRUE(std::ranges::equal(copy, map));
+
+        static_map<std::size_t, int> default_policy_map(n, 1);
+        default_policy_map = map;
+        ASSERT_EQ(default_policy_map.policy(), policy);
+        ASSERT_TRUE(std::ranges::equal(default_policy_map, map));
+    }
+
+    // non trivial types are allocated with new[]
+    static_map<std::size_t, std::vector<int>> vectors(
+        10, std::vector<int>{1, 2},
+        {huge_pages_mode::transparent, numa_mode::first_touch, 2});
+    ASSERT_TRUE(std::ranges::all_of(
+        vectors, [](auto && v) { return v == std::vector<int>{1, 2}; }));
+}
+
+GTEST_TEST(static_map, graph_maps_inherit_policy) {
+    const allocation_policy policy{huge_pages_mode::transparent,
+                                   numa_mode::first_touch, 2};
+    std::vector<unsigned int> sources({0, 0, 1, 2, 2});
+    std::vector<unsigned int> targets({1, 2, 2, 0, 1});
+    static_digraph graph(3, sources, targets, policy);
+    static_digraph default_graph(3, sources, targets);
+    for(auto && u : vertices(graph)) {
+        ASSERT_TRUE(EQ_RANGES(out_neighbors(graph, u),
+                              out_neighbors(default_graph, u)));
+        ASSERT_TRUE(EQ_RANGES(in_arcs(graph, u), in_arcs(default_graph, u)));
+    }
+    ASSERT_EQ(create_vertex_map<int>(graph).policy(), policy);
+    ASSERT_EQ(create_arc_map<char>(graph, 'a').policy(), policy);
+    ASSERT_EQ(create_vertex_map<int>(default_graph).policy(),
+              allocation_policy{});
+
+    static_digraph parallel_graph(parallel_policy{2}, 3, sources, targets,
+                                  policy);
+    for(auto && u : vertices(graph))
+        ASSERT_TRUE(EQ_RANGES(in_arcs(parallel_graph, u), in_arcs(graph, u)));
+    ASSERT_EQ(create_arc_map<int>(parallel_graph).policy(), policy);
+}
@@ -0,0 +1,129 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/algorithm/time_dependent_dijkstra.hpp"
+#include "melon/container/piecewise_linear_functions.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic::melon;
+
+struct store_arrivals_traits
+    : public time_dependent_dijkstra_default_traits<static_digraph, int> {
+    static constexpr bool store_distances = true;
+    static constexpr bool store_paths = true;
+};
+
+struct store_real_arrivals_traits
+    : public time_dependent_dijkstra_default_traits<static_digraph, double> {
+    static constexpr bool store_distances = true;
+};
+
+GTEST_TEST(time_dependent_dijkstra, test) {
+    static_digraph_builder<static_digraph> builder(4);
+    builder.add_arc(0, 1).add_arc(0, 2).add_arc(1, 3).add_arc(2, 3);
+    auto [graph] = builder.build();
+
+    // the arc 1->3 is congested between 10 and 30
+    piecewise_linear_functions<arc_t<static_digraph>, int> travel_times;
+    for(auto && a : arcs(graph)) {
+        if(arc_source(graph, a) == 0u && arc_target(graph, a) == 1u)
+            travel_times.push_back({{0, 5}});
+        else if(arc_source(graph, a) == 0u)
+            travel_times.push_back({{0, 10}});
+        else if(arc_source(graph, a) == 1u)
+            travel_times.push_back({{10, 5}, {20, 25}, {30, 5}});
+        else
+            travel_times.push_back({{0, 10}});
+    }
+
+    time_dependent_dijkstra alg(store_arrivals_traits{}, graph, travel_times,
+                                0u, 0);
+    alg.run();
+    ASSERT_EQ(alg.arrival(3u), 10);
+    ASSERT_TRUE(EQ_RANGES(alg.path_to(3u), {2u, 0u}));
+
+    alg.reset().add_source(0u, 12).run();
+    ASSERT_EQ(alg.arrival(1u), 17);
+    ASSERT_EQ(alg.arrival(3u), 32);
+    ASSERT_TRUE(EQ_RANGES(alg.path_to(3u), {3u, 1u}));
+
+    time_dependent_profile_search profile_search(graph, travel_times, 0u);
+    profile_search.run();
+    for(int t = -10; t < 50; ++t) {
+        alg.reset().add_source(0u, t).run();
+        ASSERT_EQ(profile_search.profile(3u)(t), alg.arrival(3u) - t);
+    }
+}
+
+GTEST_TEST(time_dependent_dijkstra, fuzzy) {
+    std::mt19937 engine{std::random_device{}()};
+    const std::size_t n = 100;
+    std::uniform_int_distribution<unsigned int> vertex_distr(0, n - 1);
+    std::uniform_int_distribution<int> num_breakpoints_distr(1, 6);
+    std::uniform_real_distribution<double> value_distr(1.0, 11.0);
+    std::uniform_real_distribution<double> time_distr(-10.0, 80.0);
+
+    static_digraph_builder<static_digraph> builder(n);
+    for(std::size_t i = 0; i < 3 * n; ++i)
+        builder.add_arc(vertex_distr(engine), vertex_distr(engine));
+    auto [graph] = builder.build();
+
+    // FIFO functions : slopes are at least -1
+    piecewise_linear_functions<arc_t<static_digraph>, double> travel_times;
+    for(std::size_t i = 0; i < num_arcs(graph); ++i) {
+        std::vector<std::pair<double, double>> breakpoints;
+        const int num_breakpoints = num_breakpoints_distr(engine);
+        for(int k = 0; k < num_breakpoints; ++k)
+            breakpoints.emplace_back(10.0 * k, value_distr(engine));
+        travel_times.push_back(breakpoints);
+    }
+
+    time_dependent_dijkstra alg(store_real_arrivals_traits{}, graph,
+                                travel_times);
+    time_dependent_profile_search profile_search(graph, travel_times);
+    for(std::size_t i = 0; i < 5; ++i) {
+        const unsigned int s = vertex_distr(engine);
+        profile_search.reset().add_source(s);
+        profile_search.run();
+        for(std::size_t j = 0; j < 10; ++j) {
+            const double departure = time_distr(engine);
+            // label-correcting fixpoint on the earliest arrival times
+            std::vector<double> arrivals(
+                n, std::numeric_limits<double>::infinity());
+            arrivals[s] = departure;
+            for(bool changed = true; changed;) {
+                changed = false;
+                for(auto && a : arcs(graph)) {
+                    const unsigned int u = arc_source(graph, a);
+                    if(arrivals[u] == std::numeric_limits<double>::infinity())
+                        continue;
+                    const double w_arrival =
+                        arrivals[u] + travel_times[a](arrivals[u]);
+                    if(w_arrival < arrivals[arc_target(graph, a)]) {
+                        arrivals[arc_target(graph, a)] = w_arrival;
+                        changed = true;
+                    }
+                }
+            }
+            alg.reset().add_source(s, departure).run();
+            for(auto && u : vertices(graph)) {
+                if(arrivals[u] == std::numeric_limits<double>::infinity()) {
+                    ASSERT_FALSE(alg.reached(u));
+                    ASSERT_FALSE(profile_search.reached(u));
+                    continue;
+                }
+                ASSERT_NEAR(alg.arrival(u), arrivals[u], 1e-6);
+                ASSERT_NEAR(profile_search.profile(u)(departure),
+                            arrivals[u] - departure, 1e-6);
+            }
+        }
+    }
+}
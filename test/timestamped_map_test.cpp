@@ -0,0 +1,52 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <utility>
+
+#include "melon/container/timestamped_map.hpp"
+#include "melon/mapping.hpp"
+
+using namespace fhamonic::melon;
+
+static_assert(std::copyable<timestamped_map<std::size_t, int>>);
+static_assert(
+    output_mapping_of<timestamped_map<std::size_t, int>, std::size_t, int>);
+
+GTEST_TEST(timestamped_map, size_init_constructor) {
+    timestamped_map<std::size_t, int> map(5, 3);
+    ASSERT_EQ(map.size(), 5);
+    for(std::size_t i = 0; i < 5; ++i) {
+        ASSERT_EQ(std::as_const(map)[i], 3);
+        ASSERT_EQ(map[i], 3);
+    }
+}
+
+GTEST_TEST(timestamped_map, fill) {
+    timestamped_map<std::size_t, int> map(5, 0);
+    map[1] = 7;
+    map[3] += 2;
+    ASSERT_EQ(std::as_const(map)[1], 7);
+    ASSERT_EQ(std::as_const(map)[3], 2);
+    map.fill(4);
+    for(std::size_t i = 0; i < 5; ++i) ASSERT_EQ(std::as_const(map)[i], 4);
+    map[3] += 1;
+    ASSERT_EQ(map[3], 5);
+    ASSERT_EQ(map[1], 4);
+    timestamped_map<std::size_t, int> copy = map;
+    map.fill(0);
+    ASSERT_EQ(copy[3], 5);
+    ASSERT_EQ(map[3], 0);
+}
+
+GTEST_TEST(timestamped_map, timestamp_overflow) {
+    timestamped_map<std::size_t, int, std::uint8_t> map(3, -1);
+    for(int i = 0; i < 1000; ++i) {
+        map[static_cast<std::size_t>(i) % 3] = i;
+        ASSERT_EQ(std::as_const(map)[static_cast<std::size_t>(i) % 3], i);
+        ASSERT_EQ(std::as_const(map)[static_cast<std::size_t>(i + 1) % 3], -1);
+        map.fill(-1);
+        for(std::size_t j = 0; j < 3; ++j)
+            ASSERT_EQ(std::as_const(map)[j], -1);
+    }
+}
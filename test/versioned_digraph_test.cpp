@@ -0,0 +1,187 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/versioned_digraph.hpp"
+#include "melon/graph.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic;
+using namespace fhamonic::melon;
+
+using snapshot = versioned_digraph<int>::snapshot;
+
+static_assert(melon::graph<snapshot>);
+static_assert(melon::outward_incidence_graph<snapshot>);
+static_assert(melon::outward_adjacency_graph<snapshot>);
+static_assert(melon::has_vertex_map<snapshot>);
+static_assert(melon::has_arc_map<snapshot>);
+static_assert(melon::has_num_arcs<snapshot>);
+
+namespace {
+// 0 -> 1 -> ... -> n-1 with shortcuts i -> i+2
+versioned_digraph<int> make_graph(const unsigned int n) {
+    std::vector<unsigned int> sources, targets;
+    std::vector<int> lengths;
+    for(unsigned int i = 0; i + 1 < n; ++i) {
+        sources.push_back(i);
+        targets.push_back(i + 1);
+        lengths.push_back(1);
+        if(i + 2 < n) {
+            sources.push_back(i);
+            targets.push_back(i + 2);
+            lengths.push_back(3);
+        }
+    }
+    return versioned_digraph<int>(n, sources, targets, lengths, 2);
+}
+
+std::vector<int> distances(const snapshot & graph, const unsigned int s) {
+    std::vector<int> dist(graph.num_vertices(), -1);
+    for(auto && [u, d] : dijkstra(graph, graph.arc_property_map(), s))
+        dist[u] = d;
+    return dist;
+}
+}  // namespace
+
+GTEST_TEST(versioned_digraph, construction) {
+    auto graph = make_graph(10);
+    auto snap = graph.pin();
+    ASSERT_EQ(snap.version_number(), 0);
+    ASSERT_EQ(num_vertices(snap), 10);
+    ASSERT_EQ(num_arcs(snap), 17);
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(snap, 0), {1, 2}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(snap, 8), {9}));
+    ASSERT_TRUE(EMPTY(out_neighbors(snap, 9)));
+
+    unsigned int expected_id = 0;
+    for(auto && a : arcs(snap)) {
+        ASSERT_EQ(a.id, expected_id++);
+        ASSERT_EQ(snap.arc_property_map()[a],
+                  arc_target(snap, a) == arc_source(snap, a) + 1 ? 1 : 3);
+    }
+    ASSERT_EQ(expected_id, 17);
+    ASSERT_EQ(distances(snap, 0)[9], 9);
+}
+
+GTEST_TEST(versioned_digraph, publish_and_snapshot_isolation) {
+    auto graph = make_graph(10);
+    auto old_snap = graph.pin();
+
+    // close the arcs 4 -> 5 and 4 -> 6, shortcut 5 -> 7 and add 4 -> 9
+    for(auto && a : out_arcs(old_snap, 4)) graph.remove_arc(a);
+    for(auto && a : out_arcs(old_snap, 5))
+        if(arc_target(old_snap, a) == 7) graph.set_arc_property(a, 1);
+    graph.add_arc(4, 9, 20);
+    graph.add_arc(3, 5, 2);
+    ASSERT_TRUE(graph.has_pending_modifications());
+    ASSERT_EQ(graph.publish(), 1);
+    ASSERT_FALSE(graph.has_pending_modifications());
+
+    auto new_snap = graph.pin();
+    ASSERT_EQ(new_snap.version_number(), 1);
+    ASSERT_EQ(num_arcs(new_snap), 17);
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(new_snap, 3), {4, 5, 5}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(new_snap, 4), {9}));
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(old_snap, 4), {5, 6}));
+    auto new_dist = distances(new_snap, 0);
+    ASSERT_EQ(new_dist[5], 5);
+    ASSERT_EQ(new_dist[7], 6);
+    ASSERT_EQ(new_dist[9], 8);
+    ASSERT_EQ(distances(old_snap, 0)[7], 7);
+
+    // the segment of the vertices [8,10) is shared by both versions
+    ASSERT_EQ(out_neighbors(old_snap, 8).data(),
+              out_neighbors(new_snap, 8).data());
+    ASSERT_NE(out_neighbors(old_snap, 4).data(),
+              out_neighbors(new_snap, 4).data());
+
+    unsigned int expected_id = 0;
+    for(auto && a : arcs(new_snap)) ASSERT_EQ(a.id, expected_id++);
+}
+
+GTEST_TEST(versioned_digraph, epoch_reclamation) {
+    auto graph = make_graph(10);
+    auto pinned = graph.pin();
+    graph.add_arc(0, 9, 1);
+    graph.publish();
+    graph.add_arc(0, 8, 1);
+    graph.publish();
+    ASSERT_EQ(graph.num_retired_versions(), 2);
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(pinned, 0), {1, 2}));
+
+    pinned.release();
+    graph.reclaim();
+    ASSERT_EQ(graph.num_retired_versions(), 0);
+
+    auto latest = graph.pin();
+    graph.add_arc(1, 9, 1);
+    graph.publish();
+    ASSERT_EQ(graph.num_retired_versions(), 1);
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(latest, 0), {1, 2, 9, 8}));
+    latest = graph.pin();
+    graph.reclaim();
+    ASSERT_EQ(graph.num_retired_versions(), 0);
+}
+
+GTEST_TEST(versioned_digraph, max_readers) {
+    std::vector<unsigned int> sources({0, 1}), targets({1, 2});
+    std::vector<int> lengths({1, 1});
+    versioned_digraph<int> graph(3, sources, targets, lengths, 2, 4);
+    ASSERT_EQ(graph.max_readers(), 4);
+
+    std::vector<snapshot> snaps;
+    for(std::size_t i = 0; i < graph.max_readers(); ++i) {
+        auto snap = graph.try_pin();
+        ASSERT_TRUE(snap.has_value());
+        snaps.push_back(std::move(*snap));
+    }
+    ASSERT_FALSE(graph.try_pin().has_value());
+
+    snaps[1].release();
+    auto snap = graph.try_pin();
+    ASSERT_TRUE(snap.has_value());
+    ASSERT_TRUE(EQ_RANGES(out_neighbors(*snap, 0), {1}));
+    ASSERT_FALSE(graph.try_pin().has_value());
+
+    std::jthread releaser([&snaps] { snaps[2].release(); });
+    snaps.push_back(graph.pin());
+    ASSERT_EQ(snaps.back().num_arcs(), 2);
+}
+
+GTEST_TEST(versioned_digraph, concurrent_readers) {
+    auto graph = make_graph(64);
+    std::atomic<bool> stop = false;
+    std::atomic<bool> consistent = true;
+    std::vector<std::jthread> readers;
+    for(int r = 0; r < 4; ++r) {
+        readers.emplace_back([&] {
+            while(!stop) {
+                auto snap = graph.pin();
+                // every version sets all the arc lengths to its number + 1
+                const int length = static_cast<int>(snap.version_number()) + 1;
+                for(auto && a : arcs(snap))
+                    if(snap.arc_property_map()[a] != length &&
+                       snap.version_number() > 0)
+                        consistent = false;
+                if(snap.version_number() > 0 &&
+                   distances(snap, 0)[63] != 32 * length)
+                    consistent = false;
+            }
+        });
+    }
+    for(int v = 1; v <= 50; ++v) {
+        auto snap = graph.pin();
+        for(auto && a : arcs(snap)) graph.set_arc_property(a, v + 1);
+        snap.release();
+        graph.publish();
+    }
+    stop = true;
+    readers.clear();
+    ASSERT_TRUE(consistent);
+    graph.reclaim();
+    ASSERT_EQ(graph.num_retired_versions(), 0);
+}
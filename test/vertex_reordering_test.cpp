@@ -0,0 +1,133 @@
+#undef NDEBUG
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "melon/algorithm/breadth_first_search.hpp"
+#include "melon/algorithm/dijkstra.hpp"
+#include "melon/container/static_digraph.hpp"
+#include "melon/utility/static_digraph_builder.hpp"
+#include "melon/utility/vertex_reordering.hpp"
+
+#include "ranges_test_helper.hpp"
+
+using namespace fhamonic::melon;
+
+namespace {
+// a grid whose vertex ids are shuffled, with arcs in both directions
+auto shuffled_grid(const unsigned int side) {
+    std::vector<unsigned int> ids(side * side);
+    std::iota(ids.begin(), ids.end(), 0u);
+    std::ranges::shuffle(ids, std::mt19937(17));
+    static_digraph_builder<static_digraph, int> builder(side * side);
+    for(unsigned int i = 0; i < side; ++i) {
+        for(unsigned int j = 0; j < side; ++j) {
+            const unsigned int u = ids[i * side + j];
+            if(j + 1 < side) {
+                builder.add_arc(u, ids[i * side + j + 1], static_cast<int>(i));
+                builder.add_arc(ids[i * side + j + 1], u, static_cast<int>(j));
+            }
+            if(i + 1 < side) {
+                builder.add_arc(u, ids[(i + 1) * side + j], 1);
+                builder.add_arc(ids[(i + 1) * side + j], u, 2);
+            }
+        }
+    }
+    return builder.build();
+}
+
+std::size_t arc_gap(const static_digraph & graph, const unsigned int a) {
+    return static_cast<std::size_t>(
+        std::abs(static_cast<long>(arc_source(graph, a)) -
+                 static_cast<long>(arc_target(graph, a))));
+}
+std::size_t bandwidth(const static_digraph & graph) {
+    std::size_t b = 0;
+    for(auto && a : arcs(graph)) b = std::max(b, arc_gap(graph, a));
+    return b;
+}
+std::size_t total_gap(const static_digraph & graph) {
+    std::size_t sum = 0;
+    for(auto && a : arcs(graph)) sum += arc_gap(graph, a);
+    return sum;
+}
+
+bool is_permutation(const std::vector<unsigned int> & order,
+                    const std::size_t n) {
+    std::vector<unsigned int> sorted(order);
+    std::ranges::sort(sorted);
+    return std::ranges::equal(sorted, std::views::iota(0u, n));
+}
+}  // namespace
+
+GTEST_TEST(vertex_reordering, orders_are_permutations) {
+    auto [graph, length_map] = shuffled_grid(12);
+    const std::size_t n = num_vertices(graph);
+    ASSERT_TRUE(is_permutation(breadth_first_order(graph), n));
+    ASSERT_TRUE(is_permutation(reverse_cuthill_mckee_order(graph), n));
+    ASSERT_TRUE(is_permutation(degree_order(graph), n));
+    ASSERT_TRUE(is_permutation(gorder_order(graph), n));
+
+    static_digraph empty_graph;
+    ASSERT_TRUE(reverse_cuthill_mckee_order(empty_graph).empty());
+    ASSERT_TRUE(gorder_order(empty_graph).empty());
+}
+
+GTEST_TEST(vertex_reordering, degree_order) {
+    static_digraph_builder<static_digraph> builder(4);
+    builder.add_arc(0, 1).add_arc(2, 1).add_arc(3, 1).add_arc(2, 3);
+    auto [graph] = builder.build();
+    ASSERT_TRUE(EQ_RANGES(degree_order(graph), {1, 2, 3, 0}));
+}
+
+GTEST_TEST(vertex_reordering, locality) {
+    auto [graph, length_map] = shuffled_grid(20);
+    auto rcm = reorder_vertices(graph, reverse_cuthill_mckee_order(graph));
+    auto bfs = reorder_vertices(graph, breadth_first_order(graph));
+    auto gorder = reorder_vertices(graph, gorder_order(graph));
+    ASSERT_LE(bandwidth(rcm.graph()), 40);
+    ASSERT_LE(bandwidth(bfs.graph()), 40);
+    ASSERT_LT(total_gap(gorder.graph()) * 4, total_gap(graph));
+}
+
+GTEST_TEST(vertex_reordering, same_graph_and_maps) {
+    auto [graph, length_map] = shuffled_grid(10);
+    auto reordering = reorder_vertices(graph, gorder_order(graph));
+    const static_digraph & new_graph = reordering.graph();
+    auto new_length_map = reordering.permute_arc_map(length_map);
+
+    ASSERT_EQ(num_vertices(new_graph), num_vertices(graph));
+    ASSERT_EQ(num_arcs(new_graph), num_arcs(graph));
+    for(auto && u : vertices(graph))
+        ASSERT_EQ(reordering.old_vertex_map()[reordering.new_vertex_map()[u]],
+                  u);
+    for(auto && a : arcs(new_graph)) {
+        const auto old_a = reordering.old_arc_map()[a];
+        ASSERT_EQ(reordering.old_vertex_map()[arc_source(new_graph, a)],
+                  arc_source(graph, old_a));
+        ASSERT_EQ(reordering.old_vertex_map()[arc_target(new_graph, a)],
+                  arc_target(graph, old_a));
+        ASSERT_EQ(new_length_map[a], length_map[old_a]);
+    }
+
+    auto id_map = graph.create_vertex_map<unsigned int>();
+    for(auto && u : vertices(graph)) id_map[u] = u;
+    auto new_id_map = reordering.permute_vertex_map(id_map);
+    for(auto && u : vertices(new_graph))
+        ASSERT_EQ(new_id_map[u], reordering.old_vertex_map()[u]);
+
+    const unsigned int s = 7;
+    auto dist = graph.create_vertex_map<int>(-1);
+    for(auto && [u, d] : dijkstra(graph, length_map, s)) dist[u] = d;
+    for(auto && [u, d] :
+        dijkstra(new_graph, new_length_map, reordering.new_vertex_map()[s]))
+        ASSERT_EQ(d, dist[reordering.old_vertex_map()[u]]);
+
+    std::size_t num_reached = 0;
+    for(auto && u :
+        breadth_first_search(new_graph, reordering.new_vertex_map()[s])) {
+        (void)u;
+        ++num_reached;
+    }
+    ASSERT_EQ(num_reached, num_vertices(graph));
+}